@@ -71,6 +71,14 @@ inline uint32_t getMinLsbSet(uint32_t value) {
     return multiplyDeBruijnBitPosition[static_cast<uint32_t>(value * 0x077CB531U) >> 27];
 }
 
+inline uint32_t getLowestSetBit(uint64_t value) {
+    auto lowPart = static_cast<uint32_t>(value);
+    if (lowPart != 0u) {
+        return getMinLsbSet(lowPart);
+    }
+    return 32u + getMinLsbSet(static_cast<uint32_t>(value >> 32));
+}
+
 constexpr uint32_t log2(uint32_t value) {
     if (value == 0) {
         return 32;
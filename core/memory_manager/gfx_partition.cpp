@@ -8,6 +8,8 @@
 #include "core/memory_manager/gfx_partition.h"
 
 #include "core/helpers/aligned_memory.h"
+#include "core/utilities/segregated_heap_allocator.h"
+#include "runtime/os_interface/debug_settings_manager.h"
 
 namespace NEO {
 
@@ -40,7 +42,11 @@ void GfxPartition::Heap::init(uint64_t base, uint64_t size) {
         size -= 2 * GfxPartition::heapGranularity;
     }
 
-    alloc = std::make_unique<HeapAllocator>(base + GfxPartition::heapGranularity, size);
+    if (DebugManager.flags.UseSegregatedHeapAllocator.get()) {
+        alloc = std::make_unique<SegregatedHeapAllocator>(base + GfxPartition::heapGranularity, size);
+    } else {
+        alloc = std::make_unique<HeapAllocator>(base + GfxPartition::heapGranularity, size);
+    }
 }
 
 void GfxPartition::freeGpuAddressRange(uint64_t ptr, size_t size) {
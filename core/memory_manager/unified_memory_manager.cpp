@@ -15,13 +15,38 @@
 namespace NEO {
 
 void SVMAllocsManager::MapBasedAllocationTracker::insert(SvmAllocationData allocationsPair) {
-    allocations.insert(std::make_pair(reinterpret_cast<void *>(allocationsPair.gpuAllocation->getGpuAddress()), allocationsPair));
+    auto gpuAddress = allocationsPair.gpuAllocation->getGpuAddress();
+    auto iter = allocations.insert(std::make_pair(reinterpret_cast<void *>(gpuAddress), allocationsPair)).first;
+    version++;
+    if (RangeRadixTree<SvmAllocationData>::isAligned(gpuAddress)) {
+        rangeIndex.insert(gpuAddress, allocationsPair.size, &iter->second);
+    } else {
+        allocationsOutsideRangeIndex++;
+    }
 }
 
 void SVMAllocsManager::MapBasedAllocationTracker::remove(SvmAllocationData allocationsPair) {
+    auto gpuAddress = allocationsPair.gpuAllocation->getGpuAddress();
+    if (RangeRadixTree<SvmAllocationData>::isAligned(gpuAddress)) {
+        rangeIndex.remove(gpuAddress, allocationsPair.size);
+    } else {
+        allocationsOutsideRangeIndex--;
+    }
     SvmAllocationContainer::iterator iter;
-    iter = allocations.find(reinterpret_cast<void *>(allocationsPair.gpuAllocation->getGpuAddress()));
+    iter = allocations.find(reinterpret_cast<void *>(gpuAddress));
     allocations.erase(iter);
+    version++;
+}
+
+SvmAllocationData *SVMAllocsManager::MapBasedAllocationTracker::getFromRangeIndex(const void *ptr) const {
+    auto svmAllocData = rangeIndex.find(reinterpret_cast<uint64_t>(ptr));
+    if (svmAllocData != nullptr) {
+        auto gpuAddress = svmAllocData->gpuAllocation->getGpuAddress();
+        if (reinterpret_cast<uint64_t>(ptr) >= gpuAddress && reinterpret_cast<uint64_t>(ptr) < gpuAddress + svmAllocData->size) {
+            return svmAllocData;
+        }
+    }
+    return nullptr;
 }
 
 SvmAllocationData *SVMAllocsManager::MapBasedAllocationTracker::get(const void *ptr) {
@@ -68,12 +93,25 @@ SvmMapOperation *SVMAllocsManager::MapOperationsTracker::get(const void *regionP
     return &iter->second;
 }
 
+const std::vector<GraphicsAllocation *> &SVMAllocsManager::getResidencySnapshot(uint32_t requestedTypesMask) {
+    auto &snapshot = residencySnapshots[requestedTypesMask];
+    if (snapshot.allocationsVersion != SVMAllocs.getVersion()) {
+        snapshot.allocations.clear();
+        for (auto &allocation : SVMAllocs.allocations) {
+            if (allocation.second.memoryType & requestedTypesMask) {
+                snapshot.allocations.push_back(allocation.second.gpuAllocation);
+            }
+        }
+        snapshot.allocationsVersion = SVMAllocs.getVersion();
+    }
+    return snapshot.allocations;
+}
+
 void SVMAllocsManager::makeInternalAllocationsResident(CommandStreamReceiver &commandStreamReceiver, uint32_t requestedTypesMask) {
     std::unique_lock<SpinLock> lock(mtx);
-    for (auto &allocation : this->SVMAllocs.allocations) {
-        if (allocation.second.memoryType & requestedTypesMask) {
-            commandStreamReceiver.makeResident(*allocation.second.gpuAllocation);
-        }
+    auto &allocations = getResidencySnapshot(requestedTypesMask);
+    if (!allocations.empty()) {
+        commandStreamReceiver.makeAllocationsResident(allocations);
     }
 }
 
@@ -125,8 +163,12 @@ void *SVMAllocsManager::createSharedUnifiedMemoryAllocation(size_t size, const U
         auto unifiedMemoryPointer = createUnifiedAllocationWithDeviceStorage(size, {});
         UNRECOVERABLE_IF(unifiedMemoryPointer == nullptr);
         auto unifiedMemoryAllocation = this->getSVMAlloc(unifiedMemoryPointer);
-        unifiedMemoryAllocation->memoryType = memoryProperties.memoryType;
-        unifiedMemoryAllocation->allocationFlagsProperty = memoryProperties.allocationFlags;
+        {
+            std::unique_lock<SpinLock> lock(mtx);
+            unifiedMemoryAllocation->memoryType = memoryProperties.memoryType;
+            unifiedMemoryAllocation->allocationFlagsProperty = memoryProperties.allocationFlags;
+            SVMAllocs.invalidate();
+        }
 
         UNRECOVERABLE_IF(cmdQ == nullptr);
         auto pageFaultManager = this->memoryManager->getPageFaultManager();
@@ -138,6 +180,10 @@ void *SVMAllocsManager::createSharedUnifiedMemoryAllocation(size_t size, const U
 }
 
 SvmAllocationData *SVMAllocsManager::getSVMAlloc(const void *ptr) {
+    auto svmData = SVMAllocs.getFromRangeIndex(ptr);
+    if (svmData != nullptr || !SVMAllocs.hasAllocationsOutsideRangeIndex()) {
+        return svmData;
+    }
     std::unique_lock<SpinLock> lock(mtx);
     return SVMAllocs.get(ptr);
 }
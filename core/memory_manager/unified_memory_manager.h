@@ -7,11 +7,16 @@
 
 #pragma once
 #include "core/unified_memory/unified_memory.h"
+#include "core/utilities/range_radix_tree.h"
 #include "core/utilities/spinlock.h"
 
+#include <atomic>
 #include <cstdint>
+#include <limits>
 #include <map>
 #include <mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace NEO {
 class CommandStreamReceiver;
@@ -44,10 +49,17 @@ class SVMAllocsManager {
         void insert(SvmAllocationData);
         void remove(SvmAllocationData);
         SvmAllocationData *get(const void *);
+        SvmAllocationData *getFromRangeIndex(const void *) const;
         size_t getNumAllocs() const { return allocations.size(); };
+        bool hasAllocationsOutsideRangeIndex() const { return allocationsOutsideRangeIndex.load() != 0u; }
+        uint64_t getVersion() const { return version; }
+        void invalidate() { version++; }
 
       protected:
         SvmAllocationContainer allocations;
+        RangeRadixTree<SvmAllocationData> rangeIndex;
+        std::atomic<uint32_t> allocationsOutsideRangeIndex{0u};
+        uint64_t version = 0u;
     };
 
     struct MapOperationsTracker {
@@ -89,6 +101,13 @@ class SVMAllocsManager {
     void makeInternalAllocationsResident(CommandStreamReceiver &commandStreamReceiver, uint32_t requestedTypesMask);
 
   protected:
+    // Gpu allocations matching a memory type mask, valid as long as the tracker version is unchanged
+    struct ResidencySnapshot {
+        uint64_t allocationsVersion = std::numeric_limits<uint64_t>::max();
+        std::vector<GraphicsAllocation *> allocations;
+    };
+
+    const std::vector<GraphicsAllocation *> &getResidencySnapshot(uint32_t requestedTypesMask);
     void *createZeroCopySvmAllocation(size_t size, const SvmAllocationProperties &svmProperties);
     void *createUnifiedAllocationWithDeviceStorage(size_t size, const SvmAllocationProperties &svmProperties);
 
@@ -97,6 +116,7 @@ class SVMAllocsManager {
 
     MapBasedAllocationTracker SVMAllocs;
     MapOperationsTracker svmMapOperations;
+    std::unordered_map<uint32_t, ResidencySnapshot> residencySnapshots;
     MemoryManager *memoryManager;
     SpinLock mtx;
 };
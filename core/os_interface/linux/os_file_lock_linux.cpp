@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "core/os_interface/linux/os_file_lock_linux.h"
+
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+
+namespace NEO {
+
+std::unique_ptr<FileLock> FileLock::acquire(const std::string &fileName) {
+    auto fileLock = std::make_unique<FileLockLinux>(fileName);
+    if (!fileLock->isLocked()) {
+        return nullptr;
+    }
+    return std::move(fileLock);
+}
+
+FileLockLinux::FileLockLinux(const std::string &fileName) {
+    fd = ::open(fileName.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0666);
+    if (fd < 0) {
+        return;
+    }
+    int result = 0;
+    do {
+        result = flock(fd, LOCK_EX);
+    } while (result != 0 && errno == EINTR);
+    locked = (result == 0);
+}
+
+FileLockLinux::~FileLockLinux() {
+    if (locked) {
+        flock(fd, LOCK_UN);
+    }
+    if (fd >= 0) {
+        close(fd);
+    }
+}
+
+} // namespace NEO
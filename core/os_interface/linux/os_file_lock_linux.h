@@ -0,0 +1,27 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "core/os_interface/os_file_lock.h"
+
+namespace NEO {
+
+class FileLockLinux : public FileLock {
+  public:
+    FileLockLinux(const std::string &fileName);
+    ~FileLockLinux() override;
+
+    bool isLocked() const {
+        return locked;
+    }
+
+  protected:
+    int fd = -1;
+    bool locked = false;
+};
+
+} // namespace NEO
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "core/os_interface/linux/os_mapped_file_linux.h"
+
+#include <cstdio>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace NEO {
+
+std::unique_ptr<MappedFile> MappedFile::open(const std::string &fileName) {
+    auto mappedFile = std::make_unique<MappedFileLinux>(fileName);
+    if (!mappedFile->isMapped()) {
+        return nullptr;
+    }
+    return std::move(mappedFile);
+}
+
+bool MappedFile::replace(const std::string &sourceFileName, const std::string &destinationFileName) {
+    return std::rename(sourceFileName.c_str(), destinationFileName.c_str()) == 0;
+}
+
+std::string MappedFile::getTemporaryFileName(const std::string &fileName) {
+    return fileName + "." + std::to_string(getpid()) + ".tmp";
+}
+
+bool MappedFile::isReplaceableWhileMapped() {
+    return true;
+}
+
+MappedFileLinux::MappedFileLinux(const std::string &fileName) {
+    auto fd = ::open(fileName.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return;
+    }
+
+    struct stat fileStat = {};
+    if (fstat(fd, &fileStat) == 0 && fileStat.st_size > 0) {
+        auto mappingSize = static_cast<size_t>(fileStat.st_size);
+        auto mapping = mmap(nullptr, mappingSize, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping != MAP_FAILED) {
+            // file truncated before it was mapped would fault on access past its new end
+            if (fstat(fd, &fileStat) == 0 && static_cast<size_t>(fileStat.st_size) == mappingSize) {
+                data = static_cast<const char *>(mapping);
+                size = mappingSize;
+            } else {
+                munmap(mapping, mappingSize);
+            }
+        }
+    }
+    // the mapping stays valid after the descriptor is closed and after the file is unlinked
+    close(fd);
+}
+
+MappedFileLinux::~MappedFileLinux() {
+    if (data != nullptr) {
+        munmap(const_cast<char *>(data), size);
+    }
+}
+
+} // namespace NEO
@@ -0,0 +1,23 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "core/os_interface/os_mapped_file.h"
+
+namespace NEO {
+
+class MappedFileLinux : public MappedFile {
+  public:
+    MappedFileLinux(const std::string &fileName);
+    ~MappedFileLinux() override;
+
+    bool isMapped() const {
+        return data != nullptr;
+    }
+};
+
+} // namespace NEO
@@ -0,0 +1,26 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <memory>
+#include <string>
+
+namespace NEO {
+
+// Exclusive lock shared by all processes, held for the lifetime of the object.
+class FileLock {
+  public:
+    // creates the lock file when needed and blocks until the lock is acquired
+    static std::unique_ptr<FileLock> acquire(const std::string &fileName);
+
+    virtual ~FileLock() = default;
+
+  protected:
+    FileLock() = default;
+};
+
+} // namespace NEO
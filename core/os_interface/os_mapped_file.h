@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace NEO {
+
+class MappedFile {
+  public:
+    static std::unique_ptr<MappedFile> open(const std::string &fileName);
+    static bool replace(const std::string &sourceFileName, const std::string &destinationFileName);
+    // temporary file for publishing fileName with replace, unique per process
+    static std::string getTemporaryFileName(const std::string &fileName);
+    // false when replace fails while the destination file is mapped
+    static bool isReplaceableWhileMapped();
+
+    virtual ~MappedFile() = default;
+
+    const char *getData() const {
+        return data;
+    }
+    size_t getSize() const {
+        return size;
+    }
+
+  protected:
+    MappedFile() = default;
+
+    const char *data = nullptr;
+    size_t size = 0u;
+};
+
+} // namespace NEO
@@ -0,0 +1,39 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "core/os_interface/windows/os_file_lock_win.h"
+
+namespace NEO {
+
+std::unique_ptr<FileLock> FileLock::acquire(const std::string &fileName) {
+    auto fileLock = std::make_unique<FileLockWindows>(fileName);
+    if (!fileLock->isLocked()) {
+        return nullptr;
+    }
+    return std::move(fileLock);
+}
+
+FileLockWindows::FileLockWindows(const std::string &fileName) {
+    file = CreateFileA(fileName.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return;
+    }
+    OVERLAPPED overlapped = {};
+    locked = LockFileEx(file, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &overlapped) != FALSE;
+}
+
+FileLockWindows::~FileLockWindows() {
+    if (locked) {
+        OVERLAPPED overlapped = {};
+        UnlockFileEx(file, 0, MAXDWORD, MAXDWORD, &overlapped);
+    }
+    if (file != INVALID_HANDLE_VALUE) {
+        CloseHandle(file);
+    }
+}
+
+} // namespace NEO
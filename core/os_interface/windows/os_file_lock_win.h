@@ -0,0 +1,29 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "core/os_interface/os_file_lock.h"
+
+#include <windows.h>
+
+namespace NEO {
+
+class FileLockWindows : public FileLock {
+  public:
+    FileLockWindows(const std::string &fileName);
+    ~FileLockWindows() override;
+
+    bool isLocked() const {
+        return locked;
+    }
+
+  protected:
+    HANDLE file = INVALID_HANDLE_VALUE;
+    bool locked = false;
+};
+
+} // namespace NEO
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "core/os_interface/windows/os_mapped_file_win.h"
+
+namespace NEO {
+
+std::unique_ptr<MappedFile> MappedFile::open(const std::string &fileName) {
+    auto mappedFile = std::make_unique<MappedFileWindows>(fileName);
+    if (!mappedFile->isMapped()) {
+        return nullptr;
+    }
+    return std::move(mappedFile);
+}
+
+bool MappedFile::replace(const std::string &sourceFileName, const std::string &destinationFileName) {
+    return MoveFileExA(sourceFileName.c_str(), destinationFileName.c_str(), MOVEFILE_REPLACE_EXISTING) != FALSE;
+}
+
+std::string MappedFile::getTemporaryFileName(const std::string &fileName) {
+    return fileName + "." + std::to_string(GetCurrentProcessId()) + ".tmp";
+}
+
+bool MappedFile::isReplaceableWhileMapped() {
+    return false;
+}
+
+MappedFileWindows::MappedFileWindows(const std::string &fileName) {
+    file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return;
+    }
+
+    LARGE_INTEGER fileSize = {};
+    if (GetFileSizeEx(file, &fileSize) == FALSE || fileSize.QuadPart == 0) {
+        return;
+    }
+
+    mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        return;
+    }
+
+    auto view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view != nullptr) {
+        data = static_cast<const char *>(view);
+        size = static_cast<size_t>(fileSize.QuadPart);
+    }
+}
+
+MappedFileWindows::~MappedFileWindows() {
+    if (data != nullptr) {
+        UnmapViewOfFile(data);
+    }
+    if (mapping != nullptr) {
+        CloseHandle(mapping);
+    }
+    if (file != INVALID_HANDLE_VALUE) {
+        CloseHandle(file);
+    }
+}
+
+} // namespace NEO
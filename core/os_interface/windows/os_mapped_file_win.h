@@ -0,0 +1,29 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "core/os_interface/os_mapped_file.h"
+
+#include <windows.h>
+
+namespace NEO {
+
+class MappedFileWindows : public MappedFile {
+  public:
+    MappedFileWindows(const std::string &fileName);
+    ~MappedFileWindows() override;
+
+    bool isMapped() const {
+        return data != nullptr;
+    }
+
+  protected:
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+};
+
+} // namespace NEO
@@ -628,6 +628,45 @@ TEST(IDList, spliceAndDeleteAllNonThreadSafe) {
     iDListSpliceAndDeleteAll<false>();
 }
 
+template <bool ThreadSafe>
+void iDListSpliceFront() {
+    DummyDNode *nodes[7];
+    DummyDNode *nodes2[sizeof(nodes) / sizeof(nodes[0])];
+    uint32_t destructorCounter = 0;
+    makeList(nodes, &destructorCounter);
+    makeList(nodes2, &destructorCounter);
+    IDList<DummyDNode, ThreadSafe, false, false> list;
+    list.spliceFront(*nodes2[0]);
+    EXPECT_EQ(nodes2[0], list.peekHead());
+
+    list.spliceFront(*nodes[0]);
+
+    DummyDNode *nd = list.peekHead();
+    for (auto node : nodes) {
+        EXPECT_EQ(node, nd);
+        nd = nd->next;
+    }
+    for (auto node : nodes2) {
+        EXPECT_EQ(node, nd);
+        EXPECT_EQ(node->prev->next, node);
+        nd = nd->next;
+    }
+    EXPECT_EQ(nullptr, nd);
+    EXPECT_EQ(nullptr, list.peekHead()->prev);
+    EXPECT_EQ(nodes2[sizeof(nodes2) / sizeof(nodes2[0]) - 1], list.peekTail());
+
+    list.deleteAll();
+    EXPECT_EQ(2 * sizeof(nodes) / sizeof(nodes[0]), destructorCounter);
+}
+
+TEST(IDList, spliceFrontThreadSafe) {
+    iDListSpliceFront<true>();
+}
+
+TEST(IDList, spliceFrontNonThreadSafe) {
+    iDListSpliceFront<false>();
+}
+
 template <bool ThreadSafe>
 void iDListTestDetachNodes() {
     IDList<DummyDNode, ThreadSafe, false, false> list;
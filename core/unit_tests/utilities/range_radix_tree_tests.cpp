@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "core/utilities/range_radix_tree.h"
+
+#include "gtest/gtest.h"
+
+#include <limits>
+#include <map>
+#include <random>
+#include <thread>
+
+using namespace NEO;
+
+struct RangeValue {
+    uint64_t start;
+    uint64_t size;
+};
+
+struct MockRangeRadixTree : public RangeRadixTree<RangeValue> {
+    using RangeRadixTree<RangeValue>::activeLookups;
+    using RangeRadixTree<RangeValue>::getLookupStripe;
+    using RangeRadixTree<RangeValue>::lookupStripesCount;
+    using RangeRadixTree<RangeValue>::retiredNodes;
+};
+
+TEST(RangeRadixTreeTest, givenEmptyTreeWhenLookingUpThenNullIsReturned) {
+    RangeRadixTree<RangeValue> tree;
+    EXPECT_EQ(nullptr, tree.find(0u));
+    EXPECT_EQ(nullptr, tree.find(0x12345000u));
+    EXPECT_EQ(nullptr, tree.find(std::numeric_limits<uint64_t>::max()));
+}
+
+TEST(RangeRadixTreeTest, givenInsertedRangeWhenLookingUpAddressesThenValueIsReturnedOnlyWithinPagesOfTheRange) {
+    RangeRadixTree<RangeValue> tree;
+    RangeValue value{0x10000, 0x3100};
+    tree.insert(value.start, value.size, &value);
+
+    EXPECT_EQ(nullptr, tree.find(value.start - 1));
+    EXPECT_EQ(&value, tree.find(value.start));
+    EXPECT_EQ(&value, tree.find(value.start + 0x2000));
+    EXPECT_EQ(&value, tree.find(value.start + 0x3fff));
+    EXPECT_EQ(nullptr, tree.find(value.start + 0x4000));
+
+    tree.remove(value.start, value.size);
+    EXPECT_EQ(nullptr, tree.find(value.start));
+    EXPECT_EQ(nullptr, tree.find(value.start + 0x3fff));
+}
+
+TEST(RangeRadixTreeTest, givenRangeSpanningManyLevelsWhenInsertedThenWholeRangeIsFound) {
+    RangeRadixTree<RangeValue> tree;
+    RangeValue value{0x7fff0000000 - 0x3000, 0x200000000ull + 0x5000};
+    tree.insert(value.start, value.size, &value);
+
+    for (uint64_t offset = 0; offset < value.size; offset += 0x1f3000) {
+        EXPECT_EQ(&value, tree.find(value.start + offset));
+    }
+    EXPECT_EQ(&value, tree.find(value.start + value.size - 1));
+    EXPECT_EQ(nullptr, tree.find(value.start + value.size));
+    EXPECT_EQ(nullptr, tree.find(value.start - 1));
+
+    tree.remove(value.start, value.size);
+    for (uint64_t offset = 0; offset < value.size; offset += 0x1f3000) {
+        EXPECT_EQ(nullptr, tree.find(value.start + offset));
+    }
+}
+
+TEST(RangeRadixTreeTest, givenCanonizedHighAddressWhenInsertedThenItIsFound) {
+    RangeRadixTree<RangeValue> tree;
+    RangeValue value{0xffff800000010000ull, 0x10000};
+    tree.insert(value.start, value.size, &value);
+
+    EXPECT_EQ(&value, tree.find(value.start + 0x100));
+    EXPECT_EQ(nullptr, tree.find(0x800000010000ull));
+}
+
+TEST(RangeRadixTreeTest, givenAdjacentRangesWhenOneIsRemovedThenOtherIsStillFound) {
+    RangeRadixTree<RangeValue> tree;
+    RangeValue first{0x200000, 0x200000};
+    RangeValue second{0x400000, 0x1000};
+    tree.insert(first.start, first.size, &first);
+    tree.insert(second.start, second.size, &second);
+
+    EXPECT_EQ(&first, tree.find(second.start - 1));
+    EXPECT_EQ(&second, tree.find(second.start));
+
+    tree.remove(first.start, first.size);
+    EXPECT_EQ(nullptr, tree.find(first.start));
+    EXPECT_EQ(&second, tree.find(second.start));
+
+    tree.insert(first.start + 0x1000, 0x1000, &first);
+    EXPECT_EQ(nullptr, tree.find(first.start));
+    EXPECT_EQ(&first, tree.find(first.start + 0x1000));
+    EXPECT_EQ(nullptr, tree.find(first.start + 0x2000));
+}
+
+TEST(RangeRadixTreeTest, givenRandomInsertsAndRemovalsWhenLookingUpThenResultsMatchOrderedMap) {
+    RangeRadixTree<RangeValue> tree;
+    std::map<uint64_t, RangeValue> ranges;
+    std::mt19937_64 generator(0);
+
+    for (uint32_t i = 0; i < 2000; i++) {
+        if (ranges.empty() || generator() % 3 != 0) {
+            uint64_t start = (generator() % 0x100000) * 0x1000;
+            uint64_t size = (generator() % 64 + 1) * 0x1000;
+            auto next = ranges.lower_bound(start);
+            bool overlaps = (next != ranges.end() && next->first < start + size);
+            if (next != ranges.begin()) {
+                auto previous = std::prev(next);
+                overlaps |= previous->first + previous->second.size > start;
+            }
+            if (!overlaps) {
+                auto &value = ranges[start];
+                value = {start, size};
+                tree.insert(start, size, &value);
+            }
+        } else {
+            auto it = ranges.begin();
+            std::advance(it, generator() % ranges.size());
+            tree.remove(it->second.start, it->second.size);
+            ranges.erase(it);
+        }
+
+        for (uint32_t lookup = 0; lookup < 8; lookup++) {
+            uint64_t address = generator() % (0x100040ull * 0x1000);
+            const RangeValue *expected = nullptr;
+            auto it = ranges.upper_bound(address);
+            if (it != ranges.begin()) {
+                --it;
+                if (address < it->first + it->second.size) {
+                    expected = &it->second;
+                }
+            }
+            ASSERT_EQ(expected, tree.find(address));
+        }
+    }
+
+    for (auto &range : ranges) {
+        tree.remove(range.second.start, range.second.size);
+    }
+    EXPECT_EQ(0u, tree.getNodesCount());
+}
+
+TEST(RangeRadixTreeTest, givenRangesSharingNodesWhenTheyAreRemovedThenNodesAreReleasedOnlyOnceEmpty) {
+    MockRangeRadixTree tree;
+    RangeValue first{0x7fff0000000 - 0x3000, 0x5000};
+    RangeValue second{0x7fff0000000 + 0x10000, 0x1000};
+    tree.insert(first.start, first.size, &first);
+    auto nodesCountForFirst = tree.getNodesCount();
+    EXPECT_NE(0u, nodesCountForFirst);
+
+    tree.insert(second.start, second.size, &second);
+    EXPECT_EQ(nodesCountForFirst, tree.getNodesCount());
+
+    tree.remove(first.start, first.size);
+    EXPECT_NE(0u, tree.getNodesCount());
+    EXPECT_EQ(&second, tree.find(second.start));
+
+    tree.remove(second.start, second.size);
+    EXPECT_EQ(0u, tree.getNodesCount());
+    EXPECT_TRUE(tree.retiredNodes.empty());
+    EXPECT_EQ(nullptr, tree.find(second.start));
+}
+
+TEST(RangeRadixTreeTest, givenLookupInProgressWhenNodesAreUnlinkedThenTheyAreReleasedByFirstUpdateWithoutLookups) {
+    MockRangeRadixTree tree;
+    RangeValue first{0x10000, 0x1000};
+    RangeValue second{0x40000000, 0x1000};
+    tree.insert(first.start, first.size, &first);
+
+    auto &otherThreadLookups = tree.activeLookups[(MockRangeRadixTree::getLookupStripe() + 1) % MockRangeRadixTree::lookupStripesCount].count;
+    otherThreadLookups++;
+    tree.remove(first.start, first.size);
+    EXPECT_EQ(0u, tree.getNodesCount());
+    EXPECT_FALSE(tree.retiredNodes.empty());
+
+    tree.insert(second.start, second.size, &second);
+    EXPECT_FALSE(tree.retiredNodes.empty());
+
+    otherThreadLookups--;
+    tree.insert(first.start, first.size, &first);
+    EXPECT_TRUE(tree.retiredNodes.empty());
+    EXPECT_EQ(&first, tree.find(first.start));
+    EXPECT_EQ(&second, tree.find(second.start));
+}
+
+TEST(RangeRadixTreeTest, givenLookupsFromDifferentThreadsWhenCountedThenSeparateStripesAreUsed) {
+    auto mainThreadStripe = MockRangeRadixTree::getLookupStripe();
+    EXPECT_EQ(mainThreadStripe, MockRangeRadixTree::getLookupStripe());
+
+    uint32_t otherThreadStripe = mainThreadStripe;
+    std::thread otherThread([&] { otherThreadStripe = MockRangeRadixTree::getLookupStripe(); });
+    otherThread.join();
+    EXPECT_NE(mainThreadStripe, otherThreadStripe);
+    EXPECT_LT(otherThreadStripe, static_cast<uint32_t>(MockRangeRadixTree::lookupStripesCount));
+}
@@ -0,0 +1,246 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "core/memory_manager/memory_constants.h"
+#include "core/utilities/segregated_heap_allocator.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <vector>
+
+using namespace NEO;
+
+class SegregatedHeapAllocatorUnderTest : public SegregatedHeapAllocator {
+  public:
+    using SegregatedHeapAllocator::SegregatedHeapAllocator;
+
+    using SegregatedHeapAllocator::firstLevelBitmap;
+    using SegregatedHeapAllocator::freeBlocksByStart;
+    using SegregatedHeapAllocator::mapping;
+
+    size_t getFreeBlocksCount() const { return freeBlocksByStart.size(); }
+    uint64_t getFreeBlockSize(uint64_t ptr) const { return freeBlocks[freeBlocksByStart.at(ptr)].size; }
+};
+
+TEST(SegregatedHeapAllocatorTest, givenNewAllocatorThenWholeRangeIsSingleFreeBlock) {
+    uint64_t ptrBase = 0x100000llu;
+    size_t size = 1024 * 4096;
+    SegregatedHeapAllocatorUnderTest heapAllocator(ptrBase, size);
+
+    EXPECT_EQ(size, heapAllocator.getLeftSize());
+    EXPECT_EQ(0u, heapAllocator.getUsedSize());
+    ASSERT_EQ(1u, heapAllocator.getFreeBlocksCount());
+    EXPECT_EQ(size, heapAllocator.getFreeBlockSize(ptrBase));
+}
+
+TEST(SegregatedHeapAllocatorTest, givenSmallAllocationThenItIsTakenFromTopOfTheRange) {
+    uint64_t ptrBase = 0x100000llu;
+    size_t size = 1024 * 4096;
+    size_t threshold = 16 * 4096;
+    SegregatedHeapAllocatorUnderTest heapAllocator(ptrBase, size, threshold);
+
+    size_t ptrSize = 4096;
+    auto ptr = heapAllocator.allocate(ptrSize);
+    EXPECT_EQ(ptrBase + size - 4096, ptr);
+    EXPECT_EQ(4096u, ptrSize);
+    EXPECT_EQ(4096u, heapAllocator.getUsedSize());
+
+    heapAllocator.free(ptr, ptrSize);
+    EXPECT_EQ(0u, heapAllocator.getUsedSize());
+}
+
+TEST(SegregatedHeapAllocatorTest, givenBigAllocationThenItIsTakenFromBottomOfTheRange) {
+    uint64_t ptrBase = 0x100000llu;
+    size_t size = 1024 * 4096;
+    size_t threshold = 16 * 4096;
+    SegregatedHeapAllocatorUnderTest heapAllocator(ptrBase, size, threshold);
+
+    size_t ptrSize = 32 * 4096;
+    auto ptr = heapAllocator.allocate(ptrSize);
+    EXPECT_EQ(ptrBase, ptr);
+    EXPECT_EQ(32u * 4096u, ptrSize);
+
+    heapAllocator.free(ptr, ptrSize);
+}
+
+TEST(SegregatedHeapAllocatorTest, givenUnalignedSizeWhenAllocatingThenSizeIsAlignedToPage) {
+    SegregatedHeapAllocatorUnderTest heapAllocator(0x100000llu, 1024 * 4096);
+
+    size_t ptrSize = 100;
+    auto ptr = heapAllocator.allocate(ptrSize);
+    EXPECT_NE(0llu, ptr);
+    EXPECT_EQ(4096u, ptrSize);
+
+    heapAllocator.free(ptr, ptrSize);
+}
+
+TEST(SegregatedHeapAllocatorTest, givenZeroSizeOrTooBigSizeWhenAllocatingThenNullIsReturned) {
+    size_t size = 1024 * 4096;
+    SegregatedHeapAllocatorUnderTest heapAllocator(0x100000llu, size);
+
+    size_t ptrSize = 0;
+    EXPECT_EQ(0llu, heapAllocator.allocate(ptrSize));
+
+    ptrSize = size + 4096;
+    EXPECT_EQ(0llu, heapAllocator.allocate(ptrSize));
+    EXPECT_EQ(size, heapAllocator.getLeftSize());
+}
+
+TEST(SegregatedHeapAllocatorTest, givenWholeRangeAllocatedWhenAllocatingThenNullIsReturned) {
+    size_t size = 1024 * 4096;
+    SegregatedHeapAllocatorUnderTest heapAllocator(0x100000llu, size);
+
+    size_t ptrSize = size;
+    auto ptr = heapAllocator.allocate(ptrSize);
+    EXPECT_EQ(0x100000llu, ptr);
+    EXPECT_EQ(0u, heapAllocator.firstLevelBitmap);
+
+    size_t secondSize = 4096;
+    EXPECT_EQ(0llu, heapAllocator.allocate(secondSize));
+
+    heapAllocator.free(ptr, ptrSize);
+    EXPECT_EQ(size, heapAllocator.getLeftSize());
+}
+
+TEST(SegregatedHeapAllocatorTest, givenNeighbouringChunksWhenFreedThenTheyAreCoalescedIntoSingleBlock) {
+    uint64_t ptrBase = 0x100000llu;
+    size_t size = 1024 * 4096;
+    SegregatedHeapAllocatorUnderTest heapAllocator(ptrBase, size);
+
+    size_t sizes[3] = {4096, 4096, 4096};
+    uint64_t ptrs[3];
+    for (int i = 0; i < 3; i++) {
+        ptrs[i] = heapAllocator.allocate(sizes[i]);
+        ASSERT_NE(0llu, ptrs[i]);
+    }
+    EXPECT_EQ(1u, heapAllocator.getFreeBlocksCount());
+
+    heapAllocator.free(ptrs[0], sizes[0]);
+    heapAllocator.free(ptrs[2], sizes[2]);
+    EXPECT_EQ(2u, heapAllocator.getFreeBlocksCount());
+
+    heapAllocator.free(ptrs[1], sizes[1]);
+    ASSERT_EQ(1u, heapAllocator.getFreeBlocksCount());
+    EXPECT_EQ(size, heapAllocator.getFreeBlockSize(ptrBase));
+}
+
+TEST(SegregatedHeapAllocatorTest, givenFreedChunkWhenAllocatingSameSizeThenChunkIsReused) {
+    SegregatedHeapAllocatorUnderTest heapAllocator(0x100000llu, 1024 * 4096);
+
+    size_t ptrSize = 4 * 4096;
+    auto ptr1 = heapAllocator.allocate(ptrSize);
+    size_t separatorSize = 4096;
+    auto separator = heapAllocator.allocate(separatorSize);
+    heapAllocator.free(ptr1, ptrSize);
+
+    auto ptr2 = heapAllocator.allocate(ptrSize);
+    EXPECT_EQ(ptr1, ptr2);
+
+    heapAllocator.free(ptr2, ptrSize);
+    heapAllocator.free(separator, separatorSize);
+}
+
+TEST(SegregatedHeapAllocatorTest, whenMappingSizesThenSizeClassesGrowMonotonically) {
+    SegregatedHeapAllocatorUnderTest heapAllocator(0x100000llu, 1024 * 4096);
+
+    uint32_t previousClass = 0u;
+    for (uint64_t pages = 1; pages < 4096; pages++) {
+        uint32_t firstLevel = 0u;
+        uint32_t secondLevel = 0u;
+        heapAllocator.mapping(pages * 4096, firstLevel, secondLevel);
+        EXPECT_LT(secondLevel, 16u);
+        auto sizeClass = firstLevel * 16 + secondLevel;
+        EXPECT_LE(previousClass, sizeClass);
+        previousClass = sizeClass;
+    }
+}
+
+TEST(SegregatedHeapAllocatorTest, givenRandomAllocationTraceWhenAllChunksAreFreedThenWholeRangeIsRecovered) {
+    uint64_t ptrBase = 0x100000llu;
+    size_t size = 4096 * 4096;
+    SegregatedHeapAllocatorUnderTest heapAllocator(ptrBase, size, 16 * 4096);
+
+    std::mt19937 generator(0);
+    std::vector<std::pair<uint64_t, size_t>> allocations;
+
+    for (uint32_t i = 0; i < 2000; i++) {
+        if (allocations.empty() || generator() % 3 != 0) {
+            size_t ptrSize = (generator() % 64 + 1) * 4096;
+            auto ptr = heapAllocator.allocate(ptrSize);
+            if (ptr != 0llu) {
+                EXPECT_GE(ptr, ptrBase);
+                EXPECT_LE(ptr + ptrSize, ptrBase + size);
+                for (auto &allocation : allocations) {
+                    EXPECT_TRUE(ptr + ptrSize <= allocation.first || allocation.first + allocation.second <= ptr);
+                }
+                allocations.emplace_back(ptr, ptrSize);
+            }
+        } else {
+            auto index = generator() % allocations.size();
+            heapAllocator.free(allocations[index].first, allocations[index].second);
+            allocations.erase(allocations.begin() + index);
+        }
+    }
+
+    std::shuffle(allocations.begin(), allocations.end(), generator);
+    for (auto &allocation : allocations) {
+        heapAllocator.free(allocation.first, allocation.second);
+    }
+
+    EXPECT_EQ(size, heapAllocator.getLeftSize());
+    ASSERT_EQ(1u, heapAllocator.getFreeBlocksCount());
+    EXPECT_EQ(size, heapAllocator.getFreeBlockSize(ptrBase));
+}
+
+TEST(SegregatedHeapAllocatorTest, givenLongRunningTraceOfSmallAndBigAllocationsWhenReplayedThroughHeapAllocatorInterfaceThenAllAllocationsSucceedWithoutOverlap) {
+    uint64_t ptrBase = 0x100000000llu;
+    size_t size = 1024 * MemoryConstants::gigaByte;
+    SegregatedHeapAllocatorUnderTest segregatedHeapAllocator(ptrBase, size);
+    HeapAllocator &heapAllocator = segregatedHeapAllocator;
+
+    // mostly small allocations with occasional big ones, freed out of order
+    std::mt19937 generator(0);
+    std::map<uint64_t, size_t> liveAllocations;
+    std::vector<uint64_t> livePtrs;
+
+    for (uint32_t i = 0; i < 20000; i++) {
+        if (livePtrs.empty() || generator() % 5 < 3) {
+            size_t ptrSize = (generator() % 16 == 0) ? (generator() % 64 + 1) * MemoryConstants::megaByte : (generator() % 32 + 1) * MemoryConstants::pageSize;
+            auto ptr = heapAllocator.allocate(ptrSize);
+            ASSERT_NE(0llu, ptr);
+
+            auto next = liveAllocations.lower_bound(ptr);
+            if (next != liveAllocations.end()) {
+                EXPECT_LE(ptr + ptrSize, next->first);
+            }
+            if (next != liveAllocations.begin()) {
+                auto previous = std::prev(next);
+                EXPECT_LE(previous->first + previous->second, ptr);
+            }
+            liveAllocations[ptr] = ptrSize;
+            livePtrs.push_back(ptr);
+        } else {
+            auto index = generator() % livePtrs.size();
+            auto ptr = livePtrs[index];
+            heapAllocator.free(ptr, liveAllocations[ptr]);
+            liveAllocations.erase(ptr);
+            livePtrs[index] = livePtrs.back();
+            livePtrs.pop_back();
+        }
+    }
+
+    for (auto &allocation : liveAllocations) {
+        heapAllocator.free(allocation.first, allocation.second);
+    }
+
+    EXPECT_EQ(size, heapAllocator.getLeftSize());
+    ASSERT_EQ(1u, segregatedHeapAllocator.getFreeBlocksCount());
+    EXPECT_EQ(size, segregatedHeapAllocator.getFreeBlockSize(ptrBase));
+}
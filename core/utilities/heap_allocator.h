@@ -36,7 +36,9 @@ class HeapAllocator {
         freedChunksSmall.reserve(50);
     }
 
-    uint64_t allocate(size_t &sizeToAllocate) {
+    virtual ~HeapAllocator() = default;
+
+    virtual uint64_t allocate(size_t &sizeToAllocate) {
         sizeToAllocate = alignUp(sizeToAllocate, allocationAlignment);
 
         std::lock_guard<std::mutex> lock(mtx);
@@ -83,7 +85,7 @@ class HeapAllocator {
         }
     }
 
-    void free(uint64_t ptr, size_t size) {
+    virtual void free(uint64_t ptr, size_t size) {
         if (ptr == 0llu)
             return;
 
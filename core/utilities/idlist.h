@@ -223,6 +223,10 @@ class IDList {
         processLocked<ThisType, &ThisType::spliceImpl>(&nodes);
     }
 
+    void spliceFront(NodeObjectType &nodes) {
+        processLocked<ThisType, &ThisType::spliceFrontImpl>(&nodes);
+    }
+
     void deleteAll() {
         NodeObjectType *nodes = detachNodes();
         nodes->deleteThisAndAllNext();
@@ -432,6 +436,19 @@ class IDList {
         return nullptr;
     }
 
+    NodeObjectType *spliceFrontImpl(NodeObjectType *node, void *) {
+        if (head == nullptr) {
+            return spliceImpl(node, nullptr);
+        }
+
+        NodeObjectType *nodesTail = node->getTail();
+        node->prev = nullptr;
+        nodesTail->next = head;
+        head->prev = nodesTail;
+        head = node;
+        return nullptr;
+    }
+
     NodeObjectType *peekContainsImpl(NodeObjectType *node, void *) {
         NodeObjectType *curr = head;
         while (curr != nullptr) {
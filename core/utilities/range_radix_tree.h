@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "core/helpers/aligned_memory.h"
+#include "core/helpers/non_copyable_or_moveable.h"
+#include "core/memory_manager/memory_constants.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace NEO {
+
+// Radix tree over the 64-bit address space at page granularity, mapping non-overlapping
+// ranges to values. A range is stored in the highest level entries it fully covers, so
+// inserting and removing touch only entries on its edges. Lookups are wait-free and may run
+// concurrently with updates; updates have to be serialized by the caller. Nodes left empty by
+// a removal are unlinked and released by the first update that sees no lookup in progress,
+// so a concurrent lookup never touches released memory. Lookups in progress are counted in
+// per-thread stripes on separate cache lines, so readers don't contend with each other.
+template <typename ValueType>
+class RangeRadixTree : NonCopyableOrMovableClass {
+  public:
+    RangeRadixTree() = default;
+
+    ~RangeRadixTree() {
+        releaseChildren(root);
+        for (auto node : retiredNodes) {
+            delete node;
+        }
+    }
+
+    void insert(uint64_t start, uint64_t size, ValueType *value) {
+        update(start, size, reinterpret_cast<uintptr_t>(value) | valueTag);
+    }
+
+    void remove(uint64_t start, uint64_t size) {
+        update(start, size, 0u);
+    }
+
+    ValueType *find(uint64_t address) const {
+        ValueType *value = nullptr;
+        auto &lookups = activeLookups[getLookupStripe()].count;
+        lookups.fetch_add(1u);
+        const Node *node = &root;
+        for (uint32_t level = 0; level < levelsCount; level++) {
+            auto entry = node->entries[getEntryIndex(address, level)].load();
+            if (entry == 0u) {
+                break;
+            }
+            if (entry & valueTag) {
+                value = reinterpret_cast<ValueType *>(entry & ~valueTag);
+                break;
+            }
+            node = reinterpret_cast<const Node *>(entry);
+        }
+        lookups.fetch_sub(1u, std::memory_order_release);
+        return value;
+    }
+
+    size_t getNodesCount() const {
+        return nodesCount;
+    }
+
+    static constexpr bool isAligned(uint64_t start) {
+        return (start & (granularity - 1)) == 0u;
+    }
+
+  protected:
+    static constexpr uint32_t granularityLog2 = 12u;
+    static constexpr uint64_t granularity = 1ull << granularityLog2;
+    static constexpr uint32_t bitsPerLevel = 9u;
+    static constexpr uint32_t entriesPerNode = 1u << bitsPerLevel;
+    static constexpr uint32_t levelsCount = (64u - granularityLog2 + bitsPerLevel - 1) / bitsPerLevel;
+    static constexpr uintptr_t valueTag = 1u;
+    static constexpr uint32_t lookupStripesCount = 16u;
+
+    struct LookupStripe {
+        std::atomic<uint32_t> count{0u};
+        char padding[MemoryConstants::cacheLineSize - sizeof(std::atomic<uint32_t>)];
+    };
+
+    static uint32_t getLookupStripe() {
+        static std::atomic<uint32_t> threadsCount{0u};
+        thread_local uint32_t stripe = threadsCount++ % lookupStripesCount;
+        return stripe;
+    }
+
+    struct Node {
+        Node() {
+            for (auto &entry : entries) {
+                entry.store(0u, std::memory_order_relaxed);
+            }
+        }
+        bool isEmpty() const {
+            for (auto &entry : entries) {
+                if (entry.load(std::memory_order_relaxed) != 0u) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        std::atomic<uintptr_t> entries[entriesPerNode];
+    };
+
+    static uint32_t getShift(uint32_t level) {
+        return granularityLog2 + bitsPerLevel * (levelsCount - 1 - level);
+    }
+
+    static uint32_t getEntryIndex(uint64_t address, uint32_t level) {
+        return static_cast<uint32_t>(address >> getShift(level)) & (entriesPerNode - 1);
+    }
+
+    static bool isChildNode(uintptr_t entry) {
+        return entry != 0u && (entry & valueTag) == 0u;
+    }
+
+    void update(uint64_t start, uint64_t size, uintptr_t newEntry) {
+        if (size == 0u) {
+            return;
+        }
+        auto first = alignDown(start, granularity);
+        auto last = alignUp(start + size, granularity) - 1;
+        updateEntries(root, 0u, first, last, newEntry);
+        releaseRetiredNodes();
+    }
+
+    void updateEntries(Node &node, uint32_t level, uint64_t first, uint64_t last, uintptr_t newEntry) {
+        uint64_t entrySize = 1ull << getShift(level);
+        auto firstIndex = getEntryIndex(first, level);
+        auto lastIndex = getEntryIndex(last, level);
+
+        for (auto index = firstIndex; index <= lastIndex; index++) {
+            auto entryStart = alignDown(first, entrySize) + (index - firstIndex) * entrySize;
+            auto entryLast = entryStart + (entrySize - 1);
+            auto &entry = node.entries[index];
+            auto currentEntry = entry.load(std::memory_order_relaxed);
+
+            bool fullyCovered = first <= entryStart && entryLast <= last;
+            if (fullyCovered && !isChildNode(currentEntry)) {
+                entry.store(newEntry, std::memory_order_release);
+                continue;
+            }
+
+            Node *child = nullptr;
+            if (isChildNode(currentEntry)) {
+                child = reinterpret_cast<Node *>(currentEntry);
+            } else {
+                if (newEntry == 0u) {
+                    continue;
+                }
+                child = new Node();
+                nodesCount++;
+                entry.store(reinterpret_cast<uintptr_t>(child), std::memory_order_release);
+            }
+            updateEntries(*child, level + 1, std::max(first, entryStart), std::min(last, entryLast), newEntry);
+
+            if (newEntry == 0u && child->isEmpty()) {
+                // sequentially consistent, so a lookup that starts after the unlinking is seen cannot reach the node
+                entry.store(0u);
+                retiredNodes.push_back(child);
+                nodesCount--;
+            }
+        }
+    }
+
+    void releaseRetiredNodes() {
+        if (retiredNodes.empty()) {
+            return;
+        }
+        for (auto &stripe : activeLookups) {
+            if (stripe.count.load() != 0u) {
+                return;
+            }
+        }
+        for (auto node : retiredNodes) {
+            delete node;
+        }
+        retiredNodes.clear();
+    }
+
+    void releaseChildren(Node &node) {
+        for (auto &entry : node.entries) {
+            auto currentEntry = entry.load(std::memory_order_relaxed);
+            if (isChildNode(currentEntry)) {
+                auto child = reinterpret_cast<Node *>(currentEntry);
+                releaseChildren(*child);
+                delete child;
+            }
+        }
+    }
+
+    Node root;
+    size_t nodesCount = 0u;
+    std::vector<Node *> retiredNodes;
+    mutable LookupStripe activeLookups[lookupStripesCount];
+};
+} // namespace NEO
@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "core/utilities/segregated_heap_allocator.h"
+
+#include "core/helpers/basic_math.h"
+
+namespace NEO {
+
+SegregatedHeapAllocator::SegregatedHeapAllocator(uint64_t address, uint64_t size, size_t threshold) : HeapAllocator(address, size, threshold) {
+    for (auto &secondLevelHeads : freeListHeads) {
+        for (auto &head : secondLevelHeads) {
+            head = invalidBlockIndex;
+        }
+    }
+    freeBlocks.reserve(64);
+    freeBlocksByStart.reserve(64);
+    freeBlocksByEnd.reserve(64);
+
+    availableSize = alignDown(size, allocationAlignment);
+    insertFreeBlock(address, availableSize);
+}
+
+uint64_t SegregatedHeapAllocator::allocate(size_t &sizeToAllocate) {
+    sizeToAllocate = alignUp(sizeToAllocate, allocationAlignment);
+
+    std::lock_guard<std::mutex> lock(mtx);
+    DBG_LOG(PrintDebugMessages, __FUNCTION__, "Allocator usage == ", this->getUsage());
+    if (sizeToAllocate == 0u || availableSize < sizeToAllocate) {
+        return 0llu;
+    }
+
+    uint32_t firstLevel = 0u;
+    uint32_t secondLevel = 0u;
+    if (!findFreeList(sizeToAllocate, firstLevel, secondLevel)) {
+        return 0llu;
+    }
+
+    auto blockIndex = freeListHeads[firstLevel][secondLevel];
+    unlinkFreeBlock(blockIndex);
+    auto &block = freeBlocks[blockIndex];
+    auto sizeLeft = block.size - sizeToAllocate;
+    uint64_t ptrReturn = block.ptr;
+
+    if (sizeLeft == 0u) {
+        freeBlocksByStart.erase(block.ptr);
+        freeBlocksByEnd.erase(block.ptr + block.size);
+        releaseFreeBlock(blockIndex);
+    } else if (sizeToAllocate > sizeThreshold) {
+        // Big allocations are taken from the bottom of a range
+        freeBlocksByStart.erase(block.ptr);
+        block.ptr += sizeToAllocate;
+        block.size = sizeLeft;
+        freeBlocksByStart[block.ptr] = blockIndex;
+        linkFreeBlock(blockIndex);
+    } else {
+        // Small allocations are taken from the top of a range
+        freeBlocksByEnd.erase(block.ptr + block.size);
+        ptrReturn = block.ptr + sizeLeft;
+        block.size = sizeLeft;
+        freeBlocksByEnd[block.ptr + block.size] = blockIndex;
+        linkFreeBlock(blockIndex);
+    }
+
+    availableSize -= sizeToAllocate;
+    return ptrReturn;
+}
+
+void SegregatedHeapAllocator::free(uint64_t ptr, size_t size) {
+    if (ptr == 0llu) {
+        return;
+    }
+    size = alignUp(size, allocationAlignment);
+
+    std::lock_guard<std::mutex> lock(mtx);
+    DBG_LOG(PrintDebugMessages, __FUNCTION__, "Allocator usage == ", this->getUsage());
+    availableSize += size;
+
+    auto leftNeighbour = freeBlocksByEnd.find(ptr);
+    auto rightNeighbour = freeBlocksByStart.find(ptr + size);
+
+    if (leftNeighbour != freeBlocksByEnd.end()) {
+        auto blockIndex = leftNeighbour->second;
+        unlinkFreeBlock(blockIndex);
+        freeBlocksByEnd.erase(leftNeighbour);
+        freeBlocks[blockIndex].size += size;
+
+        if (rightNeighbour != freeBlocksByStart.end()) {
+            auto rightBlockIndex = rightNeighbour->second;
+            unlinkFreeBlock(rightBlockIndex);
+            freeBlocksByStart.erase(rightNeighbour);
+            freeBlocks[blockIndex].size += freeBlocks[rightBlockIndex].size;
+            releaseFreeBlock(rightBlockIndex);
+        }
+        freeBlocksByEnd[freeBlocks[blockIndex].ptr + freeBlocks[blockIndex].size] = blockIndex;
+        linkFreeBlock(blockIndex);
+    } else if (rightNeighbour != freeBlocksByStart.end()) {
+        auto blockIndex = rightNeighbour->second;
+        unlinkFreeBlock(blockIndex);
+        freeBlocksByStart.erase(rightNeighbour);
+        freeBlocks[blockIndex].ptr = ptr;
+        freeBlocks[blockIndex].size += size;
+        freeBlocksByStart[ptr] = blockIndex;
+        linkFreeBlock(blockIndex);
+    } else {
+        insertFreeBlock(ptr, size);
+    }
+}
+
+void SegregatedHeapAllocator::mapping(uint64_t size, uint32_t &firstLevel, uint32_t &secondLevel) const {
+    auto pages = size / allocationAlignment;
+    if (pages < secondLevelCount) {
+        firstLevel = 0u;
+        secondLevel = static_cast<uint32_t>(pages);
+        return;
+    }
+    auto mostSignificantBit = Math::log2(pages);
+    firstLevel = mostSignificantBit - secondLevelLog2 + 1;
+    secondLevel = static_cast<uint32_t>(pages >> (mostSignificantBit - secondLevelLog2)) - secondLevelCount;
+}
+
+bool SegregatedHeapAllocator::findFreeList(uint64_t size, uint32_t &firstLevel, uint32_t &secondLevel) const {
+    // Round the request up to the next size class so that any block from the found list fits
+    auto pages = size / allocationAlignment;
+    if (pages >= secondLevelCount) {
+        pages += (1ull << (Math::log2(pages) - secondLevelLog2)) - 1;
+    }
+    mapping(pages * allocationAlignment, firstLevel, secondLevel);
+    if (firstLevel >= firstLevelCount) {
+        return false;
+    }
+
+    auto secondLevelMap = secondLevelBitmaps[firstLevel] & (~0u << secondLevel);
+    if (secondLevelMap == 0u) {
+        auto firstLevelMap = (firstLevel + 1 < firstLevelCount) ? firstLevelBitmap & (~0ull << (firstLevel + 1)) : 0ull;
+        if (firstLevelMap == 0ull) {
+            return false;
+        }
+        firstLevel = Math::getLowestSetBit(firstLevelMap);
+        secondLevelMap = secondLevelBitmaps[firstLevel];
+    }
+    secondLevel = Math::getMinLsbSet(secondLevelMap);
+    return true;
+}
+
+void SegregatedHeapAllocator::insertFreeBlock(uint64_t ptr, uint64_t size) {
+    if (size == 0u) {
+        return;
+    }
+
+    uint32_t blockIndex = 0u;
+    if (unusedBlockIndices.empty()) {
+        blockIndex = static_cast<uint32_t>(freeBlocks.size());
+        freeBlocks.push_back({ptr, size, invalidBlockIndex, invalidBlockIndex});
+    } else {
+        blockIndex = unusedBlockIndices.back();
+        unusedBlockIndices.pop_back();
+        freeBlocks[blockIndex] = {ptr, size, invalidBlockIndex, invalidBlockIndex};
+    }
+
+    freeBlocksByStart[ptr] = blockIndex;
+    freeBlocksByEnd[ptr + size] = blockIndex;
+    linkFreeBlock(blockIndex);
+}
+
+void SegregatedHeapAllocator::linkFreeBlock(uint32_t blockIndex) {
+    uint32_t firstLevel = 0u;
+    uint32_t secondLevel = 0u;
+    mapping(freeBlocks[blockIndex].size, firstLevel, secondLevel);
+
+    auto &head = freeListHeads[firstLevel][secondLevel];
+    if (head != invalidBlockIndex) {
+        freeBlocks[head].prev = blockIndex;
+    }
+    freeBlocks[blockIndex].prev = invalidBlockIndex;
+    freeBlocks[blockIndex].next = head;
+    head = blockIndex;
+
+    firstLevelBitmap |= (1ull << firstLevel);
+    secondLevelBitmaps[firstLevel] |= (1u << secondLevel);
+}
+
+void SegregatedHeapAllocator::unlinkFreeBlock(uint32_t blockIndex) {
+    auto &block = freeBlocks[blockIndex];
+    uint32_t firstLevel = 0u;
+    uint32_t secondLevel = 0u;
+    mapping(block.size, firstLevel, secondLevel);
+
+    if (block.prev != invalidBlockIndex) {
+        freeBlocks[block.prev].next = block.next;
+    } else {
+        freeListHeads[firstLevel][secondLevel] = block.next;
+    }
+    if (block.next != invalidBlockIndex) {
+        freeBlocks[block.next].prev = block.prev;
+    }
+
+    if (freeListHeads[firstLevel][secondLevel] == invalidBlockIndex) {
+        secondLevelBitmaps[firstLevel] &= ~(1u << secondLevel);
+        if (secondLevelBitmaps[firstLevel] == 0u) {
+            firstLevelBitmap &= ~(1ull << firstLevel);
+        }
+    }
+}
+
+void SegregatedHeapAllocator::releaseFreeBlock(uint32_t blockIndex) {
+    unusedBlockIndices.push_back(blockIndex);
+}
+} // namespace NEO
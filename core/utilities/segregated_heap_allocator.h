@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "core/utilities/heap_allocator.h"
+
+#include <array>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace NEO {
+
+// Two level segregated fit allocator: free ranges are kept in lists bucketed by
+// size class with bitmaps over non-empty lists, so allocate and free are O(1)
+// and neighbouring free ranges are coalesced at free time.
+class SegregatedHeapAllocator : public HeapAllocator {
+  public:
+    SegregatedHeapAllocator(uint64_t address, uint64_t size) : SegregatedHeapAllocator(address, size, 4 * MemoryConstants::megaByte) {
+    }
+
+    SegregatedHeapAllocator(uint64_t address, uint64_t size, size_t threshold);
+
+    uint64_t allocate(size_t &sizeToAllocate) override;
+    void free(uint64_t ptr, size_t size) override;
+
+  protected:
+    static constexpr uint32_t secondLevelLog2 = 4u;
+    static constexpr uint32_t secondLevelCount = 1u << secondLevelLog2;
+    static constexpr uint32_t firstLevelCount = 64u;
+    static constexpr uint32_t invalidBlockIndex = std::numeric_limits<uint32_t>::max();
+
+    struct FreeBlock {
+        uint64_t ptr;
+        uint64_t size;
+        uint32_t prev;
+        uint32_t next;
+    };
+
+    void mapping(uint64_t size, uint32_t &firstLevel, uint32_t &secondLevel) const;
+    bool findFreeList(uint64_t size, uint32_t &firstLevel, uint32_t &secondLevel) const;
+    void insertFreeBlock(uint64_t ptr, uint64_t size);
+    void linkFreeBlock(uint32_t blockIndex);
+    void unlinkFreeBlock(uint32_t blockIndex);
+    void releaseFreeBlock(uint32_t blockIndex);
+
+    std::vector<FreeBlock> freeBlocks;
+    std::vector<uint32_t> unusedBlockIndices;
+    std::unordered_map<uint64_t, uint32_t> freeBlocksByStart;
+    std::unordered_map<uint64_t, uint32_t> freeBlocksByEnd;
+    std::array<std::array<uint32_t, secondLevelCount>, firstLevelCount> freeListHeads;
+    std::array<uint32_t, firstLevelCount> secondLevelBitmaps = {};
+    uint64_t firstLevelBitmap = 0u;
+};
+} // namespace NEO
@@ -1587,6 +1587,15 @@ cl_int CL_API_CALL clCreateKernelsInProgram(cl_program clProgram,
                 return retVal;
             }
 
+            for (unsigned int ordinal = 0; ordinal < numKernelsInProgram; ++ordinal) {
+                // kernels decoded lazily on first use may turn out to be invalid
+                if (program->getKernelInfo(ordinal) == nullptr) {
+                    retVal = CL_INVALID_PROGRAM_EXECUTABLE;
+                    TRACING_EXIT(clCreateKernelsInProgram, &retVal);
+                    return retVal;
+                }
+            }
+
             for (unsigned int ordinal = 0; ordinal < numKernelsInProgram; ++ordinal) {
                 const auto kernelInfo = program->getKernelInfo(ordinal);
                 DEBUG_BREAK_IF(kernelInfo == nullptr);
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/aub/dirty_page_tracker.h"
+
+#include "core/helpers/aligned_memory.h"
+#include "core/helpers/ptr_math.h"
+#include "core/memory_manager/memory_constants.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+template <typename PageHandler>
+void DirtyPageTracker::forEachPage(uint64_t gpuAddress, size_t size, PageHandler &&handler) {
+    size_t offset = 0;
+    while (offset < size) {
+        auto pageAddress = alignDown(gpuAddress + offset, MemoryConstants::pageSize);
+        auto chunkSize = std::min(static_cast<size_t>(pageAddress + MemoryConstants::pageSize - (gpuAddress + offset)), size - offset);
+        handler(pageAddress, offset, chunkSize);
+        offset += chunkSize;
+    }
+}
+
+Hash128::Value DirtyPageTracker::hashPage(uint64_t gpuAddress, const void *cpuAddress, size_t size) {
+    // the written sub-range is part of the hash, partial writes of the same page never alias
+    uint64_t range[] = {gpuAddress, size};
+    Hash128 hash;
+    hash.update(reinterpret_cast<const char *>(range), sizeof(range));
+    hash.update(reinterpret_cast<const char *>(cpuAddress), size);
+    return hash.finish();
+}
+
+void DirtyPageTracker::writeDirtyRanges(uint64_t gpuAddress, const void *cpuAddress, size_t size, uint32_t memoryBank, uint64_t entryBits, const RangeWriter &writer) {
+    std::lock_guard<std::mutex> lock(mtx);
+    size_t dirtyRangeOffset = 0;
+    size_t dirtyRangeSize = 0;
+
+    forEachPage(gpuAddress, size, [&](uint64_t pageAddress, size_t offset, size_t chunkSize) {
+        PageState pageState = {hashPage(gpuAddress + offset, ptrOffset(cpuAddress, offset), chunkSize), entryBits, memoryBank};
+        auto storedPage = pages.find(pageAddress);
+        if (storedPage != pages.end() && storedPage->second == pageState) {
+            bytesSkipped += chunkSize;
+            if (dirtyRangeSize != 0) {
+                writer(dirtyRangeOffset, dirtyRangeSize);
+                dirtyRangeSize = 0;
+            }
+            return;
+        }
+
+        pages[pageAddress] = pageState;
+        bytesWritten += chunkSize;
+        if (dirtyRangeSize == 0) {
+            dirtyRangeOffset = offset;
+        }
+        dirtyRangeSize += chunkSize;
+    });
+
+    if (dirtyRangeSize != 0) {
+        writer(dirtyRangeOffset, dirtyRangeSize);
+    }
+}
+
+void DirtyPageTracker::invalidate(uint64_t gpuAddress, size_t size) {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (pages.empty()) {
+        return;
+    }
+    forEachPage(gpuAddress, size, [&](uint64_t pageAddress, size_t offset, size_t chunkSize) {
+        pages.erase(pageAddress);
+    });
+}
+
+void DirtyPageTracker::reset() {
+    std::lock_guard<std::mutex> lock(mtx);
+    pages.clear();
+}
+} // namespace NEO
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/helpers/hash128.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+namespace NEO {
+
+class DirtyPageTracker {
+  public:
+    using RangeWriter = std::function<void(size_t offset, size_t size)>;
+
+    // calls writer for every run of pages whose contents or mapping changed since they were last written
+    void writeDirtyRanges(uint64_t gpuAddress, const void *cpuAddress, size_t size, uint32_t memoryBank, uint64_t entryBits, const RangeWriter &writer);
+    // forgets pages whose simulated contents may no longer match the host copy
+    void invalidate(uint64_t gpuAddress, size_t size);
+    void reset();
+
+    size_t peekBytesWritten() const { return bytesWritten; }
+    size_t peekBytesSkipped() const { return bytesSkipped; }
+    size_t peekTrackedPagesCount() const { return pages.size(); }
+    void resetStatistics() {
+        bytesWritten = 0;
+        bytesSkipped = 0;
+    }
+
+  protected:
+    struct PageState {
+        Hash128::Value hash;
+        uint64_t entryBits;
+        uint32_t memoryBank;
+
+        bool operator==(const PageState &other) const {
+            return hash == other.hash && entryBits == other.entryBits && memoryBank == other.memoryBank;
+        }
+    };
+
+    template <typename PageHandler>
+    static void forEachPage(uint64_t gpuAddress, size_t size, PageHandler &&handler);
+    static Hash128::Value hashPage(uint64_t gpuAddress, const void *cpuAddress, size_t size);
+
+    std::mutex mtx;
+    std::unordered_map<uint64_t, PageState> pages;
+    size_t bytesWritten = 0;
+    size_t bytesSkipped = 0;
+};
+} // namespace NEO
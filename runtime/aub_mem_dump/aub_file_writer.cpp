@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/aub_mem_dump/aub_file_writer.h"
+
+#include "runtime/os_interface/os_thread.h"
+
+namespace AubMemDump {
+
+AubFileWriter::AubFileWriter(std::ostream &output, size_t bufferSize)
+    : output(output), bufferSize(bufferSize) {
+    currentBuffer.reserve(bufferSize);
+    pendingBuffer.reserve(bufferSize);
+    thread = NEO::Thread::create(writeBuffers, reinterpret_cast<void *>(this));
+}
+
+AubFileWriter::~AubFileWriter() {
+    flush();
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        stopWriting = true;
+    }
+    bufferSubmitted.notify_one();
+    thread->join();
+}
+
+void AubFileWriter::write(const char *data, size_t size) {
+    if (!currentBuffer.empty() && currentBuffer.size() + size > bufferSize) {
+        submitCurrentBuffer();
+    }
+    currentBuffer.insert(currentBuffer.end(), data, data + size);
+}
+
+void AubFileWriter::submit() {
+    if (currentBuffer.empty()) {
+        return;
+    }
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        if (pendingBufferReady && pendingBuffer.size() + currentBuffer.size() <= bufferSize) {
+            pendingBuffer.insert(pendingBuffer.end(), currentBuffer.begin(), currentBuffer.end());
+            currentBuffer.clear();
+            return;
+        }
+    }
+    submitCurrentBuffer();
+}
+
+void AubFileWriter::flush() {
+    if (!currentBuffer.empty()) {
+        submitCurrentBuffer();
+    }
+    std::unique_lock<std::mutex> lock(mtx);
+    bufferWritten.wait(lock, [this] { return !pendingBufferReady && !writeInProgress; });
+    output.flush();
+}
+
+void AubFileWriter::submitCurrentBuffer() {
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        bufferWritten.wait(lock, [this] { return !pendingBufferReady; });
+        currentBuffer.swap(pendingBuffer);
+        pendingBufferReady = true;
+    }
+    bufferSubmitted.notify_one();
+    currentBuffer.clear();
+}
+
+void *AubFileWriter::writeBuffers(void *arg) {
+    auto self = reinterpret_cast<AubFileWriter *>(arg);
+    std::vector<char> bufferToWrite;
+    bufferToWrite.reserve(self->bufferSize);
+
+    std::unique_lock<std::mutex> lock(self->mtx);
+    while (true) {
+        self->bufferSubmitted.wait(lock, [self] { return self->pendingBufferReady || self->stopWriting; });
+        if (!self->pendingBufferReady) {
+            break;
+        }
+        bufferToWrite.swap(self->pendingBuffer);
+        self->pendingBufferReady = false;
+        self->writeInProgress = true;
+        lock.unlock();
+        self->bufferWritten.notify_all();
+
+        self->output.write(bufferToWrite.data(), bufferToWrite.size());
+        bufferToWrite.clear();
+
+        lock.lock();
+        self->writeInProgress = false;
+        self->bufferWritten.notify_all();
+    }
+    return nullptr;
+}
+} // namespace AubMemDump
@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace NEO {
+class Thread;
+} // namespace NEO
+
+namespace AubMemDump {
+
+// Collects AUB records in memory and writes them to the output from a background thread.
+// At most one filled buffer waits for the writer thread, write blocks when it is still pending.
+class AubFileWriter {
+  public:
+    AubFileWriter(std::ostream &output, size_t bufferSize);
+    ~AubFileWriter();
+
+    void write(const char *data, size_t size);
+    // hands the collected records over to the writer thread without waiting for the output,
+    // blocks only when merging them into the pending buffer would exceed the buffer size
+    void submit();
+    // waits until all records are written to the output
+    void flush();
+
+  protected:
+    static void *writeBuffers(void *arg);
+    void submitCurrentBuffer();
+
+    std::ostream &output;
+    const size_t bufferSize;
+    std::vector<char> currentBuffer;
+    std::vector<char> pendingBuffer;
+    bool pendingBufferReady = false;
+    bool writeInProgress = false;
+    bool stopWriting = false;
+
+    std::mutex mtx;
+    std::condition_variable bufferSubmitted;
+    std::condition_variable bufferWritten;
+    std::unique_ptr<NEO::Thread> thread;
+};
+} // namespace AubMemDump
@@ -16,6 +16,7 @@
 #endif
 
 #include "runtime/aub_mem_dump/aub_data.h"
+#include "runtime/aub_mem_dump/aub_file_writer.h"
 
 namespace NEO {
 class AubHelper;
@@ -144,6 +145,7 @@ struct AubFileStream : public AubStream {
     std::ofstream fileHandle;
     std::string fileName;
     std::mutex mutex;
+    std::unique_ptr<AubFileWriter> fileWriter;
 };
 
 template <int addressingBits>
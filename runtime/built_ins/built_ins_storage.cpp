@@ -5,6 +5,7 @@
  *
  */
 
+#include "core/os_interface/os_mapped_file.h"
 #include "runtime/built_ins/built_ins.h"
 #include "runtime/built_ins/builtins_dispatch_builder.h"
 #include "runtime/device/device.h"
@@ -106,16 +107,13 @@ BuiltinResourceT Storage::load(const std::string &resourceName) {
 }
 
 BuiltinResourceT FileStorage::loadImpl(const std::string &fullResourceName) {
-    BuiltinResourceT ret;
-
-    std::ifstream f{fullResourceName, std::ios::in | std::ios::binary | std::ios::ate};
-    auto end = f.tellg();
-    f.seekg(0, std::ios::beg);
-    auto beg = f.tellg();
-    auto s = end - beg;
-    ret.resize(static_cast<size_t>(s));
-    f.read(ret.data(), s);
-    return ret;
+    auto mappedResource = MappedFile::open(fullResourceName);
+    if (mappedResource == nullptr) {
+        BuiltinResourceT ret;
+        return ret;
+    }
+
+    return createBuiltinResource(mappedResource->getData(), mappedResource->getSize());
 }
 
 const BuiltinResourceT *EmbeddedStorageRegistry::get(const std::string &name) const {
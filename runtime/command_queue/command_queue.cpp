@@ -555,8 +555,7 @@ void CommandQueue::obtainNewTimestampPacketNodes(size_t numberOfNodes, Timestamp
 
 size_t CommandQueue::estimateTimestampPacketNodesCount(const MultiDispatchInfo &dispatchInfo) const {
     size_t nodesCount = dispatchInfo.size();
-    auto mainKernel = dispatchInfo.peekMainKernel();
-    if (mainKernel->requiresCacheFlushCommand(*this)) {
+    if (dispatchInfo.peekKernelRequiringCacheFlush(*this) != nullptr) {
         nodesCount++;
     }
     return nodesCount;
@@ -29,6 +29,7 @@ class IndirectHeap;
 class Kernel;
 class MemObj;
 class PerformanceCounters;
+class RecordedDispatchSequence;
 struct CompletionStamp;
 struct MultiDispatchInfo;
 
@@ -103,6 +104,12 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
         return CL_SUCCESS;
     }
 
+    virtual cl_int enqueueRecordedSequence(const RecordedDispatchSequence &sequence,
+                                           cl_uint numEventsInWaitList,
+                                           const cl_event *eventWaitList, cl_event *event) {
+        return CL_SUCCESS;
+    }
+
     virtual cl_int enqueueBarrierWithWaitList(cl_uint numEventsInWaitList,
                                               const cl_event *eventWaitList,
                                               cl_event *event) {
@@ -406,6 +413,11 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
 
     bool isMultiEngineQueue() const { return this->multiEngineQueue; }
 
+    // While capturing, enqueued kernels are recorded to the sequence instead of being submitted
+    void beginCapture(RecordedDispatchSequence &sequence) { captureSequence = &sequence; }
+    void endCapture() { captureSequence = nullptr; }
+    bool isCapturing() const { return captureSequence != nullptr; }
+
     // taskCount of last task
     uint32_t taskCount = 0;
 
@@ -463,6 +475,7 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     bool multiEngineQueue = false;
 
     std::unique_ptr<TimestampPacketContainer> timestampPacketContainer;
+    RecordedDispatchSequence *captureSequence = nullptr;
 };
 
 typedef CommandQueue *(*CommandQueueCreateFunc)(
@@ -136,6 +136,11 @@ class CommandQueueHw : public CommandQueue {
                          const cl_event *eventWaitList,
                          cl_event *event) override;
 
+    cl_int enqueueRecordedSequence(const RecordedDispatchSequence &sequence,
+                                   cl_uint numEventsInWaitList,
+                                   const cl_event *eventWaitList,
+                                   cl_event *event) override;
+
     cl_int enqueueSVMMap(cl_bool blockingMap,
                          cl_map_flags mapFlags,
                          void *svmPtr,
@@ -395,6 +400,10 @@ class CommandQueueHw : public CommandQueue {
     MOCKABLE_VIRTUAL void dispatchAuxTranslation(MultiDispatchInfo &multiDispatchInfo, MemObjsForAuxTranslation &memObjsForAuxTranslation,
                                                  AuxTranslationDirection auxTranslationDirection);
 
+    static void dispatchRecordedKernelsBarrier(LinearStream &commandStream) {
+        PipeControlHelper<GfxFamily>::addPipeControl(commandStream, false);
+    }
+
     template <uint32_t commandType>
     LinearStream *obtainCommandStream(const CsrDependencies &csrDependencies, bool blitEnqueue, bool blockedQueue,
                                       const MultiDispatchInfo &multiDispatchInfo, const EventsRequest &eventsRequest,
@@ -389,8 +389,15 @@ void CommandQueueHw<GfxFamily>::processDispatchForKernels(const MultiDispatchInf
     }
 
     if (commandType == CL_COMMAND_NDRANGE_KERNEL) {
-        if (multiDispatchInfo.peekMainKernel()->getProgram()->isKernelDebugEnabled()) {
-            setupDebugSurface(multiDispatchInfo.peekMainKernel());
+        Kernel *kernel = nullptr;
+        for (auto &dispatchInfo : multiDispatchInfo) {
+            if (kernel == dispatchInfo.getKernel()) {
+                continue;
+            }
+            kernel = dispatchInfo.getKernel();
+            if (kernel->getProgram()->isKernelDebugEnabled()) {
+                setupDebugSurface(kernel);
+            }
         }
     }
 
@@ -613,6 +620,7 @@ CompletionStamp CommandQueueHw<GfxFamily>::enqueueNonBlocked(
     auto mediaSamplerRequired = false;
     uint32_t numGrfRequired = GrfConfig::DefaultGrfNumber;
     auto specialPipelineSelectMode = false;
+    auto threadArbitrationPolicy = multiDispatchInfo.peekMainKernel()->getThreadArbitrationPolicy<GfxFamily>();
     Kernel *kernel = nullptr;
 
     for (auto &dispatchInfo : multiDispatchInfo) {
@@ -627,6 +635,9 @@ CompletionStamp CommandQueueHw<GfxFamily>::enqueueNonBlocked(
         auto numGrfRequiredByKernel = kernel->getKernelInfo().patchInfo.executionEnvironment->NumGRFRequired;
         numGrfRequired = std::max(numGrfRequired, numGrfRequiredByKernel);
         specialPipelineSelectMode |= kernel->requiresSpecialPipelineSelectMode();
+        if (kernel->getKernelInfo().patchInfo.executionEnvironment->SubgroupIndependentForwardProgressRequired) {
+            threadArbitrationPolicy = kernel->getThreadArbitrationPolicy<GfxFamily>();
+        }
         if (kernel->hasUncacheableStatelessArgs()) {
             anyUncacheableArgs = true;
         }
@@ -661,7 +672,7 @@ CompletionStamp CommandQueueHw<GfxFamily>::enqueueNonBlocked(
         ioh = &getIndirectHeap(IndirectHeap::INDIRECT_OBJECT, 0u);
     }
 
-    getGpgpuCommandStreamReceiver().requestThreadArbitrationPolicy(multiDispatchInfo.peekMainKernel()->getThreadArbitrationPolicy<GfxFamily>());
+    getGpgpuCommandStreamReceiver().requestThreadArbitrationPolicy(threadArbitrationPolicy);
 
     auto allocNeedsFlushDC = false;
     if (!device->isFullRangeSvm()) {
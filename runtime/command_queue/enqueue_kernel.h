@@ -9,6 +9,7 @@
 #include "runtime/built_ins/builtins_dispatch_builder.h"
 #include "runtime/command_queue/command_queue_hw.h"
 #include "runtime/command_queue/gpgpu_walker.h"
+#include "runtime/command_queue/recorded_dispatch_sequence.h"
 #include "runtime/command_stream/command_stream_receiver.h"
 #include "runtime/helpers/hardware_commands_helper.h"
 #include "runtime/helpers/task_information.h"
@@ -131,6 +132,19 @@ cl_int CommandQueueHw<GfxFamily>::enqueueKernel(
         return CL_INVALID_WORK_GROUP_SIZE;
     }
 
+    if (captureSequence) {
+        if (numEventsInWaitList > 0 || event) {
+            return CL_INVALID_OPERATION;
+        }
+        RegisteredMethodDispatcher<DispatchInfo::DispatchCommandMethodT> dependencyBarrier;
+        if (!isOOQEnabled()) {
+            // replay submits all recorded walkers as one task, in-order semantics need a stall between them
+            dependencyBarrier.registerMethod(dispatchRecordedKernelsBarrier);
+            dependencyBarrier.registerCommandsSizeEstimationMethod(PipeControlHelper<GfxFamily>::getSizeForSinglePipeControl);
+        }
+        return captureSequence->recordKernel(kernel, workDim, globalWorkOffset, region, localWkgSizeToPass, enqueuedLocalWorkSize, dependencyBarrier);
+    }
+
     enqueueHandler<CL_COMMAND_NDRANGE_KERNEL>(
         surfaces,
         false,
@@ -146,4 +160,29 @@ cl_int CommandQueueHw<GfxFamily>::enqueueKernel(
 
     return CL_SUCCESS;
 }
+
+template <typename GfxFamily>
+cl_int CommandQueueHw<GfxFamily>::enqueueRecordedSequence(
+    const RecordedDispatchSequence &sequence,
+    cl_uint numEventsInWaitList,
+    const cl_event *eventWaitList,
+    cl_event *event) {
+
+    if (captureSequence) {
+        return CL_INVALID_OPERATION;
+    }
+
+    NullSurface s;
+    Surface *surfaces[] = {&s};
+
+    enqueueHandler<CL_COMMAND_NDRANGE_KERNEL>(
+        surfaces,
+        false,
+        sequence.getMultiDispatchInfo(),
+        numEventsInWaitList,
+        eventWaitList,
+        event);
+
+    return CL_SUCCESS;
+}
 } // namespace NEO
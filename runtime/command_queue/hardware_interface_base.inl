@@ -37,7 +37,6 @@ void HardwareInterface<GfxFamily>::dispatchWalker(
     LinearStream *commandStream = nullptr;
     IndirectHeap *dsh = nullptr, *ioh = nullptr, *ssh = nullptr;
     auto parentKernel = multiDispatchInfo.peekParentKernel();
-    auto mainKernel = multiDispatchInfo.peekMainKernel();
     auto preemptionMode = PreemptionHelper::taskPreemptionMode(commandQueue.getDevice(), multiDispatchInfo);
 
     for (auto &dispatchInfo : multiDispatchInfo) {
@@ -83,7 +82,7 @@ void HardwareInterface<GfxFamily>::dispatchWalker(
     size_t currentDispatchIndex = 0;
     for (auto &dispatchInfo : multiDispatchInfo) {
         dispatchInfo.dispatchInitCommands(*commandStream);
-        bool isMainKernel = (dispatchInfo.getKernel() == mainKernel);
+        bool isMainKernel = multiDispatchInfo.isMainKernel(dispatchInfo.getKernel());
 
         dispatchKernelCommands(commandQueue, dispatchInfo, commandType, *commandStream, isMainKernel,
                                currentDispatchIndex, currentTimestampPacketNodes, preemptionMode, interfaceDescriptorIndex,
@@ -92,13 +91,13 @@ void HardwareInterface<GfxFamily>::dispatchWalker(
         currentDispatchIndex++;
         dispatchInfo.dispatchEpilogueCommands(*commandStream);
     }
-    if (mainKernel->requiresCacheFlushCommand(commandQueue)) {
+    if (auto cacheFlushKernel = multiDispatchInfo.peekKernelRequiringCacheFlush(commandQueue)) {
         uint64_t postSyncAddress = 0;
         if (commandQueue.getGpgpuCommandStreamReceiver().peekTimestampPacketWriteEnabled()) {
             auto timestampPacketNodeForPostSync = currentTimestampPacketNodes->peekNodes().at(currentDispatchIndex);
             postSyncAddress = timestampPacketNodeForPostSync->getGpuAddress() + offsetof(TimestampPacketStorage, packets[0].contextEnd);
         }
-        HardwareCommandsHelper<GfxFamily>::programCacheFlushAfterWalkerCommand(commandStream, commandQueue, mainKernel, postSyncAddress);
+        HardwareCommandsHelper<GfxFamily>::programCacheFlushAfterWalkerCommand(commandStream, commandQueue, cacheFlushKernel, postSyncAddress);
     }
     dispatchProfilingPerfEndCommands(hwTimeStamps, hwPerfCounter, commandStream, commandQueue);
 }
@@ -140,35 +139,46 @@ void HardwareInterface<GfxFamily>::dispatchKernelCommands(CommandQueue &commandQ
     size_t globalWorkSizes[3] = {gws.x, gws.y, gws.z};
 
     // Patch our kernel constants
-    *kernel.globalWorkOffsetX = static_cast<uint32_t>(offset.x);
-    *kernel.globalWorkOffsetY = static_cast<uint32_t>(offset.y);
-    *kernel.globalWorkOffsetZ = static_cast<uint32_t>(offset.z);
-
-    *kernel.globalWorkSizeX = static_cast<uint32_t>(gws.x);
-    *kernel.globalWorkSizeY = static_cast<uint32_t>(gws.y);
-    *kernel.globalWorkSizeZ = static_cast<uint32_t>(gws.z);
-
-    if (isMainKernel || (kernel.localWorkSizeX2 == &Kernel::dummyPatchLocation)) {
-        *kernel.localWorkSizeX = static_cast<uint32_t>(lws.x);
-        *kernel.localWorkSizeY = static_cast<uint32_t>(lws.y);
-        *kernel.localWorkSizeZ = static_cast<uint32_t>(lws.z);
-    }
+    if (auto implicitArgsPatchProgram = kernel.getImplicitArgsPatchProgram()) {
+        const uint32_t implicitArgs[ImplicitArgsPatchProgram::NumSources] = {
+            static_cast<uint32_t>(offset.x), static_cast<uint32_t>(offset.y), static_cast<uint32_t>(offset.z),
+            static_cast<uint32_t>(gws.x), static_cast<uint32_t>(gws.y), static_cast<uint32_t>(gws.z),
+            static_cast<uint32_t>(lws.x), static_cast<uint32_t>(lws.y), static_cast<uint32_t>(lws.z),
+            static_cast<uint32_t>(elws.x), static_cast<uint32_t>(elws.y), static_cast<uint32_t>(elws.z),
+            static_cast<uint32_t>(totalNumberOfWorkgroups.x), static_cast<uint32_t>(totalNumberOfWorkgroups.y), static_cast<uint32_t>(totalNumberOfWorkgroups.z),
+            dim};
+        implicitArgsPatchProgram->apply(kernel.getCrossThreadData(), kernel.getCrossThreadDataSize(), implicitArgs, isMainKernel);
+    } else {
+        *kernel.globalWorkOffsetX = static_cast<uint32_t>(offset.x);
+        *kernel.globalWorkOffsetY = static_cast<uint32_t>(offset.y);
+        *kernel.globalWorkOffsetZ = static_cast<uint32_t>(offset.z);
+
+        *kernel.globalWorkSizeX = static_cast<uint32_t>(gws.x);
+        *kernel.globalWorkSizeY = static_cast<uint32_t>(gws.y);
+        *kernel.globalWorkSizeZ = static_cast<uint32_t>(gws.z);
+
+        if (isMainKernel || (kernel.localWorkSizeX2 == &Kernel::dummyPatchLocation)) {
+            *kernel.localWorkSizeX = static_cast<uint32_t>(lws.x);
+            *kernel.localWorkSizeY = static_cast<uint32_t>(lws.y);
+            *kernel.localWorkSizeZ = static_cast<uint32_t>(lws.z);
+        }
 
-    *kernel.localWorkSizeX2 = static_cast<uint32_t>(lws.x);
-    *kernel.localWorkSizeY2 = static_cast<uint32_t>(lws.y);
-    *kernel.localWorkSizeZ2 = static_cast<uint32_t>(lws.z);
+        *kernel.localWorkSizeX2 = static_cast<uint32_t>(lws.x);
+        *kernel.localWorkSizeY2 = static_cast<uint32_t>(lws.y);
+        *kernel.localWorkSizeZ2 = static_cast<uint32_t>(lws.z);
 
-    *kernel.enqueuedLocalWorkSizeX = static_cast<uint32_t>(elws.x);
-    *kernel.enqueuedLocalWorkSizeY = static_cast<uint32_t>(elws.y);
-    *kernel.enqueuedLocalWorkSizeZ = static_cast<uint32_t>(elws.z);
+        *kernel.enqueuedLocalWorkSizeX = static_cast<uint32_t>(elws.x);
+        *kernel.enqueuedLocalWorkSizeY = static_cast<uint32_t>(elws.y);
+        *kernel.enqueuedLocalWorkSizeZ = static_cast<uint32_t>(elws.z);
 
-    if (isMainKernel) {
-        *kernel.numWorkGroupsX = static_cast<uint32_t>(totalNumberOfWorkgroups.x);
-        *kernel.numWorkGroupsY = static_cast<uint32_t>(totalNumberOfWorkgroups.y);
-        *kernel.numWorkGroupsZ = static_cast<uint32_t>(totalNumberOfWorkgroups.z);
-    }
+        if (isMainKernel) {
+            *kernel.numWorkGroupsX = static_cast<uint32_t>(totalNumberOfWorkgroups.x);
+            *kernel.numWorkGroupsY = static_cast<uint32_t>(totalNumberOfWorkgroups.y);
+            *kernel.numWorkGroupsZ = static_cast<uint32_t>(totalNumberOfWorkgroups.z);
+        }
 
-    *kernel.workDim = dim;
+        *kernel.workDim = dim;
+    }
 
     // Send our indirect object data
     size_t localWorkSizes[3] = {lws.x, lws.y, lws.z};
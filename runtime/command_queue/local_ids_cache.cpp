@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_queue/local_ids_cache.h"
+
+#include "core/helpers/aligned_memory.h"
+#include "core/helpers/debug_helpers.h"
+#include "core/helpers/string.h"
+#include "runtime/command_queue/local_id_gen.h"
+
+#include <functional>
+#include <mutex>
+
+namespace NEO {
+
+size_t LocalIdsCache::KeyHash::operator()(const Key &key) const {
+    uint64_t packedKey = static_cast<uint64_t>(key.localWorkSize[0]) |
+                         static_cast<uint64_t>(key.localWorkSize[1]) << 16 |
+                         static_cast<uint64_t>(key.localWorkSize[2]) << 32 |
+                         static_cast<uint64_t>(key.simd) << 48;
+    uint64_t packedLayout = static_cast<uint64_t>(key.walkOrder[0]) |
+                            static_cast<uint64_t>(key.walkOrder[1]) << 2 |
+                            static_cast<uint64_t>(key.walkOrder[2]) << 4 |
+                            static_cast<uint64_t>(key.isImageOnlyKernel) << 6;
+    return std::hash<uint64_t>()(packedKey ^ (packedLayout << 57) ^ (packedLayout >> 7));
+}
+
+LocalIdsCache::LocalIdsCache(size_t maxEntries) : maxEntries(maxEntries) {
+    UNRECOVERABLE_IF(maxEntries == 0u);
+    index.reserve(maxEntries);
+}
+
+void LocalIdsCache::setLocalIds(void *destination, size_t size, uint16_t simd, const std::array<uint16_t, 3> &localWorkSize,
+                                const std::array<uint8_t, 3> &walkOrder, bool isImageOnlyKernel) {
+    auto localIdsSize = getThreadsPerWG(simd, localWorkSize[0] * localWorkSize[1] * localWorkSize[2]) * getPerThreadSizeLocalIDs(simd);
+    if (size != localIdsSize) {
+        generateLocalIDs(destination, simd, localWorkSize, walkOrder, isImageOnlyKernel);
+        return;
+    }
+
+    Key key = {localWorkSize, walkOrder, simd, isImageOnlyKernel};
+    auto localIds = findAndTouch(key);
+    if (!localIds) {
+        // generator uses aligned vector stores
+        localIds = allocateAlignedMemory(localIdsSize, 32);
+        // lanes unused by SIMD8 are not written by the generator
+        memset(localIds.get(), 0, localIdsSize);
+        generateLocalIDs(localIds.get(), simd, localWorkSize, walkOrder, isImageOnlyKernel);
+        localIds = insert(key, localIdsSize, std::move(localIds));
+    }
+
+    memcpy_s(destination, size, localIds.get(), localIdsSize);
+}
+
+std::shared_ptr<void> LocalIdsCache::findAndTouch(const Key &key) {
+    std::lock_guard<SpinLock> guard(lock);
+    auto entry = index.find(key);
+    if (entry == index.end()) {
+        misses++;
+        return nullptr;
+    }
+    hits++;
+    entries.splice(entries.begin(), entries, entry->second);
+    return entry->second->localIds;
+}
+
+std::shared_ptr<void> LocalIdsCache::insert(const Key &key, size_t localIdsSize, std::shared_ptr<void> localIds) {
+    std::lock_guard<SpinLock> guard(lock);
+    auto entry = index.find(key);
+    if (entry != index.end()) {
+        // another thread inserted the same local IDs in the meantime
+        entries.splice(entries.begin(), entries, entry->second);
+        return entry->second->localIds;
+    }
+    if (index.size() == maxEntries) {
+        index.erase(entries.back().key);
+        entries.pop_back();
+    }
+    entries.push_front({key, localIdsSize, localIds});
+    index.emplace(key, entries.begin());
+    return localIds;
+}
+} // namespace NEO
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "core/utilities/spinlock.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+namespace NEO {
+
+// Bounded cache of generated local IDs, shared by all queues of a device.
+// Least recently used entry is replaced when the cache is full. Cached local IDs are immutable and
+// shared, so the lock is held only for the lookup and both generation and copy run outside of it.
+class LocalIdsCache {
+  public:
+    static constexpr size_t defaultMaxEntries = 64u;
+
+    struct Key {
+        std::array<uint16_t, 3> localWorkSize;
+        std::array<uint8_t, 3> walkOrder;
+        uint16_t simd;
+        bool isImageOnlyKernel;
+
+        bool operator==(const Key &other) const {
+            return localWorkSize == other.localWorkSize && walkOrder == other.walkOrder &&
+                   simd == other.simd && isImageOnlyKernel == other.isImageOnlyKernel;
+        }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key &key) const;
+    };
+
+    LocalIdsCache(size_t maxEntries);
+
+    // Writes local IDs to destination, generating them only on cache miss.
+    // Sizes other than the one of generated local IDs bypass the cache.
+    void setLocalIds(void *destination, size_t size, uint16_t simd, const std::array<uint16_t, 3> &localWorkSize,
+                     const std::array<uint8_t, 3> &walkOrder, bool isImageOnlyKernel);
+
+    size_t getNumEntries() const { return index.size(); }
+    size_t getMaxEntries() const { return maxEntries; }
+    uint64_t getHits() const { return hits; }
+    uint64_t getMisses() const { return misses; }
+
+  protected:
+    struct Entry {
+        Key key = {};
+        size_t localIdsSize = 0u;
+        std::shared_ptr<void> localIds;
+    };
+    using EntriesList = std::list<Entry>;
+
+    std::shared_ptr<void> findAndTouch(const Key &key);
+    std::shared_ptr<void> insert(const Key &key, size_t localIdsSize, std::shared_ptr<void> localIds);
+
+    const size_t maxEntries;
+    // most recently used entry first
+    EntriesList entries;
+    std::unordered_map<Key, EntriesList::iterator, KeyHash> index;
+    uint64_t hits = 0u;
+    uint64_t misses = 0u;
+    SpinLock lock;
+};
+} // namespace NEO
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_queue/recorded_dispatch_sequence.h"
+
+#include "runtime/helpers/dispatch_info_builder.h"
+#include "runtime/kernel/kernel.h"
+
+namespace NEO {
+
+RecordedDispatchSequence::~RecordedDispatchSequence() {
+    for (auto kernel : recordedKernels) {
+        kernel->release();
+    }
+}
+
+bool RecordedDispatchSequence::isKernelSupported(const Kernel &kernel) {
+    // kernels needing per-enqueue preparation in enqueueHandler cannot be replayed as a part of a sequence
+    return kernel.getKernelInfo().builtinDispatchBuilder == nullptr &&
+           !kernel.isParentKernel &&
+           !kernel.isAuxTranslationRequired() &&
+           !kernel.isUsingSharedObjArgs() &&
+           !kernel.hasPrintfOutput();
+}
+
+cl_int RecordedDispatchSequence::recordKernel(Kernel &kernel,
+                                              cl_uint workDim,
+                                              const size_t globalOffsets[3],
+                                              const size_t workItems[3],
+                                              const size_t *localWorkSizesIn,
+                                              const size_t *enqueuedWorkSizes,
+                                              const RegisteredMethodDispatcher<DispatchInfo::DispatchCommandMethodT> &dependencyBarrier) {
+    if (!isKernelSupported(kernel)) {
+        return CL_INVALID_KERNEL;
+    }
+
+    auto recordedKernel = cloneKernel(kernel);
+    if (recordedKernel == nullptr) {
+        return CL_OUT_OF_HOST_MEMORY;
+    }
+    recordedKernels.push_back(recordedKernel);
+
+    DispatchInfoBuilder<SplitDispatch::Dim::d3D, SplitDispatch::SplitMode::WalkerSplit> builder;
+    builder.setDispatchGeometry(workDim, workItems, enqueuedWorkSizes, globalOffsets, Vec3<size_t>{0, 0, 0}, localWorkSizesIn);
+    builder.setKernel(recordedKernel);
+
+    auto firstDispatchIndex = multiDispatchInfo.size();
+    builder.bake(multiDispatchInfo);
+    if (firstDispatchIndex > 0 && firstDispatchIndex < multiDispatchInfo.size()) {
+        multiDispatchInfo.begin()[firstDispatchIndex].dispatchInitCommands = dependencyBarrier;
+    }
+
+    return CL_SUCCESS;
+}
+
+cl_int RecordedDispatchSequence::setKernelArg(size_t slot, uint32_t argIndex, size_t argSize, const void *argValue) {
+    auto kernel = getRecordedKernel(slot);
+    if (kernel == nullptr) {
+        return CL_INVALID_VALUE;
+    }
+    return kernel->setArg(argIndex, argSize, argValue);
+}
+
+Kernel *RecordedDispatchSequence::getRecordedKernel(size_t slot) const {
+    return slot < recordedKernels.size() ? recordedKernels[slot] : nullptr;
+}
+
+Kernel *RecordedDispatchSequence::cloneKernel(Kernel &kernel) {
+    cl_int retVal = CL_SUCCESS;
+    auto clonedKernel = Kernel::create(kernel.getProgram(), kernel.getKernelInfo(), &retVal);
+    if (clonedKernel == nullptr) {
+        return nullptr;
+    }
+    if (clonedKernel->cloneKernel(&kernel) != CL_SUCCESS) {
+        clonedKernel->release();
+        return nullptr;
+    }
+    return clonedKernel;
+}
+} // namespace NEO
@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "core/helpers/non_copyable_or_moveable.h"
+#include "runtime/api/cl_types.h"
+#include "runtime/helpers/dispatch_info.h"
+
+#include <vector>
+
+namespace NEO {
+class Kernel;
+
+// Kernel enqueues captured on a command queue, replayed later as a single task.
+// Every recorded enqueue owns a clone of its kernel, so arguments of one slot can be
+// changed between replays without affecting other slots or the original kernel.
+class RecordedDispatchSequence : NonCopyableOrMovableClass {
+  public:
+    RecordedDispatchSequence() {
+        multiDispatchInfo.setIndependentKernels(true);
+    }
+    MOCKABLE_VIRTUAL ~RecordedDispatchSequence();
+
+    // dependencyBarrier is programmed before the walkers of this kernel when a previous kernel was recorded
+    cl_int recordKernel(Kernel &kernel,
+                        cl_uint workDim,
+                        const size_t globalOffsets[3],
+                        const size_t workItems[3],
+                        const size_t *localWorkSizesIn,
+                        const size_t *enqueuedWorkSizes,
+                        const RegisteredMethodDispatcher<DispatchInfo::DispatchCommandMethodT> &dependencyBarrier);
+
+    cl_int setKernelArg(size_t slot, uint32_t argIndex, size_t argSize, const void *argValue);
+
+    Kernel *getRecordedKernel(size_t slot) const;
+    size_t getNumSlots() const { return recordedKernels.size(); }
+    const MultiDispatchInfo &getMultiDispatchInfo() const { return multiDispatchInfo; }
+
+    static bool isKernelSupported(const Kernel &kernel);
+
+  protected:
+    MOCKABLE_VIRTUAL Kernel *cloneKernel(Kernel &kernel);
+
+    MultiDispatchInfo multiDispatchInfo;
+    std::vector<Kernel *> recordedKernels;
+};
+} // namespace NEO
@@ -8,6 +8,7 @@
 #include "runtime/command_stream/aub_command_stream_receiver.h"
 
 #include "core/helpers/debug_helpers.h"
+#include "core/memory_manager/memory_constants.h"
 #include "runtime/execution_environment/execution_environment.h"
 #include "runtime/helpers/hw_info.h"
 #include "runtime/helpers/options.h"
@@ -74,18 +75,32 @@ extern const size_t g_dwordCountMax;
 void AubFileStream::open(const char *filePath) {
     fileHandle.open(filePath, std::ofstream::binary);
     fileName.assign(filePath);
+
+    auto asyncWriteBufferSize = NEO::DebugManager.flags.AUBDumpAsyncWriteBufferSize.get();
+    if (asyncWriteBufferSize > 0 && fileHandle.is_open()) {
+        fileWriter = std::make_unique<AubFileWriter>(fileHandle, static_cast<size_t>(asyncWriteBufferSize) * MemoryConstants::kiloByte);
+    }
 }
 
 void AubFileStream::close() {
+    fileWriter.reset();
     fileHandle.close();
     fileName.clear();
 }
 
 void AubFileStream::write(const char *data, size_t size) {
+    if (fileWriter) {
+        fileWriter->write(data, size);
+        return;
+    }
     fileHandle.write(data, size);
 }
 
 void AubFileStream::flush() {
+    if (fileWriter) {
+        fileWriter->submit();
+        return;
+    }
     fileHandle.flush();
 }
 
@@ -76,6 +76,10 @@ AUBCommandStreamReceiverHw<GfxFamily>::AUBCommandStreamReceiverHw(const std::str
         this->dispatchMode = (DispatchMode)DebugManager.flags.CsrDispatchMode.get();
     }
 
+    if (DebugManager.flags.EnableAubDirtyPageTracking.get()) {
+        this->dirtyPageTracker = std::make_unique<DirtyPageTracker>();
+    }
+
     auto debugDeviceId = DebugManager.flags.OverrideAubDeviceId.get();
     this->aubDeviceId = debugDeviceId == -1
                             ? this->peekHwInfo().capabilityTable.aubDeviceId
@@ -641,7 +645,7 @@ bool AUBCommandStreamReceiverHw<GfxFamily>::writeMemory(GraphicsAllocation &gfxA
     if (aubManager) {
         this->writeMemoryWithAubManager(gfxAllocation);
     } else {
-        writeMemory(gpuAddress, cpuAddress, size, this->getMemoryBank(&gfxAllocation), this->getPPGTTAdditionalBits(&gfxAllocation));
+        this->writeDirtyMemory(gfxAllocation, gpuAddress, cpuAddress, size);
     }
 
     streamLocked.unlock();
@@ -724,6 +728,7 @@ void AUBCommandStreamReceiverHw<GfxFamily>::processResidency(const ResidencyCont
     }
 
     dumpAubNonWritable = false;
+    this->reportDirtyPageStatistics();
 }
 
 template <typename GfxFamily>
@@ -770,6 +775,9 @@ AubSubCaptureStatus AUBCommandStreamReceiverHw<GfxFamily>::checkAndActivateAubSu
         auto isReopened = reopenFile(subCaptureFile);
         if (isReopened) {
             dumpAubNonWritable = true;
+            if (this->dirtyPageTracker) {
+                this->dirtyPageTracker->reset();
+            }
         }
     }
     if (this->standalone) {
@@ -43,6 +43,12 @@ CommandStreamReceiver::CommandStreamReceiver(ExecutionEnvironment &executionEnvi
     if (DebugManager.flags.CsrDispatchMode.get()) {
         this->dispatchMode = (DispatchMode)DebugManager.flags.CsrDispatchMode.get();
     }
+    if (DebugManager.flags.BatchedDispatchFlushCount.get() > 0) {
+        this->batchedDispatchFlushCount = static_cast<uint32_t>(DebugManager.flags.BatchedDispatchFlushCount.get());
+    }
+    if (DebugManager.flags.BatchedDispatchFlushTimeoutMicroseconds.get() > 0) {
+        this->batchedDispatchFlushTimeoutMicroseconds = DebugManager.flags.BatchedDispatchFlushTimeoutMicroseconds.get();
+    }
     flushStamp.reset(new FlushStampTracker(true));
     for (int i = 0; i < IndirectHeap::NUM_TYPES; ++i) {
         indirectHeap[i] = nullptr;
@@ -68,15 +74,26 @@ CommandStreamReceiver::~CommandStreamReceiver() {
 }
 
 void CommandStreamReceiver::makeResident(GraphicsAllocation &gfxAllocation) {
-    auto submissionTaskCount = this->taskCount + 1;
-    if (gfxAllocation.isResidencyTaskCountBelow(submissionTaskCount, osContext->getContextId())) {
-        this->getResidencyAllocations().push_back(&gfxAllocation);
-        gfxAllocation.updateTaskCount(submissionTaskCount, osContext->getContextId());
-        if (!gfxAllocation.isResident(osContext->getContextId())) {
+    makeResidentForSubmission(gfxAllocation, this->taskCount + 1, osContext->getContextId());
+}
+
+void CommandStreamReceiver::makeResidentForSubmission(GraphicsAllocation &gfxAllocation, uint32_t submissionTaskCount, uint32_t contextId) {
+    if (gfxAllocation.isResidencyTaskCountBelow(submissionTaskCount, contextId)) {
+        this->residencyAllocations.push_back(&gfxAllocation);
+        gfxAllocation.updateTaskCount(submissionTaskCount, contextId);
+        if (!gfxAllocation.isResident(contextId)) {
             this->totalMemoryUsed += gfxAllocation.getUnderlyingBufferSize();
         }
     }
-    gfxAllocation.updateResidencyTaskCount(submissionTaskCount, osContext->getContextId());
+    gfxAllocation.updateResidencyTaskCount(submissionTaskCount, contextId);
+}
+
+void CommandStreamReceiver::makeAllocationsResident(ArrayRef<GraphicsAllocation *const> gfxAllocations) {
+    auto submissionTaskCount = this->taskCount + 1;
+    auto contextId = osContext->getContextId();
+    for (auto gfxAllocation : gfxAllocations) {
+        makeResidentForSubmission(*gfxAllocation, submissionTaskCount, contextId);
+    }
 }
 
 void CommandStreamReceiver::processEviction() {
@@ -95,6 +112,21 @@ void CommandStreamReceiver::makeNonResident(GraphicsAllocation &gfxAllocation) {
     gfxAllocation.releaseResidencyInOsContext(this->osContext->getContextId());
 }
 
+bool CommandStreamReceiver::isBatchedDispatchFlushThresholdReached() const {
+    auto pendingCommandBuffersCount = submissionAggregator->peekPendingCommandBuffersCount();
+    if (pendingCommandBuffersCount == 0) {
+        return false;
+    }
+    if (pendingCommandBuffersCount >= batchedDispatchFlushCount) {
+        return true;
+    }
+    if (batchedDispatchFlushTimeoutMicroseconds > 0) {
+        auto pendingTime = std::chrono::steady_clock::now() - submissionAggregator->peekOldestPendingCommandBufferTime();
+        return pendingTime >= std::chrono::microseconds(batchedDispatchFlushTimeoutMicroseconds);
+    }
+    return false;
+}
+
 void CommandStreamReceiver::makeSurfacePackNonResident(ResidencyContainer &allocationsForResidency) {
     for (auto &surface : allocationsForResidency) {
         this->makeNonResident(*surface);
@@ -191,12 +223,16 @@ bool CommandStreamReceiver::waitForCompletionWithTimeout(bool enableTimeout, int
         this->flushBatchedSubmissions();
     }
 
+    // reading the clock costs more than a poll of the tag, adaptive wait checks the timeout every few iterations
+    const uint32_t timeoutCheckInterval = DebugManager.flags.EnableAdaptiveWait.get() ? 8u : 1u;
+    uint32_t iterations = 0u;
+
     time1 = std::chrono::high_resolution_clock::now();
     while (*getTagAddress() < taskCountToWait && timeDiff <= timeoutMicroseconds) {
         std::this_thread::yield();
         _mm_pause();
 
-        if (enableTimeout) {
+        if (enableTimeout && (++iterations % timeoutCheckInterval) == 0u) {
             time2 = std::chrono::high_resolution_clock::now();
             timeDiff = std::chrono::duration_cast<std::chrono::microseconds>(time2 - time1).count();
         }
@@ -387,7 +423,7 @@ std::unique_lock<CommandStreamReceiver::MutexType> CommandStreamReceiver::obtain
     return std::unique_lock<CommandStreamReceiver::MutexType>(this->ownershipMutex);
 }
 AllocationsList &CommandStreamReceiver::getTemporaryAllocations() { return internalAllocationStorage->getTemporaryAllocations(); }
-AllocationsList &CommandStreamReceiver::getAllocationsForReuse() { return internalAllocationStorage->getAllocationsForReuse(); }
+ReusableAllocationsList &CommandStreamReceiver::getAllocationsForReuse() { return internalAllocationStorage->getAllocationsForReuse(); }
 
 bool CommandStreamReceiver::createAllocationForHostSurface(HostPtrSurface &surface, bool requiresL3Flush) {
     auto memoryManager = getMemoryManager();
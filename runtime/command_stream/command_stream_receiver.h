@@ -8,6 +8,7 @@
 #pragma once
 #include "core/command_stream/linear_stream.h"
 #include "core/helpers/aligned_memory.h"
+#include "core/utilities/arrayref.h"
 #include "runtime/command_stream/aub_subcapture.h"
 #include "runtime/command_stream/csr_definitions.h"
 #include "runtime/command_stream/submissions_aggregator.h"
@@ -38,6 +39,7 @@ class LinearStream;
 class MemoryManager;
 class OsContext;
 class OSInterface;
+class ReusableAllocationsList;
 class ScratchSpaceController;
 struct HwPerfCounter;
 struct HwTimeStamps;
@@ -50,7 +52,7 @@ enum class DispatchMode {
     DeviceDefault = 0,          //default for given device
     ImmediateDispatch,          //everything is submitted to the HW immediately
     AdaptiveDispatch,           //dispatching is handled to async thread, which combines batch buffers basing on load (not implemented)
-    BatchedDispatchWithCounter, //dispatching is batched, after n commands there is implicit flush (not implemented)
+    BatchedDispatchWithCounter, //dispatching is batched, after n commands or when the oldest one is pending too long there is implicit flush
     BatchedDispatch             // dispatching is batched, explicit clFlush is required
 };
 
@@ -74,10 +76,12 @@ class CommandStreamReceiver {
     virtual void flushBatchedSubmissions() = 0;
 
     virtual void makeResident(GraphicsAllocation &gfxAllocation);
+    virtual void makeAllocationsResident(ArrayRef<GraphicsAllocation *const> gfxAllocations);
     virtual void makeNonResident(GraphicsAllocation &gfxAllocation);
     MOCKABLE_VIRTUAL void makeSurfacePackNonResident(ResidencyContainer &allocationsForResidency);
     virtual void processResidency(const ResidencyContainer &allocationsForResidency) {}
     virtual void processEviction();
+    virtual void onAllocationFreed(GraphicsAllocation &gfxAllocation) {}
     void makeResidentHostPtrAllocation(GraphicsAllocation *gfxAllocation);
 
     void ensureCommandBufferAllocation(LinearStream &commandStream, size_t minimumRequiredSize, size_t additionalAllocationSize);
@@ -115,6 +119,8 @@ class CommandStreamReceiver {
     void enableNTo1SubmissionModel() { this->nTo1SubmissionModelEnabled = true; }
     bool isNTo1SubmissionModelEnabled() const { return this->nTo1SubmissionModelEnabled; }
     void overrideDispatchPolicy(DispatchMode overrideValue) { this->dispatchMode = overrideValue; }
+    bool isBatchedDispatchFlushThresholdReached() const;
+    uint64_t peekSubmissionsSavedByBatching() const { return submissionAggregator->peekCoalescedCommandBuffersCount(); }
 
     void setMediaVFEStateDirty(bool dirty) { mediaVfeStateDirty = dirty; }
 
@@ -157,7 +163,7 @@ class CommandStreamReceiver {
     size_t defaultSshSize;
 
     AllocationsList &getTemporaryAllocations();
-    AllocationsList &getAllocationsForReuse();
+    ReusableAllocationsList &getAllocationsForReuse();
     InternalAllocationStorage *getInternalAllocationStorage() const { return internalAllocationStorage.get(); }
     MOCKABLE_VIRTUAL bool createAllocationForHostSurface(HostPtrSurface &surface, bool requiresL3Flush);
     virtual size_t getPreferredTagPoolSize() const { return 512; }
@@ -191,6 +197,7 @@ class CommandStreamReceiver {
 
   protected:
     void cleanupResources();
+    void makeResidentForSubmission(GraphicsAllocation &gfxAllocation, uint32_t submissionTaskCount, uint32_t contextId);
     MOCKABLE_VIRTUAL uint32_t getDeviceIndex() const;
 
     std::unique_ptr<FlushStampTracker> flushStamp;
@@ -231,6 +238,7 @@ class CommandStreamReceiver {
     SamplerCacheFlushState samplerCacheFlushRequired = SamplerCacheFlushState::samplerCacheFlushNotRequired;
     PreemptionMode lastPreemptionMode = PreemptionMode::Initial;
     uint64_t totalMemoryUsed = 0u;
+    int64_t batchedDispatchFlushTimeoutMicroseconds = 0;
 
     // taskCount - # of tasks submitted
     uint32_t taskCount = 0;
@@ -241,6 +249,8 @@ class CommandStreamReceiver {
     uint32_t lastSentThreadArbitrationPolicy = ThreadArbitrationPolicy::NotPresent;
     uint64_t lastSentSliceCount = QueueSliceCount::defaultSliceCount;
 
+    uint32_t batchedDispatchFlushCount = 16u;
+
     uint32_t requiredScratchSize = 0;
     uint32_t requiredPrivateScratchSize = 0;
 
@@ -101,11 +101,25 @@ class CommandStreamReceiverHw : public CommandStreamReceiver {
 
     bool detectInitProgrammingFlagsRequired(const DispatchFlags &dispatchFlags) const;
 
+    uint32_t getL3ConfigForDispatch(bool useSLM);
+    uint32_t getMocsIndexForDispatch(Device &device, uint32_t l3CacheSettings);
+
     HeapDirtyState dshState;
     HeapDirtyState iohState;
     HeapDirtyState sshState;
 
     CsrSizeRequestFlags csrSizeRequestFlags = {};
+
+    // L3 config and MOCS index are constant per device, they are not queried again on every flush
+    struct StateInputsCache {
+        static constexpr uint32_t l3CachingSettingsCount = L3CachingSettings::l3AndL1On + 1;
+
+        const Device *device = nullptr;
+        uint32_t l3Config[2] = {};
+        uint32_t mocsIndex[l3CachingSettingsCount] = {};
+        bool l3ConfigValid[2] = {};
+        bool mocsIndexValid[l3CachingSettingsCount] = {};
+    } stateInputsCache;
 };
 
 } // namespace NEO
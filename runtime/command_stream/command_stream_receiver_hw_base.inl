@@ -210,7 +210,7 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
         requestThreadArbitrationPolicy(static_cast<uint32_t>(DebugManager.flags.OverrideThreadArbitrationPolicy.get()));
     }
 
-    auto newL3Config = PreambleHelper<GfxFamily>::getL3Config(peekHwInfo(), dispatchFlags.useSLM);
+    auto newL3Config = getL3ConfigForDispatch(dispatchFlags.useSLM);
 
     csrSizeRequestFlags.l3ConfigChanged = this->lastSentL3Config != newL3Config;
     csrSizeRequestFlags.coherencyRequestChanged = this->lastSentCoherencyRequest != static_cast<int8_t>(dispatchFlags.requiresCoherency);
@@ -281,10 +281,7 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
 
     auto isStateBaseAddressDirty = dshDirty || iohDirty || sshDirty || stateBaseAddressDirty;
 
-    auto &hwHelper = HwHelper::get(peekHwInfo().platform.eRenderCoreFamily);
-    auto l3On = dispatchFlags.l3CacheSettings != L3CachingSettings::l3CacheOff;
-    auto l1On = dispatchFlags.l3CacheSettings == L3CachingSettings::l3AndL1On;
-    auto mocsIndex = hwHelper.getMocsIndex(*device.getGmmHelper(), l3On, l1On);
+    auto mocsIndex = getMocsIndexForDispatch(device, dispatchFlags.l3CacheSettings);
 
     if (mocsIndex != latestSentStatelessMocsConfig) {
         isStateBaseAddressDirty = true;
@@ -474,7 +471,12 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
         }
     }
 
-    if (this->dispatchMode == DispatchMode::BatchedDispatch && (dispatchFlags.blocking || dispatchFlags.implicitFlush)) {
+    if (this->dispatchMode == DispatchMode::BatchedDispatchWithCounter && isBatchedDispatchFlushThresholdReached()) {
+        dispatchFlags.implicitFlush = true;
+    }
+
+    if ((this->dispatchMode == DispatchMode::BatchedDispatch || this->dispatchMode == DispatchMode::BatchedDispatchWithCounter) &&
+        (dispatchFlags.blocking || dispatchFlags.implicitFlush)) {
         this->flushBatchedSubmissions();
     }
 
@@ -496,6 +498,38 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     return completionStamp;
 }
 
+template <typename GfxFamily>
+uint32_t CommandStreamReceiverHw<GfxFamily>::getL3ConfigForDispatch(bool useSLM) {
+    auto index = useSLM ? 1u : 0u;
+    if (!stateInputsCache.l3ConfigValid[index]) {
+        stateInputsCache.l3Config[index] = PreambleHelper<GfxFamily>::getL3Config(peekHwInfo(), useSLM);
+        stateInputsCache.l3ConfigValid[index] = true;
+    }
+    return stateInputsCache.l3Config[index];
+}
+
+template <typename GfxFamily>
+uint32_t CommandStreamReceiverHw<GfxFamily>::getMocsIndexForDispatch(Device &device, uint32_t l3CacheSettings) {
+    bool useCache = l3CacheSettings < StateInputsCache::l3CachingSettingsCount;
+    if (useCache && stateInputsCache.device != &device) {
+        stateInputsCache = {};
+        stateInputsCache.device = &device;
+    }
+    if (useCache && stateInputsCache.mocsIndexValid[l3CacheSettings]) {
+        return stateInputsCache.mocsIndex[l3CacheSettings];
+    }
+
+    auto &hwHelper = HwHelper::get(peekHwInfo().platform.eRenderCoreFamily);
+    auto l3On = l3CacheSettings != L3CachingSettings::l3CacheOff;
+    auto l1On = l3CacheSettings == L3CachingSettings::l3AndL1On;
+    auto mocsIndex = hwHelper.getMocsIndex(*device.getGmmHelper(), l3On, l1On);
+    if (useCache) {
+        stateInputsCache.mocsIndex[l3CacheSettings] = mocsIndex;
+        stateInputsCache.mocsIndexValid[l3CacheSettings] = true;
+    }
+    return mocsIndex;
+}
+
 template <typename GfxFamily>
 inline void CommandStreamReceiverHw<GfxFamily>::programStallingPipeControlForBarrier(LinearStream &cmdStream, DispatchFlags &dispatchFlags) {
     stallingPipeControlOnNextFlushRequired = false;
@@ -683,14 +717,31 @@ inline void CommandStreamReceiverHw<GfxFamily>::waitForTaskCountWithKmdNotifyFal
     int64_t waitTimeout = 0;
     bool enableTimeout = kmdNotifyHelper->obtainTimeoutParams(waitTimeout, useQuickKmdSleep, *getTagAddress(), taskCountToWait, flushStampToWait, forcePowerSavingMode);
 
+    bool adaptiveWait = kmdNotifyHelper->isAdaptiveWaitEnabled();
+    std::chrono::high_resolution_clock::time_point waitStart, parkStart;
+    if (adaptiveWait) {
+        waitStart = std::chrono::high_resolution_clock::now();
+    }
+
     auto status = waitForCompletionWithTimeout(enableTimeout, waitTimeout, taskCountToWait);
     if (!status) {
+        if (adaptiveWait) {
+            parkStart = std::chrono::high_resolution_clock::now();
+        }
         waitForFlushStamp(flushStampToWait);
         //now call blocking wait, this is to ensure that task count is reached
         waitForCompletionWithTimeout(false, 0, taskCountToWait);
     }
     UNRECOVERABLE_IF(*getTagAddress() < taskCountToWait);
 
+    if (adaptiveWait) {
+        auto waitEnd = std::chrono::high_resolution_clock::now();
+        auto spinEnd = status ? waitEnd : parkStart;
+        auto spinLatency = std::chrono::duration_cast<std::chrono::microseconds>(spinEnd - waitStart).count();
+        auto wakeUpLatency = status ? 0 : std::chrono::duration_cast<std::chrono::microseconds>(waitEnd - parkStart).count();
+        kmdNotifyHelper->recordWaitCompletion(status, spinLatency, wakeUpLatency);
+    }
+
     if (kmdNotifyHelper->quickKmdSleepForSporadicWaitsEnabled()) {
         kmdNotifyHelper->updateLastWaitForCompletionTimestamp();
     }
@@ -6,6 +6,7 @@
  */
 
 #pragma once
+#include "runtime/aub/dirty_page_tracker.h"
 #include "runtime/command_stream/command_stream_receiver_hw.h"
 #include "runtime/gen_common/aub_mapper.h"
 #include "runtime/memory_manager/memory_banks.h"
@@ -53,6 +54,9 @@ class CommandStreamReceiverSimulatedCommonHw : public CommandStreamReceiverHw<Gf
     virtual bool writeMemory(GraphicsAllocation &gfxAllocation) = 0;
     virtual void writeMemory(uint64_t gpuAddress, void *cpuAddress, size_t size, uint32_t memoryBank, uint64_t entryBits) = 0;
     virtual void writeMemoryWithAubManager(GraphicsAllocation &graphicsAllocation) = 0;
+    void writeDirtyMemory(GraphicsAllocation &gfxAllocation, uint64_t gpuAddress, void *cpuAddress, size_t size);
+    void onAllocationFreed(GraphicsAllocation &gfxAllocation) override;
+    void reportDirtyPageStatistics();
 
     virtual void setAubWritable(bool writable, GraphicsAllocation &graphicsAllocation) = 0;
     virtual bool isAubWritable(GraphicsAllocation &graphicsAllocation) const = 0;
@@ -63,6 +67,7 @@ class CommandStreamReceiverSimulatedCommonHw : public CommandStreamReceiverHw<Gf
 
     aub_stream::AubManager *aubManager = nullptr;
     std::unique_ptr<HardwareContextController> hardwareContextController;
+    std::unique_ptr<DirtyPageTracker> dirtyPageTracker;
 
     struct EngineInfo {
         void *pLRCA;
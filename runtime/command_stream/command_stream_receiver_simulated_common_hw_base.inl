@@ -64,6 +64,42 @@ bool CommandStreamReceiverSimulatedCommonHw<GfxFamily>::getParametersForWriteMem
     return true;
 }
 
+template <typename GfxFamily>
+void CommandStreamReceiverSimulatedCommonHw<GfxFamily>::writeDirtyMemory(GraphicsAllocation &gfxAllocation, uint64_t gpuAddress, void *cpuAddress, size_t size) {
+    auto memoryBank = this->getMemoryBank(&gfxAllocation);
+    auto entryBits = this->getPPGTTAdditionalBits(&gfxAllocation);
+    if (!dirtyPageTracker) {
+        this->writeMemory(gpuAddress, cpuAddress, size, memoryBank, entryBits);
+        return;
+    }
+    if (!AubHelper::isGpuReadOnlyAllocationType(gfxAllocation.getAllocationType())) {
+        // kernels may change simulated contents after this write, it can't be compared against the host copy later
+        dirtyPageTracker->invalidate(gpuAddress, size);
+        this->writeMemory(gpuAddress, cpuAddress, size, memoryBank, entryBits);
+        return;
+    }
+    dirtyPageTracker->writeDirtyRanges(gpuAddress, cpuAddress, size, memoryBank, entryBits, [&](size_t offset, size_t rangeSize) {
+        this->writeMemory(gpuAddress + offset, ptrOffset(cpuAddress, offset), rangeSize, memoryBank, entryBits);
+    });
+}
+
+template <typename GfxFamily>
+void CommandStreamReceiverSimulatedCommonHw<GfxFamily>::onAllocationFreed(GraphicsAllocation &gfxAllocation) {
+    if (dirtyPageTracker) {
+        dirtyPageTracker->invalidate(GmmHelper::decanonize(gfxAllocation.getGpuAddress()), gfxAllocation.getUnderlyingBufferSize());
+    }
+}
+
+template <typename GfxFamily>
+void CommandStreamReceiverSimulatedCommonHw<GfxFamily>::reportDirtyPageStatistics() {
+    if (!dirtyPageTracker) {
+        return;
+    }
+    printDebugString(DebugManager.flags.PrintDebugMessages.get(), stdout, "Dirty page tracking: %zu bytes written, %zu bytes skipped\n",
+                     dirtyPageTracker->peekBytesWritten(), dirtyPageTracker->peekBytesSkipped());
+    dirtyPageTracker->resetStatistics();
+}
+
 template <typename GfxFamily>
 void CommandStreamReceiverSimulatedCommonHw<GfxFamily>::expectMemoryEqual(void *gfxAddress, const void *srcAddress, size_t length) {
     this->expectMemory(gfxAddress, srcAddress, length,
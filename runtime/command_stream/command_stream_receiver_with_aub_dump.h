@@ -25,6 +25,7 @@ class CommandStreamReceiverWithAUBDump : public BaseCSR {
 
     FlushStamp flush(BatchBuffer &batchBuffer, ResidencyContainer &allocationsForResidency) override;
     void makeNonResident(GraphicsAllocation &gfxAllocation) override;
+    void onAllocationFreed(GraphicsAllocation &gfxAllocation) override;
 
     AubSubCaptureStatus checkAndActivateAubSubCapture(const MultiDispatchInfo &dispatchInfo) override;
     void setupContext(OsContext &osContext) override;
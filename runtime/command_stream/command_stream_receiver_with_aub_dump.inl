@@ -45,6 +45,14 @@ void CommandStreamReceiverWithAUBDump<BaseCSR>::makeNonResident(GraphicsAllocati
     }
 }
 
+template <typename BaseCSR>
+void CommandStreamReceiverWithAUBDump<BaseCSR>::onAllocationFreed(GraphicsAllocation &gfxAllocation) {
+    BaseCSR::onAllocationFreed(gfxAllocation);
+    if (aubCSR) {
+        aubCSR->onAllocationFreed(gfxAllocation);
+    }
+}
+
 template <typename BaseCSR>
 AubSubCaptureStatus CommandStreamReceiverWithAUBDump<BaseCSR>::checkAndActivateAubSubCapture(const MultiDispatchInfo &dispatchInfo) {
     auto status = BaseCSR::checkAndActivateAubSubCapture(dispatchInfo);
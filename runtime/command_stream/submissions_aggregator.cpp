@@ -10,10 +10,23 @@
 #include "core/memory_manager/graphics_allocation.h"
 #include "runtime/helpers/flush_stamp.h"
 
+#include <algorithm>
+
 void NEO::SubmissionAggregator::recordCommandBuffer(CommandBuffer *commandBuffer) {
+    if (this->pendingCommandBuffersCount == 0) {
+        this->oldestPendingCommandBufferTime = std::chrono::steady_clock::now();
+    }
+    this->pendingCommandBuffersCount++;
     this->cmdBuffers.pushTailOne(*commandBuffer);
 }
 
+bool NEO::SubmissionAggregator::areCompatible(const BatchBuffer &primaryBatchBuffer, const BatchBuffer &nextBatchBuffer) {
+    return nextBatchBuffer.requiresCoherency == primaryBatchBuffer.requiresCoherency &&
+           nextBatchBuffer.low_priority == primaryBatchBuffer.low_priority &&
+           nextBatchBuffer.throttle == primaryBatchBuffer.throttle &&
+           nextBatchBuffer.sliceCount == primaryBatchBuffer.sliceCount;
+}
+
 void NEO::SubmissionAggregator::aggregateCommandBuffers(ResourcePackage &resourcePackage, size_t &totalUsedSize, size_t totalMemoryBudget, uint32_t osContextId) {
     auto primaryCommandBuffer = this->cmdBuffers.peekHead();
     auto currentInspection = this->inspectionId;
@@ -35,32 +48,12 @@ void NEO::SubmissionAggregator::aggregateCommandBuffers(ResourcePackage &resourc
         }
     }
 
-    //check if we have anything for merge
-    if (!primaryCommandBuffer->next) {
-        return;
-    }
-
-    //check if next cmd buffer is compatible
-    if (primaryCommandBuffer->next->batchBuffer.requiresCoherency != primaryCommandBuffer->batchBuffer.requiresCoherency) {
-        return;
-    }
-
-    if (primaryCommandBuffer->next->batchBuffer.low_priority != primaryCommandBuffer->batchBuffer.low_priority) {
-        return;
-    }
-
-    if (primaryCommandBuffer->next->batchBuffer.throttle != primaryCommandBuffer->batchBuffer.throttle) {
-        return;
-    }
-
-    if (primaryCommandBuffer->next->batchBuffer.sliceCount != primaryCommandBuffer->batchBuffer.sliceCount) {
-        return;
-    }
-
+    uint32_t aggregatedCommandBuffersCount = 1u;
     auto nextCommandBuffer = primaryCommandBuffer->next;
     ResourcePackage newResources;
 
-    while (nextCommandBuffer) {
+    //every merged cmd buffer must be compatible with the primary one
+    while (nextCommandBuffer && areCompatible(primaryCommandBuffer->batchBuffer, nextCommandBuffer->batchBuffer)) {
         size_t nextCommandBufferNewResourcesSize = 0;
         //evaluate if buffer fits
         for (auto &graphicsAllocation : nextCommandBuffer->surfaces) {
@@ -87,6 +80,7 @@ void NEO::SubmissionAggregator::aggregateCommandBuffers(ResourcePackage &resourc
             nextCommandBuffer = nextCommandBuffer->next;
             totalUsedSize += nextCommandBufferNewResourcesSize;
             currentNode->inspectionId = currentInspection;
+            aggregatedCommandBuffersCount++;
 
             for (auto &newResource : newResources) {
                 resourcePackage.push_back(newResource);
@@ -96,6 +90,9 @@ void NEO::SubmissionAggregator::aggregateCommandBuffers(ResourcePackage &resourc
             break;
         }
     }
+
+    this->coalescedCommandBuffersCount += aggregatedCommandBuffersCount - 1;
+    this->pendingCommandBuffersCount -= std::min(this->pendingCommandBuffersCount, aggregatedCommandBuffersCount);
 }
 
 NEO::BatchBuffer::BatchBuffer(GraphicsAllocation *commandBufferAllocation, size_t startOffset,
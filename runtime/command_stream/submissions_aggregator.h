@@ -13,6 +13,7 @@
 #include "runtime/helpers/properties_helper.h"
 #include "runtime/memory_manager/residency_container.h"
 
+#include <chrono>
 #include <vector>
 namespace NEO {
 class Device;
@@ -68,9 +69,18 @@ class SubmissionAggregator {
     void recordCommandBuffer(CommandBuffer *commandBuffer);
     void aggregateCommandBuffers(ResourcePackage &resourcePackage, size_t &totalUsedSize, size_t totalMemoryBudget, uint32_t osContextId);
     CommandBufferList &peekCmdBufferList() { return cmdBuffers; }
+    static bool areCompatible(const BatchBuffer &primaryBatchBuffer, const BatchBuffer &nextBatchBuffer);
+
+    uint32_t peekPendingCommandBuffersCount() const { return pendingCommandBuffersCount; }
+    std::chrono::steady_clock::time_point peekOldestPendingCommandBufferTime() const { return oldestPendingCommandBufferTime; }
+    //number of command buffers chained into a preceding one, each saves one submission to the OS
+    uint64_t peekCoalescedCommandBuffersCount() const { return coalescedCommandBuffersCount; }
 
   protected:
     CommandBufferList cmdBuffers;
+    std::chrono::steady_clock::time_point oldestPendingCommandBufferTime;
+    uint64_t coalescedCommandBuffersCount = 0u;
+    uint32_t pendingCommandBuffersCount = 0u;
     uint32_t inspectionId = 1;
 };
 } // namespace NEO
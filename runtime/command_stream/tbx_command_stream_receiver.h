@@ -34,6 +34,7 @@ class TbxStream : public AubMemDump::AubStream {
     void writeMMIOImpl(uint32_t offset, uint32_t value) override;
     void registerPoll(uint32_t registerOffset, uint32_t mask, uint32_t value, bool pollNotEqual, uint32_t timeoutAction) override;
     void readMemory(uint64_t physAddress, void *memory, size_t size);
+    void flush();
 };
 
 struct TbxCommandStreamReceiver {
@@ -49,6 +49,10 @@ TbxCommandStreamReceiverHw<GfxFamily>::TbxCommandStreamReceiverHw(ExecutionEnvir
                             ? this->peekHwInfo().capabilityTable.aubDeviceId
                             : static_cast<uint32_t>(debugDeviceId);
     this->stream = &tbxStream;
+
+    if (DebugManager.flags.EnableAubDirtyPageTracking.get()) {
+        this->dirtyPageTracker = std::make_unique<DirtyPageTracker>();
+    }
 }
 
 template <typename GfxFamily>
@@ -356,6 +360,9 @@ void TbxCommandStreamReceiverHw<GfxFamily>::submitBatchBuffer(uint64_t batchBuff
 
         this->submitLRCA(contextDescriptor);
     }
+
+    // Writes may be pipelined by the socket, the submission has to reach the simulator now
+    tbxStream.flush();
 }
 
 template <typename GfxFamily>
@@ -408,7 +415,7 @@ bool TbxCommandStreamReceiverHw<GfxFamily>::writeMemory(GraphicsAllocation &gfxA
     if (aubManager) {
         this->writeMemoryWithAubManager(gfxAllocation);
     } else {
-        writeMemory(gpuAddress, cpuAddress, size, this->getMemoryBank(&gfxAllocation), this->getPPGTTAdditionalBits(&gfxAllocation));
+        this->writeDirtyMemory(gfxAllocation, gpuAddress, cpuAddress, size);
     }
 
     if (AubHelper::isOneTimeAubWritableAllocationType(gfxAllocation.getAllocationType())) {
@@ -454,6 +461,7 @@ void TbxCommandStreamReceiverHw<GfxFamily>::processResidency(const ResidencyCont
     }
 
     dumpTbxNonWritable = false;
+    this->reportDirtyPageStatistics();
 }
 
 template <typename GfxFamily>
@@ -496,6 +504,9 @@ AubSubCaptureStatus TbxCommandStreamReceiverHw<GfxFamily>::checkAndActivateAubSu
     auto status = subCaptureManager->checkAndActivateSubCapture(dispatchInfo);
     if (status.isActive && !status.wasActiveInPreviousEnqueue) {
         dumpTbxNonWritable = true;
+        if (this->dirtyPageTracker) {
+            this->dirtyPageTracker->reset();
+        }
     }
     return status;
 }
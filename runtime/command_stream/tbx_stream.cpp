@@ -72,4 +72,8 @@ void TbxStream::readMemory(uint64_t physAddress, void *memory, size_t size) {
     socket->readMemory(physAddress, memory, size);
 }
 
+void TbxStream::flush() {
+    socket->flush();
+}
+
 } // namespace NEO
@@ -6,10 +6,12 @@
  */
 
 #include <core/helpers/aligned_memory.h>
+#include <core/os_interface/os_mapped_file.h>
 #include <core/utilities/debug_settings_reader.h>
 #include <runtime/compiler_interface/binary_cache.h>
 #include <runtime/helpers/file_io.h>
 #include <runtime/helpers/hash.h>
+#include <runtime/helpers/hash128.h>
 #include <runtime/helpers/hw_info.h>
 #include <runtime/os_interface/ocl_reg_path.h>
 #include <runtime/os_interface/os_inc_base.h>
@@ -18,6 +20,7 @@
 #include "config.h"
 #include "os_inc.h"
 
+#include <cstdio>
 #include <cstring>
 #include <iomanip>
 #include <mutex>
@@ -26,10 +29,10 @@
 
 namespace NEO {
 std::mutex BinaryCache::cacheAccessMtx;
-const std::string BinaryCache::getCachedFileName(const HardwareInfo &hwInfo, const ArrayRef<const char> input,
-                                                 const ArrayRef<const char> options, const ArrayRef<const char> internalOptions) {
-    Hash hash;
-
+namespace {
+template <typename HashT>
+void hashCacheInputs(HashT &hash, const HardwareInfo &hwInfo, const ArrayRef<const char> input,
+                     const ArrayRef<const char> options, const ArrayRef<const char> internalOptions) {
     hash.update("----", 4);
     hash.update(&*input.begin(), input.size());
     hash.update("----", 4);
@@ -43,6 +46,29 @@ const std::string BinaryCache::getCachedFileName(const HardwareInfo &hwInfo, con
     hash.update(reinterpret_cast<const char *>(&hwInfo.featureTable), sizeof(hwInfo.featureTable));
     hash.update("----", 4);
     hash.update(reinterpret_cast<const char *>(&hwInfo.workaroundTable), sizeof(hwInfo.workaroundTable));
+}
+} // namespace
+
+const std::string BinaryCache::getCachedFileName(const HardwareInfo &hwInfo, const ArrayRef<const char> input,
+                                                 const ArrayRef<const char> options, const ArrayRef<const char> internalOptions) {
+    Hash128 hash;
+    hashCacheInputs(hash, hwInfo, input, options, internalOptions);
+
+    auto res = hash.finish();
+    std::stringstream stream;
+    stream << std::setfill('0')
+           << std::hex
+           << std::setw(sizeof(res[1]) * 2)
+           << res[1]
+           << std::setw(sizeof(res[0]) * 2)
+           << res[0];
+    return stream.str();
+}
+
+const std::string BinaryCache::getLegacyCachedFileName(const HardwareInfo &hwInfo, const ArrayRef<const char> input,
+                                                       const ArrayRef<const char> options, const ArrayRef<const char> internalOptions) {
+    Hash hash;
+    hashCacheInputs(hash, hwInfo, input, options, internalOptions);
 
     auto res = hash.finish();
     std::stringstream stream;
@@ -62,16 +88,27 @@ BinaryCache::BinaryCache() {
 
 BinaryCache::~BinaryCache(){};
 
+std::string BinaryCache::getCachedFilePath(const std::string &kernelFileHash) const {
+    return clCacheLocation + PATH_SEPARATOR + kernelFileHash + ".cl_cache";
+}
+
 bool BinaryCache::cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize) {
     if (pBinary == nullptr || binarySize == 0) {
         return false;
     }
-    std::string filePath = clCacheLocation + PATH_SEPARATOR + kernelFileHash + ".cl_cache";
+    std::string filePath = getCachedFilePath(kernelFileHash);
+    std::string temporaryFilePath = MappedFile::getTemporaryFileName(filePath);
     std::lock_guard<std::mutex> lock(cacheAccessMtx);
+    // entry is published with a rename, programs still mapping the previous file keep reading intact contents
     if (writeDataToFile(
-            filePath.c_str(),
+            temporaryFilePath.c_str(),
             pBinary,
             binarySize) == 0) {
+        std::remove(temporaryFilePath.c_str());
+        return false;
+    }
+    if (!MappedFile::replace(temporaryFilePath, filePath)) {
+        std::remove(temporaryFilePath.c_str());
         return false;
     }
 
@@ -79,24 +116,44 @@ bool BinaryCache::cacheBinary(const std::string kernelFileHash, const char *pBin
 }
 
 bool BinaryCache::loadCachedBinary(const std::string kernelFileHash, Program &program) {
-    void *pBinary = nullptr;
-    size_t binarySize = 0;
-
-    std::string filePath = clCacheLocation + PATH_SEPARATOR + kernelFileHash + ".cl_cache";
+    std::string filePath = getCachedFilePath(kernelFileHash);
 
+    std::shared_ptr<MappedFile> mappedBinary;
     {
         std::lock_guard<std::mutex> lock(cacheAccessMtx);
-        binarySize = loadDataFromFile(filePath.c_str(), pBinary);
+        mappedBinary = MappedFile::open(filePath);
     }
 
-    if ((pBinary == nullptr) || (binarySize == 0)) {
-        deleteDataReadFromFile(pBinary);
+    if (mappedBinary == nullptr) {
         return false;
     }
-    program.storeGenBinary(pBinary, binarySize);
+    if (mappedBinary->getSize() <= maxCopiedBinarySize || !MappedFile::isReplaceableWhileMapped()) {
+        program.storeGenBinary(mappedBinary->getData(), mappedBinary->getSize());
+    } else {
+        program.storeGenBinary(mappedBinary, ArrayRef<const char>(mappedBinary->getData(), mappedBinary->getSize()));
+    }
 
-    deleteDataReadFromFile(pBinary);
+    return true;
+}
+
+bool BinaryCache::loadCachedBinaryForInputs(const HardwareInfo &hwInfo, const ArrayRef<const char> input, const ArrayRef<const char> options,
+                                            const ArrayRef<const char> internalOptions, std::string &kernelFileHash, Program &program) {
+    kernelFileHash = getCachedFileName(hwInfo, input, options, internalOptions);
+    if (loadCachedBinary(kernelFileHash, program)) {
+        return true;
+    }
 
+    // binaries cached under the legacy 64-bit key are migrated to the current key on first use
+    auto legacyKernelFileHash = getLegacyCachedFileName(hwInfo, input, options, internalOptions);
+    if (!loadCachedBinary(legacyKernelFileHash, program)) {
+        return false;
+    }
+    size_t binarySize = 0u;
+    auto binary = program.getGenBinary(binarySize);
+    if (cacheBinary(kernelFileHash, binary, static_cast<uint32_t>(binarySize))) {
+        std::lock_guard<std::mutex> lock(cacheAccessMtx);
+        std::remove(getCachedFilePath(legacyKernelFileHash).c_str());
+    }
     return true;
 }
 
@@ -22,12 +22,21 @@ class BinaryCache {
   public:
     static const std::string getCachedFileName(const HardwareInfo &hwInfo, ArrayRef<const char> input,
                                                ArrayRef<const char> options, ArrayRef<const char> internalOptions);
+    static const std::string getLegacyCachedFileName(const HardwareInfo &hwInfo, ArrayRef<const char> input,
+                                                     ArrayRef<const char> options, ArrayRef<const char> internalOptions);
     BinaryCache();
     virtual ~BinaryCache();
     virtual bool cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize);
     virtual bool loadCachedBinary(const std::string kernelFileHash, Program &program);
+    bool loadCachedBinaryForInputs(const HardwareInfo &hwInfo, ArrayRef<const char> input, ArrayRef<const char> options,
+                                   ArrayRef<const char> internalOptions, std::string &kernelFileHash, Program &program);
+
+    // smaller binaries are copied into the program instead of keeping the cache entry mapped
+    static constexpr size_t maxCopiedBinarySize = 1024 * 1024;
 
   protected:
+    std::string getCachedFilePath(const std::string &kernelFileHash) const;
+
     static std::mutex cacheAccessMtx;
     std::string clCacheLocation;
 };
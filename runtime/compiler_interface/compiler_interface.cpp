@@ -9,6 +9,7 @@
 
 #include "runtime/compiler_interface/binary_cache.h"
 #include "runtime/compiler_interface/compiler_interface.inl"
+#include "runtime/compiler_interface/indexed_binary_cache.h"
 #include "runtime/device/device.h"
 #include "runtime/helpers/hw_info.h"
 #include "runtime/os_interface/debug_settings_manager.h"
@@ -84,11 +85,11 @@ cl_int CompilerInterface::build(
         bool binaryLoaded = false;
         std::string kernelFileHash;
         if (cachingMode == CachingMode::Direct) {
-            kernelFileHash = cache->getCachedFileName(device.getHardwareInfo(),
-                                                      ArrayRef<const char>(inputArgs.pInput, inputArgs.InputSize),
-                                                      ArrayRef<const char>(inputArgs.pOptions, inputArgs.OptionsSize),
-                                                      ArrayRef<const char>(inputArgs.pInternalOptions, inputArgs.InternalOptionsSize));
-            if (cache->loadCachedBinary(kernelFileHash, program)) {
+            if (cache->loadCachedBinaryForInputs(device.getHardwareInfo(),
+                                                 ArrayRef<const char>(inputArgs.pInput, inputArgs.InputSize),
+                                                 ArrayRef<const char>(inputArgs.pOptions, inputArgs.OptionsSize),
+                                                 ArrayRef<const char>(inputArgs.pInternalOptions, inputArgs.InternalOptionsSize),
+                                                 kernelFileHash, program)) {
                 continue;
             }
         }
@@ -124,10 +125,10 @@ cl_int CompilerInterface::build(
         }
 
         if (cachingMode == CachingMode::PreProcess) {
-            kernelFileHash = cache->getCachedFileName(device.getHardwareInfo(), ArrayRef<const char>(intermediateRepresentation->GetMemory<char>(), intermediateRepresentation->GetSize<char>()),
-                                                      ArrayRef<const char>(fclOptions->GetMemory<char>(), fclOptions->GetSize<char>()),
-                                                      ArrayRef<const char>(fclInternalOptions->GetMemory<char>(), fclInternalOptions->GetSize<char>()));
-            binaryLoaded = cache->loadCachedBinary(kernelFileHash, program);
+            binaryLoaded = cache->loadCachedBinaryForInputs(device.getHardwareInfo(), ArrayRef<const char>(intermediateRepresentation->GetMemory<char>(), intermediateRepresentation->GetSize<char>()),
+                                                            ArrayRef<const char>(fclOptions->GetMemory<char>(), fclOptions->GetSize<char>()),
+                                                            ArrayRef<const char>(fclInternalOptions->GetMemory<char>(), fclInternalOptions->GetSize<char>()),
+                                                            kernelFileHash, program);
         }
         if (!binaryLoaded) {
             auto igcTranslationCtx = createIgcTranslationCtx(device, intermediateCodeType, IGC::CodeType::oclGenBin);
@@ -365,7 +366,15 @@ bool CompilerInterface::initialize() {
     compilersModulesSuccessfulyLoaded &= NEO::loadCompiler<IGC::FclOclDeviceCtx>(Os::frontEndDllName, fclLib, fclMain);
     compilersModulesSuccessfulyLoaded &= NEO::loadCompiler<IGC::IgcOclDeviceCtx>(Os::igcDllName, igcLib, igcMain);
 
-    cache.reset(new BinaryCache());
+    if (DebugManager.flags.UseIndexedBinaryCache.get()) {
+        size_t sizeLimit = IndexedBinaryCache::defaultSizeLimit;
+        if (DebugManager.flags.IndexedBinaryCacheSizeLimit.get() != -1) {
+            sizeLimit = static_cast<size_t>(DebugManager.flags.IndexedBinaryCacheSizeLimit.get()) * MemoryConstants::megaByte;
+        }
+        cache.reset(new IndexedBinaryCache("cl_cache", sizeLimit));
+    } else {
+        cache.reset(new BinaryCache());
+    }
 
     return compilersModulesSuccessfulyLoaded;
 }
@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/compiler_interface/compiler_thread_pool.h"
+
+#include "core/helpers/debug_helpers.h"
+#include "runtime/os_interface/os_thread.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace NEO {
+
+namespace {
+struct ParallelForState {
+    ParallelForState(uint32_t count, const std::function<void(uint32_t)> &func) : count(count), func(func) {}
+
+    void run() {
+        uint32_t index;
+        while ((index = next++) < count) {
+            func(index);
+            if (++completed == count) {
+                std::lock_guard<std::mutex> lock(mtx);
+                finished.notify_one();
+            }
+        }
+    }
+
+    const uint32_t count;
+    const std::function<void(uint32_t)> func;
+    std::atomic<uint32_t> next{0u};
+    std::atomic<uint32_t> completed{0u};
+    std::mutex mtx;
+    std::condition_variable finished;
+};
+} // namespace
+
+CompilerThreadPool::CompilerThreadPool(uint32_t numThreads) : numThreads(numThreads) {
+    DEBUG_BREAK_IF(numThreads == 0u);
+}
+
+CompilerThreadPool::~CompilerThreadPool() {
+    std::unique_lock<std::mutex> lock(mtx);
+    shutdown = true;
+    taskAvailable.notify_all();
+    lock.unlock();
+
+    // workers drain the queue before exiting, so pending build callbacks are still delivered
+    for (auto &thread : threads) {
+        thread->join();
+    }
+}
+
+uint32_t CompilerThreadPool::getMaxThreadsCount(int32_t requestedThreads) {
+    if (requestedThreads <= 0) {
+        return 0u;
+    }
+    auto hardwareThreads = std::thread::hardware_concurrency();
+    if (hardwareThreads == 0u) {
+        return static_cast<uint32_t>(requestedThreads);
+    }
+    return std::min(static_cast<uint32_t>(requestedThreads), hardwareThreads);
+}
+
+void CompilerThreadPool::submit(Task task) {
+    std::lock_guard<std::mutex> lock(mtx);
+    //Create on first use
+    openThreads();
+    tasks.push_back(std::move(task));
+    taskAvailable.notify_one();
+}
+
+void CompilerThreadPool::openThreads() {
+    while (threads.size() < numThreads) {
+        threads.push_back(Thread::create(workerLoop, reinterpret_cast<void *>(this)));
+    }
+}
+
+void *CompilerThreadPool::workerLoop(void *arg) {
+    auto self = reinterpret_cast<CompilerThreadPool *>(arg);
+    std::unique_lock<std::mutex> lock(self->mtx);
+
+    while (true) {
+        self->taskAvailable.wait(lock, [self] { return self->shutdown || !self->tasks.empty(); });
+        if (self->tasks.empty()) {
+            break;
+        }
+        auto task = std::move(self->tasks.front());
+        self->tasks.pop_front();
+        self->activeTasks++;
+        lock.unlock();
+
+        task();
+
+        lock.lock();
+        self->activeTasks--;
+        if (self->tasks.empty() && self->activeTasks == 0u) {
+            self->idle.notify_all();
+        }
+    }
+    return nullptr;
+}
+
+void CompilerThreadPool::parallelFor(uint32_t count, const std::function<void(uint32_t)> &func) {
+    if (count == 0u) {
+        return;
+    }
+
+    // The calling thread takes part in the loop, so a task running on a worker may call parallelFor
+    // without waiting for a free worker. Helpers that start after all indices are taken return at once.
+    auto state = std::make_shared<ParallelForState>(count, func);
+    auto numHelpers = std::min(count - 1, numThreads);
+    for (uint32_t i = 0; i < numHelpers; i++) {
+        submit([state] { state->run(); });
+    }
+
+    state->run();
+
+    std::unique_lock<std::mutex> lock(state->mtx);
+    state->finished.wait(lock, [&state] { return state->completed == state->count; });
+}
+
+void CompilerThreadPool::waitForIdle() {
+    std::unique_lock<std::mutex> lock(mtx);
+    idle.wait(lock, [this] { return tasks.empty() && activeTasks == 0u; });
+}
+} // namespace NEO
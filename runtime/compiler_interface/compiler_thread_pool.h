@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class Thread;
+
+class CompilerThreadPool {
+  public:
+    using Task = std::function<void()>;
+
+    explicit CompilerThreadPool(uint32_t numThreads);
+    virtual ~CompilerThreadPool();
+
+    CompilerThreadPool(const CompilerThreadPool &) = delete;
+    CompilerThreadPool &operator=(const CompilerThreadPool &) = delete;
+
+    static uint32_t getMaxThreadsCount(int32_t requestedThreads);
+
+    MOCKABLE_VIRTUAL void submit(Task task);
+    void parallelFor(uint32_t count, const std::function<void(uint32_t)> &func);
+    void waitForIdle();
+
+    uint32_t getNumThreads() const { return numThreads; }
+
+  protected:
+    static void *workerLoop(void *arg);
+    MOCKABLE_VIRTUAL void openThreads();
+
+    const uint32_t numThreads;
+    std::vector<std::unique_ptr<Thread>> threads;
+    std::deque<Task> tasks;
+    uint32_t activeTasks = 0u;
+    bool shutdown = false;
+    std::mutex mtx;
+    std::condition_variable taskAvailable;
+    std::condition_variable idle;
+};
+} // namespace NEO
@@ -0,0 +1,369 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/compiler_interface/indexed_binary_cache.h"
+
+#include "core/os_interface/os_file_lock.h"
+#include "core/os_interface/os_mapped_file.h"
+#include "core/utilities/directory.h"
+#include "runtime/helpers/hash.h"
+#include "runtime/helpers/hash128.h"
+#include "runtime/helpers/stdio.h"
+#include "runtime/os_interface/os_inc_base.h"
+#include "runtime/program/program.h"
+
+#include "os_inc.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <iomanip>
+#include <sstream>
+
+namespace NEO {
+
+IndexedBinaryCache::IndexedBinaryCache(const std::string &cacheName, size_t sizeLimit) : cacheName(cacheName), sizeLimit(sizeLimit), fileIdGenerator(std::random_device{}()) {
+    refreshView();
+}
+
+IndexedBinaryCache::~IndexedBinaryCache() = default;
+
+bool IndexedBinaryCache::cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize) {
+    if (pBinary == nullptr || binarySize == 0) {
+        return false;
+    }
+    if (kernelFileHash.size() + binarySize > sizeLimit) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(publishMtx);
+    auto fileLock = FileLock::acquire(getLockFileName());
+    if (fileLock == nullptr) {
+        return false;
+    }
+    // other processes may have published since the index was last read, their entries are merged
+    refreshView();
+    auto view = std::atomic_load(&currentView);
+
+    std::vector<PendingEntry> pendingEntries;
+    auto keyHash = Hash::hash(kernelFileHash.c_str(), kernelFileHash.size());
+    if (view) {
+        pendingEntries.reserve(view->entries.size() + 1);
+        for (size_t i = 0; i < view->entries.size(); i++) {
+            auto &entry = view->entries[i];
+            auto key = view->dataFile->getData() + entry.offset;
+            if (entry.keyHash == keyHash && entry.keySize == kernelFileHash.size() && memcmp(key, kernelFileHash.c_str(), entry.keySize) == 0) {
+                continue;
+            }
+            PendingEntry pendingEntry = {entry, key, key + entry.keySize};
+            pendingEntry.entry.lastAccess = view->lastAccess[i].load();
+            pendingEntries.push_back(pendingEntry);
+        }
+    }
+
+    PendingEntry newEntry = {};
+    newEntry.entry.keyHash = keyHash;
+    newEntry.entry.keySize = static_cast<uint32_t>(kernelFileHash.size());
+    newEntry.entry.binarySize = binarySize;
+    newEntry.entry.checksum = Hash128::hash(pBinary, binarySize)[0];
+    newEntry.entry.lastAccess = ++accessClock;
+    newEntry.key = kernelFileHash.c_str();
+    newEntry.binary = pBinary;
+
+    auto newEntrySize = newEntry.entry.keySize + newEntry.entry.binarySize;
+    if (view && view->header.dataSize + newEntrySize <= sizeLimit) {
+        return appendEntry(*view, pendingEntries, newEntry);
+    }
+    pendingEntries.push_back(newEntry);
+
+    // compaction, evict least recently used entries that do not fit into the budget
+    std::sort(pendingEntries.begin(), pendingEntries.end(), [](const PendingEntry &left, const PendingEntry &right) {
+        return left.entry.lastAccess > right.entry.lastAccess;
+    });
+    size_t cacheSize = 0u;
+    size_t entriesToKeep = 0u;
+    for (; entriesToKeep < pendingEntries.size(); entriesToKeep++) {
+        auto entrySize = pendingEntries[entriesToKeep].entry.keySize + pendingEntries[entriesToKeep].entry.binarySize;
+        if (cacheSize + entrySize > sizeLimit) {
+            break;
+        }
+        cacheSize += entrySize;
+    }
+    pendingEntries.resize(entriesToKeep);
+
+    auto dataFileId = fileIdGenerator();
+    if (!publishGeneration(pendingEntries, dataFileId)) {
+        return false;
+    }
+
+    // the previous data file can't be removed while this process still maps it
+    view.reset();
+    refreshView();
+    removeUnreferencedFiles(dataFileId);
+    return true;
+}
+
+bool IndexedBinaryCache::loadCachedBinary(const std::string kernelFileHash, Program &program) {
+    ArrayRef<const char> binary;
+
+    auto view = std::atomic_load(&currentView);
+    if (view == nullptr || !findBinary(*view, kernelFileHash, binary)) {
+        // entry may have been published by another process or thread in the meantime
+        refreshView();
+        view = std::atomic_load(&currentView);
+        if (view == nullptr || !findBinary(*view, kernelFileHash, binary)) {
+            return false;
+        }
+    }
+
+    program.storeGenBinary(binary.begin(), binary.size());
+    return true;
+}
+
+bool IndexedBinaryCache::readIndexHeader(IndexHeader &header) const {
+    FILE *fp = nullptr;
+    fopen_s(&fp, getIndexFileName().c_str(), "rb");
+    if (fp == nullptr) {
+        return false;
+    }
+    auto success = fread(&header, sizeof(header), 1, fp) == 1;
+    fclose(fp);
+    return success && header.magic == indexMagic && header.version == indexVersion;
+}
+
+std::shared_ptr<IndexedBinaryCache::CacheView> IndexedBinaryCache::openView(const CacheView *previousView) {
+    auto view = std::make_shared<CacheView>();
+
+    // the index is read into memory, so it can be replaced while this process uses it
+    FILE *fp = nullptr;
+    fopen_s(&fp, getIndexFileName().c_str(), "rb");
+    if (fp == nullptr) {
+        return nullptr;
+    }
+    auto success = fread(&view->header, sizeof(IndexHeader), 1, fp) == 1 &&
+                   view->header.magic == indexMagic && view->header.version == indexVersion;
+    if (success) {
+        view->entries.resize(view->header.entriesCount);
+        success = fread(view->entries.data(), sizeof(IndexEntry), view->entries.size(), fp) == view->entries.size() &&
+                  fgetc(fp) == EOF;
+    }
+    fclose(fp);
+    if (!success) {
+        return nullptr;
+    }
+
+    if (previousView && previousView->header.dataFileId == view->header.dataFileId &&
+        previousView->dataFile->getSize() >= view->header.dataSize) {
+        view->dataFile = previousView->dataFile;
+    } else {
+        view->dataFile = MappedFile::open(getDataFileName(view->header.dataFileId));
+    }
+    if (view->dataFile == nullptr || view->dataFile->getSize() < view->header.dataSize) {
+        return nullptr;
+    }
+
+    view->lastAccess.reset(new std::atomic<uint64_t>[view->entries.size()]);
+    for (size_t i = 0; i < view->entries.size(); i++) {
+        auto lastAccess = view->entries[i].lastAccess;
+        if (previousView && previousView->header.dataFileId == view->header.dataFileId) {
+            // accesses recorded by this process are not in the index until it publishes
+            auto previousEntries = previousView->entries.data();
+            auto previousEntriesEnd = previousEntries + previousView->entries.size();
+            auto previousEntry = std::lower_bound(previousEntries, previousEntriesEnd, view->entries[i].keyHash, [](const IndexEntry &entry, uint64_t keyHash) {
+                return entry.keyHash < keyHash;
+            });
+            for (; previousEntry != previousEntriesEnd && previousEntry->keyHash == view->entries[i].keyHash; previousEntry++) {
+                if (previousEntry->offset == view->entries[i].offset) {
+                    lastAccess = std::max(lastAccess, previousView->lastAccess[previousEntry - previousEntries].load());
+                }
+            }
+        }
+        view->lastAccess[i] = lastAccess;
+    }
+
+    auto clock = accessClock.load();
+    while (clock < view->header.accessClock && !accessClock.compare_exchange_weak(clock, view->header.accessClock)) {
+    }
+    return view;
+}
+
+void IndexedBinaryCache::refreshView() {
+    auto view = std::atomic_load(&currentView);
+    IndexHeader header = {};
+    if (!readIndexHeader(header)) {
+        return;
+    }
+    // every publish either grows the data file or starts a new one
+    if (view && view->header.dataFileId == header.dataFileId && view->header.dataSize == header.dataSize &&
+        view->header.entriesCount == header.entriesCount) {
+        return;
+    }
+    auto newView = openView(view.get());
+    if (newView == nullptr) {
+        return;
+    }
+    std::atomic_store(&currentView, newView);
+}
+
+bool IndexedBinaryCache::findBinary(CacheView &view, const std::string &kernelFileHash, ArrayRef<const char> &binary) {
+    auto keyHash = Hash::hash(kernelFileHash.c_str(), kernelFileHash.size());
+    auto entries = view.entries.data();
+    auto entriesEnd = entries + view.entries.size();
+    auto entry = std::lower_bound(entries, entriesEnd, keyHash, [](const IndexEntry &entry, uint64_t keyHash) {
+        return entry.keyHash < keyHash;
+    });
+
+    for (; entry != entriesEnd && entry->keyHash == keyHash; entry++) {
+        if (entry->keySize != kernelFileHash.size() ||
+            entry->offset + entry->keySize + entry->binarySize > view.header.dataSize) {
+            continue;
+        }
+        auto key = view.dataFile->getData() + entry->offset;
+        if (memcmp(key, kernelFileHash.c_str(), entry->keySize) != 0) {
+            continue;
+        }
+        auto entryBinary = key + entry->keySize;
+        if (Hash128::hash(entryBinary, entry->binarySize)[0] != entry->checksum) {
+            return false;
+        }
+
+        view.lastAccess[entry - entries] = ++accessClock;
+        binary = ArrayRef<const char>(entryBinary, entry->binarySize);
+        return true;
+    }
+    return false;
+}
+
+bool IndexedBinaryCache::appendEntry(const CacheView &view, std::vector<PendingEntry> &pendingEntries, PendingEntry &newEntry) {
+    FILE *fp = nullptr;
+    fopen_s(&fp, getDataFileName(view.header.dataFileId).c_str(), "r+b");
+    if (fp == nullptr) {
+        return false;
+    }
+    // bytes left behind by an interrupted writer are not referenced by the index and stay unused
+    bool success = fseek(fp, 0, SEEK_END) == 0;
+    auto offset = ftell(fp);
+    success &= offset >= 0 && static_cast<uint64_t>(offset) >= view.header.dataSize;
+    if (success) {
+        success &= fwrite(newEntry.key, 1, newEntry.entry.keySize, fp) == newEntry.entry.keySize;
+        success &= fwrite(newEntry.binary, 1, newEntry.entry.binarySize, fp) == newEntry.entry.binarySize;
+    }
+    success &= fclose(fp) == 0;
+    if (!success) {
+        return false;
+    }
+
+    newEntry.entry.offset = static_cast<uint64_t>(offset);
+    pendingEntries.push_back(newEntry);
+
+    IndexHeader header = view.header;
+    header.dataSize = newEntry.entry.offset + newEntry.entry.keySize + newEntry.entry.binarySize;
+    if (!publishIndex(header, pendingEntries)) {
+        return false;
+    }
+    refreshView();
+    return true;
+}
+
+bool IndexedBinaryCache::publishGeneration(std::vector<PendingEntry> &pendingEntries, uint64_t dataFileId) {
+    auto dataFileName = getDataFileName(dataFileId);
+    auto temporaryFileName = getTemporaryFileName(dataFileName);
+    FILE *fp = nullptr;
+    fopen_s(&fp, temporaryFileName.c_str(), "wb");
+    if (fp == nullptr) {
+        return false;
+    }
+    bool success = true;
+    uint64_t dataSize = 0u;
+    for (auto &pendingEntry : pendingEntries) {
+        pendingEntry.entry.offset = dataSize;
+        success &= fwrite(pendingEntry.key, 1, pendingEntry.entry.keySize, fp) == pendingEntry.entry.keySize;
+        success &= fwrite(pendingEntry.binary, 1, pendingEntry.entry.binarySize, fp) == pendingEntry.entry.binarySize;
+        dataSize += pendingEntry.entry.keySize + pendingEntry.entry.binarySize;
+    }
+    success &= fclose(fp) == 0;
+    if (!success || !MappedFile::replace(temporaryFileName, dataFileName)) {
+        std::remove(temporaryFileName.c_str());
+        return false;
+    }
+
+    IndexHeader header = {};
+    header.magic = indexMagic;
+    header.version = indexVersion;
+    header.dataFileId = dataFileId;
+    header.dataSize = dataSize;
+    if (!publishIndex(header, pendingEntries)) {
+        std::remove(dataFileName.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool IndexedBinaryCache::publishIndex(IndexHeader &header, std::vector<PendingEntry> &pendingEntries) {
+    std::sort(pendingEntries.begin(), pendingEntries.end(), [](const PendingEntry &left, const PendingEntry &right) {
+        return left.entry.keyHash < right.entry.keyHash;
+    });
+    header.accessClock = accessClock.load();
+    header.entriesCount = static_cast<uint32_t>(pendingEntries.size());
+
+    auto indexFileName = getIndexFileName();
+    auto temporaryFileName = getTemporaryFileName(indexFileName);
+    FILE *fp = nullptr;
+    fopen_s(&fp, temporaryFileName.c_str(), "wb");
+    if (fp == nullptr) {
+        return false;
+    }
+    bool success = fwrite(&header, sizeof(header), 1, fp) == 1;
+    for (auto &pendingEntry : pendingEntries) {
+        success &= fwrite(&pendingEntry.entry, sizeof(IndexEntry), 1, fp) == 1;
+    }
+    success &= fclose(fp) == 0;
+    if (!success || !MappedFile::replace(temporaryFileName, indexFileName)) {
+        std::remove(temporaryFileName.c_str());
+        return false;
+    }
+    return true;
+}
+
+void IndexedBinaryCache::removeUnreferencedFiles(uint64_t dataFileId) {
+    // called with the lock file held, temporary files left by other writers are stale
+    constexpr size_t fileIdDigits = sizeof(dataFileId) * 2;
+    auto prefix = cacheName + ".";
+    auto referencedDataFileName = getDataFileName(dataFileId);
+    referencedDataFileName = referencedDataFileName.substr(referencedDataFileName.find_last_of("/\\") + 1);
+    for (auto &filePath : Directory::getFiles(clCacheLocation)) {
+        auto fileName = filePath.substr(filePath.find_last_of("/\\") + 1);
+        if (fileName.compare(0, prefix.size(), prefix) != 0 || fileName == referencedDataFileName) {
+            continue;
+        }
+        auto suffix = fileName.substr(prefix.size());
+        auto isDataFile = suffix.find_first_not_of("0123456789abcdef") == fileIdDigits &&
+                          (suffix.compare(fileIdDigits, std::string::npos, ".data") == 0 || suffix.compare(fileIdDigits, std::string::npos, ".data.tmp") == 0);
+        if (isDataFile || suffix == "index.tmp") {
+            // fails for files still mapped on Windows, these are retried by the next compaction
+            std::remove(filePath.c_str());
+        }
+    }
+}
+
+std::string IndexedBinaryCache::getIndexFileName() const {
+    return clCacheLocation + PATH_SEPARATOR + cacheName + ".index";
+}
+
+std::string IndexedBinaryCache::getLockFileName() const {
+    return clCacheLocation + PATH_SEPARATOR + cacheName + ".lock";
+}
+
+std::string IndexedBinaryCache::getDataFileName(uint64_t dataFileId) const {
+    std::stringstream stream;
+    stream << clCacheLocation << PATH_SEPARATOR << cacheName << "." << std::setfill('0') << std::setw(sizeof(dataFileId) * 2) << std::hex << dataFileId << ".data";
+    return stream.str();
+}
+
+std::string IndexedBinaryCache::getTemporaryFileName(const std::string &fileName) const {
+    return fileName + ".tmp";
+}
+} // namespace NEO
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "core/memory_manager/memory_constants.h"
+#include "runtime/compiler_interface/binary_cache.h"
+
+#include <atomic>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace NEO {
+class MappedFile;
+
+// Binary cache kept in one index file and one packed data file per cache directory.
+// Writers of all processes are serialized with a lock file. New binaries are appended to the
+// data file and published with an atomic rename of the index, readers look entries up in
+// the memory mapped data file without locking. Data bytes are never modified in place, when
+// the data file outgrows the budget live entries are compacted into a new data file.
+class IndexedBinaryCache : public BinaryCache {
+  public:
+    static constexpr uint32_t indexMagic = 0x58444943; // "CIDX"
+    static constexpr uint32_t indexVersion = 3u;
+    static constexpr size_t defaultSizeLimit = 256 * MemoryConstants::megaByte;
+
+    struct IndexHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t dataFileId;
+        uint64_t dataSize;
+        uint64_t accessClock;
+        uint32_t entriesCount;
+        uint32_t reserved;
+    };
+    static_assert(sizeof(IndexHeader) == 40, "Index file layout must not depend on compiler padding");
+
+    struct IndexEntry {
+        uint64_t keyHash;
+        uint64_t offset;
+        uint64_t checksum;
+        uint64_t lastAccess;
+        uint32_t keySize;
+        uint32_t binarySize;
+    };
+    static_assert(sizeof(IndexEntry) == 40, "Index file layout must not depend on compiler padding");
+
+    IndexedBinaryCache(const std::string &cacheName, size_t sizeLimit);
+    ~IndexedBinaryCache() override;
+
+    bool cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize) override;
+    bool loadCachedBinary(const std::string kernelFileHash, Program &program) override;
+
+  protected:
+    struct CacheView {
+        IndexHeader header = {};
+        std::vector<IndexEntry> entries;
+        // views of one data file generation share its mapping
+        std::shared_ptr<MappedFile> dataFile;
+        std::unique_ptr<std::atomic<uint64_t>[]> lastAccess;
+    };
+
+    struct PendingEntry {
+        IndexEntry entry;
+        const char *key;
+        const char *binary;
+    };
+
+    bool readIndexHeader(IndexHeader &header) const;
+    MOCKABLE_VIRTUAL std::shared_ptr<CacheView> openView(const CacheView *previousView);
+    void refreshView();
+    bool findBinary(CacheView &view, const std::string &kernelFileHash, ArrayRef<const char> &binary);
+    bool appendEntry(const CacheView &view, std::vector<PendingEntry> &pendingEntries, PendingEntry &newEntry);
+    bool publishGeneration(std::vector<PendingEntry> &pendingEntries, uint64_t dataFileId);
+    bool publishIndex(IndexHeader &header, std::vector<PendingEntry> &pendingEntries);
+    void removeUnreferencedFiles(uint64_t dataFileId);
+
+    std::string getIndexFileName() const;
+    std::string getLockFileName() const;
+    std::string getDataFileName(uint64_t dataFileId) const;
+    std::string getTemporaryFileName(const std::string &fileName) const;
+
+    std::string cacheName;
+    size_t sizeLimit;
+    std::shared_ptr<CacheView> currentView;
+    std::atomic<uint64_t> accessClock{0u};
+    std::mutex publishMtx;
+    std::mt19937_64 fileIdGenerator;
+};
+} // namespace NEO
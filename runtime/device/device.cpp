@@ -7,6 +7,7 @@
 
 #include "runtime/device/device.h"
 
+#include "runtime/command_queue/local_ids_cache.h"
 #include "runtime/command_stream/command_stream_receiver.h"
 #include "runtime/command_stream/experimental_command_buffer.h"
 #include "runtime/command_stream/preemption.h"
@@ -55,6 +56,12 @@ Device::Device(ExecutionEnvironment *executionEnvironment, uint32_t deviceIndex)
     this->executionEnvironment->incRefInternal();
     auto &hwHelper = HwHelper::get(hwInfo.platform.eRenderCoreFamily);
     hwHelper.setupHardwareCapabilities(&this->hardwareCapabilities, hwInfo);
+
+    if (DebugManager.flags.EnableLocalIdsCache.get()) {
+        auto maxEntries = DebugManager.flags.LocalIdsCacheSize.get() > 0 ? static_cast<size_t>(DebugManager.flags.LocalIdsCacheSize.get())
+                                                                          : LocalIdsCache::defaultMaxEntries;
+        localIdsCache = std::make_unique<LocalIdsCache>(maxEntries);
+    }
 }
 
 Device::~Device() {
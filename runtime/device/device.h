@@ -20,6 +20,7 @@
 namespace NEO {
 class OSTime;
 class DriverInfo;
+class LocalIdsCache;
 
 template <>
 struct OpenCLObjectMapper<_cl_device_id> {
@@ -81,6 +82,7 @@ class Device : public BaseObject<_cl_device_id> {
     bool isSimulation() const;
     GFXCORE_FAMILY getRenderCoreFamily() const;
     PerformanceCounters *getPerformanceCounters() { return performanceCounters.get(); }
+    LocalIdsCache *getLocalIdsCache() const { return localIdsCache.get(); }
     static decltype(&PerformanceCounters::create) createPerformanceCountersFunc;
     PreemptionMode getPreemptionMode() const { return preemptionMode; }
     std::vector<unsigned int> simultaneousInterops;
@@ -127,6 +129,7 @@ class Device : public BaseObject<_cl_device_id> {
     std::unique_ptr<OSTime> osTime;
     std::unique_ptr<DriverInfo> driverInfo;
     std::unique_ptr<PerformanceCounters> performanceCounters;
+    std::unique_ptr<LocalIdsCache> localIdsCache;
 
     std::vector<EngineControl> engines;
 
@@ -26,12 +26,36 @@
 #include "runtime/platform/platform.h"
 #include "runtime/utilities/tag_allocator.h"
 
+#include <algorithm>
+#include <vector>
+
 #define OCLRT_NUM_TIMESTAMP_BITS (32)
 
 namespace NEO {
 
 const cl_uint Event::eventNotReady = 0xFFFFFFF0;
 
+namespace {
+// unblocks event by parentEvent, or runs deferred callbacks of event when parentEvent is null
+struct EventUnblockRequest {
+    Event *event;
+    Event *parentEvent;
+    uint32_t taskLevel;
+    int32_t transitionStatus;
+};
+
+// unblocking a child may complete it and unblock its own children - requests are queued
+// per thread and drained by the outermost caller instead of recursing down the event chain.
+// Requests are taken last in first out, so children and callbacks are processed in the
+// same order as with recursive unblocking.
+struct EventReadyQueue {
+    std::vector<EventUnblockRequest> requests;
+    bool draining = false;
+};
+
+thread_local EventReadyQueue eventReadyQueue;
+} // namespace
+
 Event::Event(
     Context *ctx,
     CommandQueue *cmdQueue,
@@ -387,7 +411,12 @@ void Event::addChild(Event &childEvent) {
         childEvent.parentEvents.push_back(this);
     }
     if (executionStatus == CL_COMPLETE) {
+        auto readyQueueDepth = eventReadyQueue.requests.size();
         unblockEventsBlockedByThis(CL_COMPLETE);
+        if (eventReadyQueue.draining) {
+            // the child has to be unblocked when addChild returns, not when the outer drain ends
+            drainReadyQueue(readyQueueDepth);
+        }
     }
 }
 
@@ -410,6 +439,23 @@ void Event::unblockEventsBlockedByThis(int32_t transitionStatus) {
     }
 
     auto childEventRef = childEventsToNotify.detachNodes();
+    if (DebugManager.flags.EnableIterativeEventUnblocking.get()) {
+        auto &readyQueue = eventReadyQueue;
+        auto readyQueueDepth = readyQueue.requests.size();
+        while (childEventRef != nullptr) {
+            this->incRefInternal();
+            readyQueue.requests.push_back({childEventRef->ref, this, taskLevelToPropagate, transitionStatus});
+            auto next = childEventRef->next;
+            delete childEventRef;
+            childEventRef = next;
+        }
+        std::reverse(readyQueue.requests.begin() + readyQueueDepth, readyQueue.requests.end());
+        if (!readyQueue.draining) {
+            drainReadyQueue(readyQueueDepth);
+        }
+        return;
+    }
+
     while (childEventRef != nullptr) {
         auto childEvent = childEventRef->ref;
 
@@ -447,6 +493,12 @@ bool Event::setStatus(cl_int status) {
     this->incRefInternal();
     transitionExecutionStatus(status);
     if (isStatusCompleted(status) || (status == CL_SUBMITTED)) {
+        if (eventReadyQueue.draining) {
+            // callbacks run once the children queued above them are unblocked, the request keeps the reference
+            eventReadyQueue.requests.push_back({this, nullptr, 0u, status});
+            unblockEventsBlockedByThis(status);
+            return true;
+        }
         unblockEventsBlockedByThis(status);
     }
     executeCallbacks(status);
@@ -454,6 +506,26 @@ bool Event::setStatus(cl_int status) {
     return true;
 }
 
+void Event::drainReadyQueue(size_t depth) {
+    auto &readyQueue = eventReadyQueue;
+    auto wasDraining = readyQueue.draining;
+    while (readyQueue.requests.size() > depth) {
+        auto request = readyQueue.requests.back();
+        readyQueue.requests.pop_back();
+        if (request.parentEvent != nullptr) {
+            readyQueue.draining = true;
+            request.event->unblockEventBy(*request.parentEvent, request.taskLevel, request.transitionStatus);
+            request.parentEvent->decRefInternal();
+        } else {
+            // events signaled by a callback are processed before it returns, as outside of draining
+            readyQueue.draining = false;
+            request.event->executeCallbacks(request.transitionStatus);
+        }
+        request.event->decRefInternal();
+    }
+    readyQueue.draining = wasDraining;
+}
+
 void Event::transitionExecutionStatus(int32_t newExecutionStatus) const {
     int32_t prevStatus = executionStatus;
     DBG_LOG(EventsDebugEnable, "transitionExecutionStatus event", this, " new status", newExecutionStatus, "previousStatus", prevStatus);
@@ -529,9 +601,54 @@ cl_int Event::waitForEvents(cl_uint numEvents,
     }
 
     using WorkerListT = StackVec<cl_event, 64>;
-    WorkerListT workerList1(eventList, eventList + numEvents);
+    WorkerListT workerList1;
     WorkerListT workerList2;
-    workerList2.reserve(numEvents);
+
+    if (DebugManager.flags.EnableCoalescedEventWaits.get()) {
+        struct CsrWait {
+            CommandStreamReceiver *csr;
+            CommandQueue *cmdQueue;
+            uint32_t taskCount;
+            FlushStamp flushStamp;
+        };
+        StackVec<CsrWait, 4> csrWaits;
+        StackVec<Event *, 64> coalescedEvents;
+
+        // events with a known task count are completed by waiting on their CSR,
+        // user events and externally synchronized events are polled below
+        for (const cl_event *it = eventList, *end = eventList + numEvents; it != end; ++it) {
+            Event *event = castToObjectOrAbort<Event>(*it);
+            if (event->peekExecutionStatus() < CL_COMPLETE) {
+                return CL_EXEC_STATUS_ERROR_FOR_EVENTS_IN_WAIT_LIST;
+            }
+            uint32_t eventTaskCount = event->taskCount;
+            if (event->cmdQueue == nullptr || event->isUserEvent() || event->isExternallySynchronized() || eventTaskCount == Event::eventNotReady) {
+                workerList1.push_back(*it);
+                continue;
+            }
+
+            auto csr = &event->cmdQueue->getGpgpuCommandStreamReceiver();
+            auto csrWait = std::find_if(csrWaits.begin(), csrWaits.end(), [csr](const CsrWait &wait) { return wait.csr == csr; });
+            if (csrWait == csrWaits.end()) {
+                csrWaits.push_back({csr, event->cmdQueue, eventTaskCount, event->flushStamp->peekStamp()});
+            } else if (eventTaskCount > csrWait->taskCount) {
+                csrWait->cmdQueue = event->cmdQueue;
+                csrWait->taskCount = eventTaskCount;
+                csrWait->flushStamp = event->flushStamp->peekStamp();
+            }
+            coalescedEvents.push_back(event);
+        }
+
+        for (auto &csrWait : csrWaits) {
+            csrWait.cmdQueue->waitUntilComplete(csrWait.taskCount, csrWait.flushStamp, false);
+        }
+        for (auto event : coalescedEvents) {
+            event->updateExecutionStatus();
+        }
+    } else {
+        workerList1 = WorkerListT(eventList, eventList + numEvents);
+    }
+    workerList2.reserve(workerList1.size());
 
     // pointers to workerLists - for fast swap operations
     WorkerListT *currentlyPendingEvents = &workerList1;
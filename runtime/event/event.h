@@ -336,6 +336,8 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
     //vector storing events that needs to be notified when this event is ready to go
     IFRefList<Event, true, true> childEventsToNotify;
     void unblockEventsBlockedByThis(int32_t transitionStatus);
+    // processes requests queued by iterative unblocking on this thread until depth requests are left
+    static void drainReadyQueue(size_t depth);
     void submitCommand(bool abortBlockedTasks);
 
     bool currentCmdQVirtualEvent;
@@ -33,6 +33,19 @@ Kernel *MultiDispatchInfo::peekMainKernel() const {
     return mainKernel ? mainKernel : dispatchInfos.begin()->getKernel();
 }
 
+Kernel *MultiDispatchInfo::peekKernelRequiringCacheFlush(const CommandQueue &commandQueue) const {
+    if (!independentKernels) {
+        auto kernel = peekMainKernel();
+        return (kernel && kernel->requiresCacheFlushCommand(commandQueue)) ? kernel : nullptr;
+    }
+    for (const auto &dispatchInfo : dispatchInfos) {
+        if (dispatchInfo.getKernel()->requiresCacheFlushCommand(commandQueue)) {
+            return dispatchInfo.getKernel();
+        }
+    }
+    return nullptr;
+}
+
 Kernel *MultiDispatchInfo::peekParentKernel() const {
     return (mainKernel && mainKernel->isParentKernel) ? mainKernel : nullptr;
 }
@@ -19,6 +19,7 @@
 
 namespace NEO {
 
+class CommandQueue;
 class Kernel;
 
 class DispatchInfo {
@@ -183,6 +184,16 @@ struct MultiDispatchInfo {
 
     Kernel *peekParentKernel() const;
     Kernel *peekMainKernel() const;
+    Kernel *peekKernelRequiringCacheFlush(const CommandQueue &commandQueue) const;
+
+    // kernels of a recorded sequence are each dispatched as the main kernel of their own enqueue
+    void setIndependentKernels(bool independentKernels) {
+        this->independentKernels = independentKernels;
+    }
+
+    bool isMainKernel(const Kernel *kernel) const {
+        return independentKernels || kernel == peekMainKernel();
+    }
 
     void setBuiltinOpParams(BuiltinOpParams builtinOpParams) {
         this->builtinOpParams = builtinOpParams;
@@ -197,5 +208,6 @@ struct MultiDispatchInfo {
     StackVec<DispatchInfo, 9> dispatchInfos;
     StackVec<MemObj *, 2> redescribedSurfaces;
     Kernel *mainKernel = nullptr;
+    bool independentKernels = false;
 };
 } // namespace NEO
@@ -120,7 +120,8 @@ void HardwareCommandsHelper<GfxFamily>::programPerThreadData(
         numChannels,
         localWorkSize,
         kernel.getKernelInfo().workgroupDimensionsOrder,
-        kernel.usesOnlyImages());
+        kernel.usesOnlyImages(),
+        kernel.getDevice().getLocalIdsCache());
 
     updatePerThreadDataTotal(sizePerThreadData, simd, numChannels, sizePerThreadDataTotal, localWorkItems);
 }
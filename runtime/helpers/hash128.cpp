@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/hash128.h"
+
+#include "core/utilities/cpu_info.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace NEO {
+
+Hash128Helper::ProcessStripesFunc Hash128Helper::processStripes = processHash128Stripes<uint32_t>;
+
+Hash128Helper::ProcessStripesFunc Hash128Helper::selectProcessStripes(const CpuInfo &cpuInfo) {
+    if (cpuInfo.isFeatureSupported(CpuInfo::featureAvX2)) {
+        return processHash128Stripes<uint32x8_t>;
+    }
+    if (cpuInfo.isFeatureSupported(CpuInfo::featureSsE41)) {
+        return processHash128Stripes<uint32x4_t>;
+    }
+    return processHash128Stripes<uint32_t>;
+}
+
+// Initialize the stripe processing function based on CPU capabilities
+Hash128Helper::Hash128Helper() {
+    Hash128Helper::processStripes = selectProcessStripes(CpuInfo::getInstance());
+}
+
+Hash128Helper Hash128Helper::initializer;
+
+namespace {
+const uint64_t prime64First = 0x9E3779B185EBCA87ull;
+const uint64_t prime64Second = 0xC2B2AE3D27D4EB4Full;
+
+inline uint64_t rotateLeft(uint64_t value, int bits) {
+    return (value << bits) | (value >> (64 - bits));
+}
+
+inline uint32_t rotateLeft(uint32_t value, int bits) {
+    return (value << bits) | (value >> (32 - bits));
+}
+
+inline uint64_t avalanche(uint64_t value) {
+    value ^= value >> 33;
+    value *= 0xFF51AFD7ED558CCDull;
+    value ^= value >> 33;
+    value *= 0xC4CEB9FE1A85EC53ull;
+    value ^= value >> 33;
+    return value;
+}
+} // namespace
+
+template <>
+void processHash128Stripes<uint32_t>(uint32_t *lanes, const char *data, size_t stripesCount) {
+    for (size_t stripe = 0; stripe < stripesCount; stripe++) {
+        for (uint32_t i = 0; i < Hash128::lanesCount; i++) {
+            uint32_t input;
+            memcpy(&input, data + i * sizeof(uint32_t), sizeof(uint32_t));
+            lanes[i] = rotateLeft(lanes[i] + input * Hash128::prime2, 13) * Hash128::prime1;
+        }
+        data += Hash128::stripeSize;
+    }
+}
+
+void Hash128::update(const char *buff, size_t size) {
+    if (buff == nullptr) {
+        return;
+    }
+    totalSize += size;
+
+    if (pendingSize > 0) {
+        auto bytesToCopy = std::min(size, stripeSize - pendingSize);
+        memcpy(pendingData.data() + pendingSize, buff, bytesToCopy);
+        pendingSize += bytesToCopy;
+        buff += bytesToCopy;
+        size -= bytesToCopy;
+        if (pendingSize < stripeSize) {
+            return;
+        }
+        Hash128Helper::processStripes(lanes.data(), pendingData.data(), 1);
+        pendingSize = 0;
+    }
+
+    auto stripesCount = size / stripeSize;
+    if (stripesCount > 0) {
+        Hash128Helper::processStripes(lanes.data(), buff, stripesCount);
+        buff += stripesCount * stripeSize;
+        size -= stripesCount * stripeSize;
+    }
+
+    memcpy(pendingData.data(), buff, size);
+    pendingSize = size;
+}
+
+Hash128::Value Hash128::finish() const {
+    auto finalLanes = lanes;
+    if (pendingSize > 0) {
+        // tail is zero padded to a full stripe, the total size mixed in below keeps it unambiguous
+        std::array<char, stripeSize> lastStripe = {};
+        memcpy(lastStripe.data(), pendingData.data(), pendingSize);
+        Hash128Helper::processStripes(finalLanes.data(), lastStripe.data(), 1);
+    }
+
+    uint64_t low = totalSize * prime64First;
+    uint64_t high = ~totalSize * prime64Second;
+    for (uint32_t i = 0; i < lanesCount; i++) {
+        low = rotateLeft(low ^ (finalLanes[i] * prime64Second), 31) * prime64First;
+        high = rotateLeft(high + (finalLanes[i] ^ low), 27) * prime64Second;
+    }
+    low = avalanche(low);
+    high = avalanche(high);
+    low += high;
+    high += low;
+    return {{low, high}};
+}
+
+void Hash128::reset() {
+    for (uint32_t i = 0; i < lanesCount; i++) {
+        lanes[i] = prime1 * (i + 1);
+    }
+    pendingSize = 0;
+    totalSize = 0;
+}
+} // namespace NEO
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace NEO {
+struct CpuInfo;
+struct uint32x4_t;
+struct uint32x8_t;
+
+// 128-bit content hash processing input in 64 byte stripes spread over 16 independent
+// 32-bit lanes, so that stripes are consumed with SIMD instructions. All code paths
+// produce identical values, which makes the hash usable as a persistent cache key.
+class Hash128 {
+  public:
+    static const size_t stripeSize = 64u;
+    static const uint32_t lanesCount = 16u;
+    static const uint32_t prime1 = 0x9E3779B1u;
+    static const uint32_t prime2 = 0x85EBCA77u;
+
+    using Value = std::array<uint64_t, 2>;
+
+    Hash128() {
+        reset();
+    }
+
+    void update(const char *buff, size_t size);
+    Value finish() const;
+    void reset();
+
+    static Value hash(const char *buff, size_t size) {
+        Hash128 hash;
+        hash.update(buff, size);
+        return hash.finish();
+    }
+
+  protected:
+    std::array<uint32_t, lanesCount> lanes;
+    std::array<char, stripeSize> pendingData;
+    size_t pendingSize;
+    uint64_t totalSize;
+};
+
+struct Hash128Helper {
+    using ProcessStripesFunc = void (*)(uint32_t *lanes, const char *data, size_t stripesCount);
+    static ProcessStripesFunc processStripes;
+    static ProcessStripesFunc selectProcessStripes(const CpuInfo &cpuInfo);
+
+    static Hash128Helper initializer;
+
+  private:
+    Hash128Helper();
+};
+
+template <typename Vec>
+void processHash128Stripes(uint32_t *lanes, const char *data, size_t stripesCount);
+
+// one lane at a time, for CPUs without SSE4.1
+template <>
+void processHash128Stripes<uint32_t>(uint32_t *lanes, const char *data, size_t stripesCount);
+} // namespace NEO
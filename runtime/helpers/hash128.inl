@@ -0,0 +1,39 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/hash128.h"
+
+namespace NEO {
+
+template <typename Vec>
+inline void processHash128Stripes(uint32_t *lanes, const char *data, size_t stripesCount) {
+    const int vectorsPerStripe = Hash128::lanesCount / Vec::numChannels;
+    const Vec vPrime1(Hash128::prime1);
+    const Vec vPrime2(Hash128::prime2);
+
+    Vec accumulators[vectorsPerStripe];
+    for (int i = 0; i < vectorsPerStripe; i++) {
+        accumulators[i].loadUnaligned(lanes + i * Vec::numChannels);
+    }
+
+    for (size_t stripe = 0; stripe < stripesCount; stripe++) {
+        for (int i = 0; i < vectorsPerStripe; i++) {
+            Vec input;
+            input.loadUnaligned(data + i * Vec::numChannels * sizeof(uint32_t));
+            input *= vPrime2;
+            accumulators[i] += input;
+            accumulators[i].rotateLeft(13);
+            accumulators[i] *= vPrime1;
+        }
+        data += Hash128::stripeSize;
+    }
+
+    for (int i = 0; i < vectorsPerStripe; i++) {
+        accumulators[i].storeUnaligned(lanes + i * Vec::numChannels);
+    }
+}
+} // namespace NEO
@@ -0,0 +1,15 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#if __AVX2__
+#include "runtime/helpers/hash128.inl"
+#include "runtime/helpers/uint32_avx2.h"
+
+namespace NEO {
+template void processHash128Stripes<uint32x8_t>(uint32_t *lanes, const char *data, size_t stripesCount);
+} // namespace NEO
+#endif
@@ -0,0 +1,13 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/hash128.inl"
+#include "runtime/helpers/uint32_sse4.h"
+
+namespace NEO {
+template void processHash128Stripes<uint32x4_t>(uint32_t *lanes, const char *data, size_t stripesCount);
+} // namespace NEO
@@ -9,10 +9,15 @@
 
 #include "runtime/os_interface/debug_settings_manager.h"
 
+#include <algorithm>
 #include <cstdint>
 
 using namespace NEO;
 
+KmdNotifyHelper::KmdNotifyHelper(const KmdNotifyProperties *properties) : properties(properties) {
+    adaptiveWaitEnabled = DebugManager.flags.EnableAdaptiveWait.get();
+}
+
 bool KmdNotifyHelper::obtainTimeoutParams(int64_t &timeoutValueOutput,
                                           bool quickKmdSleepRequest,
                                           uint32_t currentHwTag,
@@ -43,7 +48,14 @@ bool KmdNotifyHelper::obtainTimeoutParams(int64_t &timeoutValueOutput,
         timeoutValueOutput = getBaseTimeout(multiplier);
     }
 
-    return (properties->enableKmdNotify || !acLineConnected);
+    bool enableTimeout = (properties->enableKmdNotify || !acLineConnected);
+    if (adaptiveWaitEnabled) {
+        // learned spin bounds the polling window, also on platforms where the base policy never parks
+        auto adaptiveSpinTimeout = getAdaptiveSpinTimeout();
+        timeoutValueOutput = enableTimeout ? std::min(timeoutValueOutput, adaptiveSpinTimeout) : adaptiveSpinTimeout;
+        return true;
+    }
+    return enableTimeout;
 }
 
 bool KmdNotifyHelper::applyQuickKmdSleepForSporadicWait() const {
@@ -65,6 +77,72 @@ int64_t KmdNotifyHelper::getMicrosecondsSinceEpoch() const {
     return std::chrono::duration_cast<std::chrono::microseconds>(now).count();
 }
 
+int64_t KmdNotifyHelper::getAdaptiveSpinTimeout() const {
+    auto expectedLatency = expectedCompletionLatencyUs.load(std::memory_order_relaxed);
+    if (expectedLatency < 0) {
+        return AdaptiveWaitConstants::initialSpinMicroseconds;
+    }
+    if (expectedLatency > AdaptiveWaitConstants::maxSpinMicroseconds) {
+        // spinning would not reach completion anyway, park almost immediately;
+        // every few waits spin the full limit so that shorter tasks are noticed again
+        if ((++parkedWaits % AdaptiveWaitConstants::probeWaitInterval) == 0u) {
+            return AdaptiveWaitConstants::maxSpinMicroseconds;
+        }
+        return AdaptiveWaitConstants::minSpinMicroseconds;
+    }
+    auto spinTimeout = 2 * expectedLatency;
+    if (spinTimeout < AdaptiveWaitConstants::minSpinMicroseconds) {
+        return AdaptiveWaitConstants::minSpinMicroseconds;
+    }
+    if (spinTimeout > AdaptiveWaitConstants::maxSpinMicroseconds) {
+        return AdaptiveWaitConstants::maxSpinMicroseconds;
+    }
+    return spinTimeout;
+}
+
+void KmdNotifyHelper::recordWaitCompletion(bool completedWhileSpinning, int64_t spinLatencyUs, int64_t wakeUpLatencyUs) {
+    auto expectedLatency = expectedCompletionLatencyUs.load(std::memory_order_relaxed);
+    int64_t taskLatencySample = 0;
+    if (completedWhileSpinning) {
+        spinCompletions++;
+        spinLatencyHistogram[getLatencyHistogramBucket(spinLatencyUs)]++;
+        taskLatencySample = spinLatencyUs;
+    } else {
+        parkedCompletions++;
+        wakeUpLatencyHistogram[getLatencyHistogramBucket(wakeUpLatencyUs)]++;
+        // time spent parked depends on the KMD wake up, the task only is known to be longer than the spin
+        if (expectedLatency >= 0 && spinLatencyUs < expectedLatency) {
+            return;
+        }
+        taskLatencySample = 2 * std::max(spinLatencyUs, AdaptiveWaitConstants::minSpinMicroseconds);
+    }
+
+    // exponential moving average with 1/8 weight of the newest sample, races between waiters only lose a sample
+    auto newExpectedLatency = expectedLatency < 0 ? taskLatencySample : expectedLatency + (taskLatencySample - expectedLatency) / 8;
+    expectedCompletionLatencyUs.store(newExpectedLatency, std::memory_order_relaxed);
+}
+
+AdaptiveWaitStatistics KmdNotifyHelper::getAdaptiveWaitStatistics() const {
+    AdaptiveWaitStatistics statistics;
+    statistics.spinCompletions = spinCompletions.load();
+    statistics.parkedCompletions = parkedCompletions.load();
+    statistics.expectedCompletionLatencyUs = expectedCompletionLatencyUs.load();
+    for (uint32_t i = 0; i < AdaptiveWaitConstants::latencyHistogramBuckets; i++) {
+        statistics.spinLatencyHistogram[i] = spinLatencyHistogram[i].load();
+        statistics.wakeUpLatencyHistogram[i] = wakeUpLatencyHistogram[i].load();
+    }
+    return statistics;
+}
+
+uint32_t KmdNotifyHelper::getLatencyHistogramBucket(int64_t latencyUs) {
+    uint32_t bucket = 0;
+    while (latencyUs > 0 && bucket < AdaptiveWaitConstants::latencyHistogramBuckets - 1) {
+        latencyUs >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
 void KmdNotifyHelper::overrideFromDebugVariable(int32_t debugVariableValue, int64_t &destination) {
     if (debugVariableValue >= 0) {
         destination = static_cast<int64_t>(debugVariableValue);
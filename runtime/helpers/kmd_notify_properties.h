@@ -8,6 +8,7 @@
 #pragma once
 #include "runtime/helpers/completion_stamp.h"
 
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <cstdint>
@@ -30,10 +31,27 @@ constexpr int64_t timeoutInMicrosecondsForDisconnectedAcLine = 10000;
 constexpr uint32_t minimumTaskCountDiffToCheckAcLine = 10;
 } // namespace KmdNotifyConstants
 
+namespace AdaptiveWaitConstants {
+constexpr int64_t initialSpinMicroseconds = 100;
+constexpr int64_t minSpinMicroseconds = 1;
+constexpr int64_t maxSpinMicroseconds = 1000;
+constexpr uint32_t latencyHistogramBuckets = 16;
+constexpr uint32_t probeWaitInterval = 16;
+} // namespace AdaptiveWaitConstants
+
+// Bucket 0 counts latencies below 1us, bucket n counts [2^(n-1), 2^n) us, the last one everything above
+struct AdaptiveWaitStatistics {
+    uint64_t spinCompletions = 0;
+    uint64_t parkedCompletions = 0;
+    int64_t expectedCompletionLatencyUs = -1;
+    std::array<uint64_t, AdaptiveWaitConstants::latencyHistogramBuckets> spinLatencyHistogram = {};
+    std::array<uint64_t, AdaptiveWaitConstants::latencyHistogramBuckets> wakeUpLatencyHistogram = {};
+};
+
 class KmdNotifyHelper {
   public:
     KmdNotifyHelper() = delete;
-    KmdNotifyHelper(const KmdNotifyProperties *properties) : properties(properties){};
+    KmdNotifyHelper(const KmdNotifyProperties *properties);
     MOCKABLE_VIRTUAL ~KmdNotifyHelper() = default;
 
     bool obtainTimeoutParams(int64_t &timeoutValueOutput,
@@ -50,11 +68,27 @@ class KmdNotifyHelper {
     static void overrideFromDebugVariable(int32_t debugVariableValue, int64_t &destination);
     static void overrideFromDebugVariable(int32_t debugVariableValue, bool &destination);
 
+    // Adaptive wait learns the task latency of recent waits from the time spent spinning, spins only
+    // when completion is expected within the spin limit and parks on the KMD wait otherwise
+    bool isAdaptiveWaitEnabled() const { return adaptiveWaitEnabled; }
+    int64_t getAdaptiveSpinTimeout() const;
+    void recordWaitCompletion(bool completedWhileSpinning, int64_t spinLatencyUs, int64_t wakeUpLatencyUs);
+    AdaptiveWaitStatistics getAdaptiveWaitStatistics() const;
+    static uint32_t getLatencyHistogramBucket(int64_t latencyUs);
+
   protected:
     bool applyQuickKmdSleepForSporadicWait() const;
     int64_t getBaseTimeout(const int64_t &multiplier) const;
     int64_t getMicrosecondsSinceEpoch() const;
 
+    bool adaptiveWaitEnabled = false;
+    std::atomic<int64_t> expectedCompletionLatencyUs{-1};
+    mutable std::atomic<uint32_t> parkedWaits{0};
+    std::atomic<uint64_t> spinCompletions{0};
+    std::atomic<uint64_t> parkedCompletions{0};
+    std::array<std::atomic<uint64_t>, AdaptiveWaitConstants::latencyHistogramBuckets> spinLatencyHistogram = {};
+    std::array<std::atomic<uint64_t>, AdaptiveWaitConstants::latencyHistogramBuckets> wakeUpLatencyHistogram = {};
+
     const KmdNotifyProperties *properties = nullptr;
     std::atomic<int64_t> lastWaitForCompletionTimestampUs{0};
     std::atomic<bool> acLineConnected{true};
@@ -9,6 +9,7 @@
 
 #include "core/command_stream/linear_stream.h"
 #include "core/helpers/debug_helpers.h"
+#include "runtime/command_queue/local_ids_cache.h"
 
 #include <array>
 
@@ -20,7 +21,8 @@ size_t PerThreadDataHelper::sendPerThreadData(
     uint32_t numChannels,
     const size_t localWorkSizes[3],
     const std::array<uint8_t, 3> &workgroupWalkOrder,
-    bool hasKernelOnlyImages) {
+    bool hasKernelOnlyImages,
+    LocalIdsCache *localIdsCache) {
     auto offsetPerThreadData = indirectHeap.getUsed();
     if (numChannels) {
         auto localWorkSize = localWorkSizes[0] * localWorkSizes[1] * localWorkSizes[2];
@@ -29,12 +31,15 @@ size_t PerThreadDataHelper::sendPerThreadData(
 
         // Generate local IDs
         DEBUG_BREAK_IF(numChannels != 3);
-        generateLocalIDs(pDest, static_cast<uint16_t>(simd),
-                         std::array<uint16_t, 3>{{static_cast<uint16_t>(localWorkSizes[0]),
+        std::array<uint16_t, 3> workgroupSize = {{static_cast<uint16_t>(localWorkSizes[0]),
                                                   static_cast<uint16_t>(localWorkSizes[1]),
-                                                  static_cast<uint16_t>(localWorkSizes[2])}},
-                         std::array<uint8_t, 3>{{workgroupWalkOrder[0], workgroupWalkOrder[1], workgroupWalkOrder[2]}},
-                         hasKernelOnlyImages);
+                                                  static_cast<uint16_t>(localWorkSizes[2])}};
+        std::array<uint8_t, 3> walkOrder = {{workgroupWalkOrder[0], workgroupWalkOrder[1], workgroupWalkOrder[2]}};
+        if (localIdsCache) {
+            localIdsCache->setLocalIds(pDest, sizePerThreadDataTotal, static_cast<uint16_t>(simd), workgroupSize, walkOrder, hasKernelOnlyImages);
+        } else {
+            generateLocalIDs(pDest, static_cast<uint16_t>(simd), workgroupSize, walkOrder, hasKernelOnlyImages);
+        }
     }
     return offsetPerThreadData;
 }
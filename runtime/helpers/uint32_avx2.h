@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "core/helpers/debug_helpers.h"
+
+#include <cstdint>
+#include <immintrin.h>
+
+namespace NEO {
+
+#if __AVX2__
+struct uint32x8_t {
+    enum { numChannels = 8 };
+
+    __m256i value;
+
+    uint32x8_t() {
+        value = _mm256_setzero_si256();
+    }
+
+    uint32x8_t(__m256i value) : value(value) {
+    }
+
+    uint32x8_t(uint32_t a) {
+        value = _mm256_set1_epi32(a); //AVX
+    }
+
+    inline uint32_t get(unsigned int element) {
+        DEBUG_BREAK_IF(element >= numChannels);
+        return reinterpret_cast<uint32_t *>(&value)[element];
+    }
+
+    inline void loadUnaligned(const void *ptr) {
+        value = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr)); //AVX
+    }
+
+    inline void storeUnaligned(void *ptr) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(ptr), value); //AVX
+    }
+
+    inline uint32x8_t &operator+=(const uint32x8_t &a) {
+        value = _mm256_add_epi32(value, a.value); //AVX2
+        return *this;
+    }
+
+    inline uint32x8_t &operator*=(const uint32x8_t &a) {
+        value = _mm256_mullo_epi32(value, a.value); //AVX2
+        return *this;
+    }
+
+    inline uint32x8_t &operator^=(const uint32x8_t &a) {
+        value = _mm256_xor_si256(value, a.value); //AVX2
+        return *this;
+    }
+
+    inline uint32x8_t &rotateLeft(int bits) {
+        value = _mm256_or_si256(_mm256_sll_epi32(value, _mm_cvtsi32_si128(bits)),
+                                _mm256_srl_epi32(value, _mm_cvtsi32_si128(32 - bits))); //AVX2
+        return *this;
+    }
+};
+#endif // __AVX2__
+} // namespace NEO
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "core/helpers/debug_helpers.h"
+
+#include <cstdint>
+#include <immintrin.h>
+
+namespace NEO {
+
+struct uint32x4_t {
+    enum { numChannels = 4 };
+
+    __m128i value;
+
+    uint32x4_t() {
+        value = _mm_setzero_si128();
+    }
+
+    uint32x4_t(__m128i value) : value(value) {
+    }
+
+    uint32x4_t(uint32_t a) {
+        value = _mm_set1_epi32(a); //SSE2
+    }
+
+    inline uint32_t get(unsigned int element) {
+        DEBUG_BREAK_IF(element >= numChannels);
+        return reinterpret_cast<uint32_t *>(&value)[element];
+    }
+
+    inline void loadUnaligned(const void *ptr) {
+        value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr)); //SSE2
+    }
+
+    inline void storeUnaligned(void *ptr) {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(ptr), value); //SSE2
+    }
+
+    inline uint32x4_t &operator+=(const uint32x4_t &a) {
+        value = _mm_add_epi32(value, a.value); //SSE2
+        return *this;
+    }
+
+    inline uint32x4_t &operator*=(const uint32x4_t &a) {
+        value = _mm_mullo_epi32(value, a.value); //SSE4.1
+        return *this;
+    }
+
+    inline uint32x4_t &operator^=(const uint32x4_t &a) {
+        value = _mm_xor_si128(value, a.value); //SSE2
+        return *this;
+    }
+
+    inline uint32x4_t &rotateLeft(int bits) {
+        value = _mm_or_si128(_mm_sll_epi32(value, _mm_cvtsi32_si128(bits)),
+                             _mm_srl_epi32(value, _mm_cvtsi32_si128(32 - bits))); //SSE2
+        return *this;
+    }
+};
+} // namespace NEO
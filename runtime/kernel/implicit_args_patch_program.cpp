@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/kernel/implicit_args_patch_program.h"
+
+#include "core/helpers/debug_helpers.h"
+#include "core/helpers/ptr_math.h"
+#include "runtime/program/kernel_info.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+void ImplicitArgsPatchProgram::addOp(uint32_t crossThreadDataOffset, uint32_t source) {
+    if (crossThreadDataOffset == WorkloadInfo::undefinedOffset) {
+        return;
+    }
+    ops.push_back({crossThreadDataOffset, source});
+    requiredCrossThreadDataSize = std::max(requiredCrossThreadDataSize, crossThreadDataOffset + static_cast<uint32_t>(sizeof(uint32_t)));
+}
+
+void ImplicitArgsPatchProgram::build(const WorkloadInfo &workloadInfo) {
+    ops.clear();
+    requiredCrossThreadDataSize = 0u;
+
+    for (uint32_t dim = 0; dim < 3; dim++) {
+        addOp(workloadInfo.globalWorkOffsetOffsets[dim], GlobalWorkOffsetX + dim);
+        addOp(workloadInfo.globalWorkSizeOffsets[dim], GlobalWorkSizeX + dim);
+        addOp(workloadInfo.localWorkSizeOffsets2[dim], LocalWorkSizeX + dim);
+        addOp(workloadInfo.enqueuedLocalWorkSizeOffsets[dim], EnqueuedLocalWorkSizeX + dim);
+    }
+    addOp(workloadInfo.workDimOffset, WorkDim);
+
+    // first local work size is patched for every dispatch only when the kernel has no second one
+    bool localWorkSizeForMainKernelOnly = workloadInfo.localWorkSizeOffsets2[0] != WorkloadInfo::undefinedOffset;
+    if (!localWorkSizeForMainKernelOnly) {
+        for (uint32_t dim = 0; dim < 3; dim++) {
+            addOp(workloadInfo.localWorkSizeOffsets[dim], LocalWorkSizeX + dim);
+        }
+    }
+    numUnconditionalOps = ops.size();
+
+    if (localWorkSizeForMainKernelOnly) {
+        for (uint32_t dim = 0; dim < 3; dim++) {
+            addOp(workloadInfo.localWorkSizeOffsets[dim], LocalWorkSizeX + dim);
+        }
+    }
+    for (uint32_t dim = 0; dim < 3; dim++) {
+        addOp(workloadInfo.numWorkGroupsOffset[dim], NumWorkGroupsX + dim);
+    }
+}
+
+void ImplicitArgsPatchProgram::apply(char *crossThreadData, uint32_t crossThreadDataSize, const uint32_t (&values)[NumSources], bool isMainKernel) const {
+    UNRECOVERABLE_IF(crossThreadDataSize < requiredCrossThreadDataSize);
+
+    auto opsCount = isMainKernel ? ops.size() : numUnconditionalOps;
+    auto op = ops.data();
+    for (size_t i = 0; i < opsCount; i++, op++) {
+        *reinterpret_cast<uint32_t *>(ptrOffset(crossThreadData, op->crossThreadDataOffset)) = values[op->source];
+    }
+}
+} // namespace NEO
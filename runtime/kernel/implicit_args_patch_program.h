@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace NEO {
+struct WorkloadInfo;
+
+// Flat list of cross thread data writes for implicit kernel arguments, built once per kernel.
+// At dispatch all values are gathered to one array and only the offsets used by the kernel are written.
+class ImplicitArgsPatchProgram {
+  public:
+    enum Source : uint32_t {
+        GlobalWorkOffsetX,
+        GlobalWorkOffsetY,
+        GlobalWorkOffsetZ,
+        GlobalWorkSizeX,
+        GlobalWorkSizeY,
+        GlobalWorkSizeZ,
+        LocalWorkSizeX,
+        LocalWorkSizeY,
+        LocalWorkSizeZ,
+        EnqueuedLocalWorkSizeX,
+        EnqueuedLocalWorkSizeY,
+        EnqueuedLocalWorkSizeZ,
+        NumWorkGroupsX,
+        NumWorkGroupsY,
+        NumWorkGroupsZ,
+        WorkDim,
+        NumSources
+    };
+
+    struct PatchOp {
+        uint32_t crossThreadDataOffset;
+        uint32_t source;
+    };
+
+    void build(const WorkloadInfo &workloadInfo);
+    void apply(char *crossThreadData, uint32_t crossThreadDataSize, const uint32_t (&values)[NumSources], bool isMainKernel) const;
+
+    const std::vector<PatchOp> &getOps() const { return ops; }
+    size_t getNumUnconditionalOps() const { return numUnconditionalOps; }
+    uint32_t getRequiredCrossThreadDataSize() const { return requiredCrossThreadDataSize; }
+
+  protected:
+    void addOp(uint32_t crossThreadDataOffset, uint32_t source);
+
+    // ops applied to every dispatch come first, ops applied to the main kernel only follow them
+    std::vector<PatchOp> ops;
+    size_t numUnconditionalOps = 0u;
+    uint32_t requiredCrossThreadDataSize = 0u;
+};
+} // namespace NEO
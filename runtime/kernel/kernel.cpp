@@ -239,6 +239,11 @@ cl_int Kernel::initialize() {
             *dataParameterSimdSize = getKernelInfo().getMaxSimdSize();
             *preferredWkgMultipleOffset = getKernelInfo().getMaxSimdSize();
             *parentEventOffset = WorkloadInfo::invalidParentEvent;
+
+            if (DebugManager.flags.EnableImplicitArgsPatchProgram.get()) {
+                implicitArgsPatchProgram = std::make_unique<ImplicitArgsPatchProgram>();
+                implicitArgsPatchProgram->build(workloadInfo);
+            }
         }
 
         // allocate our own SSH, if necessary
@@ -1019,16 +1024,18 @@ void Kernel::makeResident(CommandStreamReceiver &commandStreamReceiver) {
         commandStreamReceiver.makeResident(*(program->getExportedFunctionsSurface()));
     }
 
-    for (auto gfxAlloc : kernelSvmGfxAllocations) {
-        commandStreamReceiver.makeResident(*gfxAlloc);
+    if (!kernelSvmGfxAllocations.empty()) {
+        commandStreamReceiver.makeAllocationsResident(kernelSvmGfxAllocations);
     }
 
     auto pageFaultManager = program->peekExecutionEnvironment().memoryManager->getPageFaultManager();
 
-    for (auto gfxAlloc : kernelUnifiedMemoryGfxAllocations) {
-        commandStreamReceiver.makeResident(*gfxAlloc);
+    if (!kernelUnifiedMemoryGfxAllocations.empty()) {
+        commandStreamReceiver.makeAllocationsResident(kernelUnifiedMemoryGfxAllocations);
         if (pageFaultManager) {
-            pageFaultManager->moveAllocationToGpuDomain(reinterpret_cast<void *>(gfxAlloc->getGpuAddress()));
+            for (auto gfxAlloc : kernelUnifiedMemoryGfxAllocations) {
+                pageFaultManager->moveAllocationToGpuDomain(reinterpret_cast<void *>(gfxAlloc->getGpuAddress()));
+            }
         }
     }
 
@@ -14,6 +14,7 @@
 #include "runtime/helpers/address_patch.h"
 #include "runtime/helpers/base_object.h"
 #include "runtime/helpers/properties_helper.h"
+#include "runtime/kernel/implicit_args_patch_program.h"
 #include "runtime/os_interface/debug_settings_manager.h"
 #include "runtime/program/kernel_info.h"
 #include "runtime/program/program.h"
@@ -115,6 +116,10 @@ class Kernel : public BaseObject<_cl_kernel> {
         return crossThreadDataSize;
     }
 
+    const ImplicitArgsPatchProgram *getImplicitArgsPatchProgram() const {
+        return implicitArgsPatchProgram.get();
+    }
+
     cl_int initialize();
 
     MOCKABLE_VIRTUAL cl_int cloneKernel(Kernel *pSourceKernel);
@@ -523,6 +528,7 @@ class Kernel : public BaseObject<_cl_kernel> {
 
     std::vector<PatchInfoData> patchInfoDataList;
     std::unique_ptr<ImageTransformer> imageTransformer;
+    std::unique_ptr<ImplicitArgsPatchProgram> implicitArgsPatchProgram;
 
     bool specialPipelineSelectMode = false;
     bool svmAllocationsRequireCacheFlush = false;
@@ -8,7 +8,9 @@
 #pragma once
 #include "core/memory_manager/graphics_allocation.h"
 
+#include <array>
 #include <mutex>
+#include <vector>
 
 namespace NEO {
 class CommandStreamReceiver;
@@ -20,4 +22,58 @@ class AllocationsList : public IDList<GraphicsAllocation, true, true> {
   private:
     GraphicsAllocation *detachAllocationImpl(GraphicsAllocation *, void *);
 };
+
+struct ReuseCounters {
+    uint64_t hits = 0u;
+    uint64_t misses = 0u;
+    uint64_t evictions = 0u;
+};
+
+// Allocations list indexed by allocation type and power-of-two size class.
+// Each bucket keeps allocations already completed by the CSR separately from
+// the pending ones ordered by task count, so a reusable allocation is found
+// without walking the whole list. The list itself stays the owner of the nodes;
+// list modifiers that would bypass the index are not accessible.
+class ReusableAllocationsList : public AllocationsList {
+  public:
+    void pushAllocation(GraphicsAllocation &allocation, uint32_t contextId);
+    std::unique_ptr<GraphicsAllocation> detachAllocation(size_t requiredMinimalSize, CommandStreamReceiver &commandStreamReceiver, GraphicsAllocation::AllocationType allocationType);
+    GraphicsAllocation *detachAllocationsUpToTaskCount(uint32_t taskCount, uint32_t contextId);
+
+    const ReuseCounters &getReuseCounters() const { return reuseCounters; }
+
+  protected:
+    using AllocationsList::deleteAll;
+    using AllocationsList::detachNodes;
+    using AllocationsList::detachSequence;
+    using AllocationsList::pushFrontOne;
+    using AllocationsList::pushTailOne;
+    using AllocationsList::removeFrontOne;
+    using AllocationsList::removeOne;
+    using AllocationsList::splice;
+
+    static constexpr uint32_t sizeClassesCount = 64u;
+
+    struct Bucket {
+        std::vector<GraphicsAllocation *> completed;
+        std::vector<GraphicsAllocation *> pending;
+    };
+
+    struct TypeBuckets {
+        uint64_t nonEmptySizeClasses = 0u;
+        std::array<Bucket, sizeClassesCount> sizeClasses;
+    };
+
+    static uint32_t getSizeClass(size_t size);
+    TypeBuckets &getTypeBuckets(GraphicsAllocation::AllocationType allocationType);
+    void indexAllocation(GraphicsAllocation &allocation, uint32_t contextId);
+    GraphicsAllocation *takeFromBucket(TypeBuckets &typeBuckets, uint32_t sizeClass, size_t requiredMinimalSize, uint32_t currentTagValue, uint32_t contextId);
+
+    GraphicsAllocation *pushAllocationImpl(GraphicsAllocation *allocation, void *data);
+    GraphicsAllocation *detachAllocationImpl(GraphicsAllocation *, void *data);
+    GraphicsAllocation *detachAllocationsUpToTaskCountImpl(GraphicsAllocation *, void *data);
+
+    std::vector<std::unique_ptr<TypeBuckets>> typeBuckets;
+    ReuseCounters reuseCounters;
+};
 } // namespace NEO
@@ -7,11 +7,14 @@
 
 #include "runtime/memory_manager/internal_allocation_storage.h"
 
+#include "core/helpers/basic_math.h"
 #include "core/memory_manager/host_ptr_manager.h"
 #include "runtime/command_stream/command_stream_receiver.h"
 #include "runtime/memory_manager/memory_manager.h"
 #include "runtime/os_interface/os_context.h"
 
+#include <algorithm>
+
 namespace NEO {
 InternalAllocationStorage::InternalAllocationStorage(CommandStreamReceiver &commandStreamReceiver) : commandStreamReceiver(commandStreamReceiver){};
 void InternalAllocationStorage::storeAllocation(std::unique_ptr<GraphicsAllocation> gfxAllocation, uint32_t allocationUsage) {
@@ -30,13 +33,32 @@ void InternalAllocationStorage::storeAllocationWithTaskCount(std::unique_ptr<Gra
             return;
         }
     }
-    auto &allocationsList = (allocationUsage == TEMPORARY_ALLOCATION) ? temporaryAllocations : allocationsForReuse;
-    gfxAllocation->updateTaskCount(taskCount, commandStreamReceiver.getOsContext().getContextId());
-    allocationsList.pushTailOne(*gfxAllocation.release());
+    auto contextId = commandStreamReceiver.getOsContext().getContextId();
+    gfxAllocation->updateTaskCount(taskCount, contextId);
+    if (allocationUsage == TEMPORARY_ALLOCATION) {
+        temporaryAllocations.pushTailOne(*gfxAllocation.release());
+    } else {
+        allocationsForReuse.pushAllocation(*gfxAllocation.release(), contextId);
+    }
 }
 
 void InternalAllocationStorage::cleanAllocationList(uint32_t waitTaskCount, uint32_t allocationUsage) {
-    freeAllocationsList(waitTaskCount, (allocationUsage == TEMPORARY_ALLOCATION) ? temporaryAllocations : allocationsForReuse);
+    if (allocationUsage == TEMPORARY_ALLOCATION) {
+        freeAllocationsList(waitTaskCount, temporaryAllocations);
+        return;
+    }
+    auto allocationsToFree = allocationsForReuse.detachAllocationsUpToTaskCount(waitTaskCount, commandStreamReceiver.getOsContext().getContextId());
+    if (allocationsToFree == nullptr) {
+        return;
+    }
+
+    auto memoryManager = commandStreamReceiver.getMemoryManager();
+    auto lock = memoryManager->getHostPtrManager()->obtainOwnership();
+    while (allocationsToFree != nullptr) {
+        auto *next = allocationsToFree->next;
+        memoryManager->freeGraphicsMemory(allocationsToFree);
+        allocationsToFree = next;
+    }
 }
 
 void InternalAllocationStorage::freeAllocationsList(uint32_t waitTaskCount, AllocationsList &allocationsList) {
@@ -99,4 +121,144 @@ GraphicsAllocation *AllocationsList::detachAllocationImpl(GraphicsAllocation *,
     return nullptr;
 }
 
+void ReusableAllocationsList::pushAllocation(GraphicsAllocation &allocation, uint32_t contextId) {
+    processLocked<ReusableAllocationsList, &ReusableAllocationsList::pushAllocationImpl>(&allocation, &contextId);
+}
+
+std::unique_ptr<GraphicsAllocation> ReusableAllocationsList::detachAllocation(size_t requiredMinimalSize, CommandStreamReceiver &commandStreamReceiver, GraphicsAllocation::AllocationType allocationType) {
+    ReusableAllocationRequirements req;
+    req.requiredMinimalSize = requiredMinimalSize;
+    req.csrTagAddress = commandStreamReceiver.getTagAddress();
+    req.allocationType = allocationType;
+    req.contextId = commandStreamReceiver.getOsContext().getContextId();
+    GraphicsAllocation *retAlloc = processLocked<ReusableAllocationsList, &ReusableAllocationsList::detachAllocationImpl>(nullptr, static_cast<void *>(&req));
+    return std::unique_ptr<GraphicsAllocation>(retAlloc);
+}
+
+GraphicsAllocation *ReusableAllocationsList::detachAllocationsUpToTaskCount(uint32_t taskCount, uint32_t contextId) {
+    std::pair<uint32_t, uint32_t> taskCountAndContextId(taskCount, contextId);
+    return processLocked<ReusableAllocationsList, &ReusableAllocationsList::detachAllocationsUpToTaskCountImpl>(nullptr, &taskCountAndContextId);
+}
+
+uint32_t ReusableAllocationsList::getSizeClass(size_t size) {
+    return (size == 0u) ? 0u : Math::log2(static_cast<uint64_t>(size));
+}
+
+ReusableAllocationsList::TypeBuckets &ReusableAllocationsList::getTypeBuckets(GraphicsAllocation::AllocationType allocationType) {
+    auto typeIndex = static_cast<size_t>(allocationType);
+    if (typeIndex >= typeBuckets.size()) {
+        typeBuckets.resize(typeIndex + 1);
+    }
+    if (typeBuckets[typeIndex] == nullptr) {
+        typeBuckets[typeIndex] = std::make_unique<TypeBuckets>();
+    }
+    return *typeBuckets[typeIndex];
+}
+
+void ReusableAllocationsList::indexAllocation(GraphicsAllocation &allocation, uint32_t contextId) {
+    auto &buckets = getTypeBuckets(allocation.getAllocationType());
+    auto sizeClass = getSizeClass(allocation.getUnderlyingBufferSize());
+    auto &pending = buckets.sizeClasses[sizeClass].pending;
+
+    // Keep pending allocations ordered by task count; they are stored with growing task counts in the common case
+    auto taskCount = allocation.getTaskCount(contextId);
+    auto position = pending.end();
+    while (position != pending.begin() && (*(position - 1))->getTaskCount(contextId) > taskCount) {
+        position--;
+    }
+    pending.insert(position, &allocation);
+    buckets.nonEmptySizeClasses |= (1ull << sizeClass);
+}
+
+GraphicsAllocation *ReusableAllocationsList::takeFromBucket(TypeBuckets &buckets, uint32_t sizeClass, size_t requiredMinimalSize, uint32_t currentTagValue, uint32_t contextId) {
+    auto &bucket = buckets.sizeClasses[sizeClass];
+
+    auto firstPending = bucket.pending.begin();
+    while (firstPending != bucket.pending.end() && (*firstPending)->getTaskCount(contextId) <= currentTagValue) {
+        bucket.completed.push_back(*firstPending);
+        firstPending++;
+    }
+    bucket.pending.erase(bucket.pending.begin(), firstPending);
+
+    // only the most recently completed allocation is checked, allocations from higher size classes always fit
+    GraphicsAllocation *allocation = nullptr;
+    if (!bucket.completed.empty() && bucket.completed.back()->getUnderlyingBufferSize() >= requiredMinimalSize) {
+        allocation = bucket.completed.back();
+        bucket.completed.pop_back();
+    }
+
+    if (bucket.completed.empty() && bucket.pending.empty()) {
+        buckets.nonEmptySizeClasses &= ~(1ull << sizeClass);
+    }
+    return allocation;
+}
+
+GraphicsAllocation *ReusableAllocationsList::pushAllocationImpl(GraphicsAllocation *allocation, void *data) {
+    indexAllocation(*allocation, *static_cast<uint32_t *>(data));
+    return pushTailOneImpl(allocation, nullptr);
+}
+
+GraphicsAllocation *ReusableAllocationsList::detachAllocationImpl(GraphicsAllocation *, void *data) {
+    ReusableAllocationRequirements *req = static_cast<ReusableAllocationRequirements *>(data);
+    auto typeIndex = static_cast<size_t>(req->allocationType);
+    if (typeIndex < typeBuckets.size() && typeBuckets[typeIndex] != nullptr) {
+        auto &buckets = *typeBuckets[typeIndex];
+        auto currentTagValue = *req->csrTagAddress;
+        auto candidateSizeClasses = buckets.nonEmptySizeClasses & (~0ull << getSizeClass(req->requiredMinimalSize));
+        while (candidateSizeClasses != 0u) {
+            auto sizeClass = Math::getLowestSetBit(candidateSizeClasses);
+            auto allocation = takeFromBucket(buckets, sizeClass, req->requiredMinimalSize, currentTagValue, req->contextId);
+            if (allocation != nullptr) {
+                reuseCounters.hits++;
+                return removeOneImpl(allocation, nullptr);
+            }
+            candidateSizeClasses &= candidateSizeClasses - 1;
+        }
+    }
+    reuseCounters.misses++;
+    return nullptr;
+}
+
+GraphicsAllocation *ReusableAllocationsList::detachAllocationsUpToTaskCountImpl(GraphicsAllocation *, void *data) {
+    auto taskCountAndContextId = static_cast<std::pair<uint32_t, uint32_t> *>(data);
+    auto taskCount = taskCountAndContextId->first;
+    auto contextId = taskCountAndContextId->second;
+
+    IDList<GraphicsAllocation, false, false> allocationsToFree;
+    auto *curr = head;
+    while (curr != nullptr) {
+        auto *next = curr->next;
+        if (curr->getTaskCount(contextId) <= taskCount) {
+            allocationsToFree.pushTailOne(*removeOneImpl(curr, nullptr));
+            reuseCounters.evictions++;
+        }
+        curr = next;
+    }
+
+    if (allocationsToFree.peekIsEmpty()) {
+        return nullptr;
+    }
+
+    // evicted allocations are dropped from the index, remaining pending allocations keep their order
+    auto isEvicted = [taskCount, contextId](GraphicsAllocation *allocation) { return allocation->getTaskCount(contextId) <= taskCount; };
+    for (auto &buckets : typeBuckets) {
+        if (buckets == nullptr) {
+            continue;
+        }
+        auto nonEmptySizeClasses = buckets->nonEmptySizeClasses;
+        while (nonEmptySizeClasses != 0u) {
+            auto sizeClass = Math::getLowestSetBit(nonEmptySizeClasses);
+            auto &bucket = buckets->sizeClasses[sizeClass];
+            bucket.completed.erase(std::remove_if(bucket.completed.begin(), bucket.completed.end(), isEvicted), bucket.completed.end());
+            bucket.pending.erase(std::remove_if(bucket.pending.begin(), bucket.pending.end(), isEvicted), bucket.pending.end());
+            if (bucket.completed.empty() && bucket.pending.empty()) {
+                buckets->nonEmptySizeClasses &= ~(1ull << sizeClass);
+            }
+            nonEmptySizeClasses &= nonEmptySizeClasses - 1;
+        }
+    }
+
+    return allocationsToFree.detachNodes();
+}
+
 } // namespace NEO
@@ -20,13 +20,14 @@ class InternalAllocationStorage {
     void storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation> gfxAllocation, uint32_t allocationUsage, uint32_t taskCount);
     std::unique_ptr<GraphicsAllocation> obtainReusableAllocation(size_t requiredSize, GraphicsAllocation::AllocationType allocationType);
     AllocationsList &getTemporaryAllocations() { return temporaryAllocations; }
-    AllocationsList &getAllocationsForReuse() { return allocationsForReuse; }
+    ReusableAllocationsList &getAllocationsForReuse() { return allocationsForReuse; }
+    const ReuseCounters &getReuseCounters() const { return allocationsForReuse.getReuseCounters(); }
 
   protected:
     void freeAllocationsList(uint32_t waitTaskCount, AllocationsList &allocationsList);
     CommandStreamReceiver &commandStreamReceiver;
 
     AllocationsList temporaryAllocations;
-    AllocationsList allocationsForReuse;
+    ReusableAllocationsList allocationsForReuse;
 };
 } // namespace NEO
@@ -40,6 +40,7 @@ MemoryManager::MemoryManager(ExecutionEnvironment &executionEnvironment) : execu
     if (DebugManager.flags.Enable64kbpages.get() > -1) {
         this->enable64kbpages = DebugManager.flags.Enable64kbpages.get() != 0;
     }
+    this->dirtyPageTrackingEnabled = DebugManager.flags.EnableAubDirtyPageTracking.get();
     localMemoryUsageBankSelector.reset(new LocalMemoryUsageBankSelector(getBanksCount()));
     gfxPartition = std::make_unique<GfxPartition>();
     if (this->localMemorySupported) {
@@ -149,6 +150,14 @@ void MemoryManager::freeGraphicsMemory(GraphicsAllocation *gfxAllocation) {
         freeAssociatedResourceImpl(*gfxAllocation);
     }
 
+    if (dirtyPageTrackingEnabled) {
+        for (auto &engine : registeredEngines) {
+            if (engine.commandStreamReceiver) {
+                engine.commandStreamReceiver->onAllocationFreed(*gfxAllocation);
+            }
+        }
+    }
+
     localMemoryUsageBankSelector->freeOnBanks(gfxAllocation->storageInfo.getMemoryBanks(), gfxAllocation->getUnderlyingBufferSize());
     freeGraphicsMemoryImpl(gfxAllocation);
 }
@@ -221,6 +221,7 @@ class MemoryManager {
     bool enable64kbpages = false;
     bool localMemorySupported = false;
     bool supportsMultiStorageResources = true;
+    bool dirtyPageTrackingEnabled = false;
     ExecutionEnvironment &executionEnvironment;
     EngineControlContainer registeredEngines;
     std::unique_ptr<HostPtrManager> hostPtrManager;
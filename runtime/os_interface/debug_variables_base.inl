@@ -86,6 +86,25 @@ DECLARE_DEBUG_VARIABLE(bool, DisableZeroCopyForUseHostPtr, false, "When active a
 DECLARE_DEBUG_VARIABLE(bool, DisableZeroCopyForBuffers, false, "When active all buffer allocations will not share memory with CPU.")
 DECLARE_DEBUG_VARIABLE(bool, EnableHostPtrTracking, true, "Enable host ptr tracking")
 DECLARE_DEBUG_VARIABLE(bool, DisableDcFlushInEpilogue, false, "Disable DC flush in epilogue")
+DECLARE_DEBUG_VARIABLE(bool, UseSegregatedHeapAllocator, false, "Use size class segregated free lists with O(1) allocate and free for GPU virtual address heaps")
+DECLARE_DEBUG_VARIABLE(bool, UseIndexedBinaryCache, false, "Keep program binary cache in a single memory mapped index file and packed data file instead of one file per binary")
+DECLARE_DEBUG_VARIABLE(int32_t, IndexedBinaryCacheSizeLimit, -1, "-1: default (256 MB), >=0: size limit of the indexed program binary cache in megabytes, least recently used binaries are evicted")
+DECLARE_DEBUG_VARIABLE(bool, EnableTagAllocatorThreadCache, false, "Serve timestamp and profiling tags from per-thread caches over a lock-free free stack, deferred tags are released in bulk up to the first incomplete one")
+DECLARE_DEBUG_VARIABLE(bool, EnableBatchedGemClose, false, "Queue buffer objects for the gem close worker on a lock-free list and close them in batches")
+DECLARE_DEBUG_VARIABLE(int32_t, GemCloseBatchSize, -1, "-1: default (64), >0: maximal number of buffer objects closed by the gem close worker in one batch")
+DECLARE_DEBUG_VARIABLE(bool, EnableAdaptiveWait, false, "Learn completion latency of recent waits per command stream receiver, spin only while completion is expected and then wait in KMD")
+DECLARE_DEBUG_VARIABLE(bool, EnableLocalIdsCache, false, "Reuse local IDs generated for previous dispatches with the same SIMD, local work size, walk order and image layout")
+DECLARE_DEBUG_VARIABLE(int32_t, LocalIdsCacheSize, -1, "-1: default (64), >0: maximal number of local ID sets cached per device")
+DECLARE_DEBUG_VARIABLE(bool, EnableImplicitArgsPatchProgram, false, "Patch implicit kernel arguments at dispatch with per kernel list of used cross thread data offsets")
+DECLARE_DEBUG_VARIABLE(int32_t, CompilerThreadPoolSize, 0, "0: programs are built on the calling thread, >0: number of worker threads (bounded by hardware threads) used for clBuildProgram with callback and per kernel binary decoding")
+DECLARE_DEBUG_VARIABLE(bool, EnableLazyKernelDecoding, false, "Index kernels at program load and decode patch tokens and upload ISA on first kernel creation")
+DECLARE_DEBUG_VARIABLE(int32_t, BatchedDispatchFlushCount, -1, "-1: default (16), >0: number of pending command buffers after which BatchedDispatchWithCounter mode flushes implicitly")
+DECLARE_DEBUG_VARIABLE(int32_t, BatchedDispatchFlushTimeoutMicroseconds, -1, "-1: default (disabled), >0: BatchedDispatchWithCounter mode flushes implicitly on next submission when the oldest pending command buffer waits longer")
+DECLARE_DEBUG_VARIABLE(bool, EnableCoalescedEventWaits, false, "Wait for submitted events with one blocking wait per command stream receiver on the highest task count in the wait list")
+DECLARE_DEBUG_VARIABLE(bool, EnableIterativeEventUnblocking, false, "Unblock child events from a per thread ready queue instead of recursing down event dependency chains")
+DECLARE_DEBUG_VARIABLE(bool, EnableAubDirtyPageTracking, false, "AUB and TBX modes: hash written 4KB pages and dump only pages whose contents changed since they were last written")
+DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpAsyncWriteBufferSize, -1, "-1: default (synchronous writes), >0: write AUB file from a background thread through buffers of given size in KB")
+DECLARE_DEBUG_VARIABLE(int32_t, TbxPipelinedWriteBufferSize, -1, "-1: default (send every message immediately), >0: collect TBX write messages in a buffer of given size in KB and send it before the next read")
 
 /*FEATURE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, EnableNV12, true, "Enables NV12 extension")
@@ -29,6 +29,8 @@
 
 namespace NEO {
 
+std::atomic<uint64_t> BufferObject::residencyEpochCounter{0u};
+
 BufferObject::BufferObject(Drm *drm, int handle) : drm(drm), refCount(1), handle(handle), isReused(false) {
     this->tiling_mode = I915_TILING_NONE;
     this->size = 0;
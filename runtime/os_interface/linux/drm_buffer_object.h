@@ -6,6 +6,9 @@
  */
 
 #pragma once
+#include "engine_limits.h"
+
+#include <array>
 #include <atomic>
 #include <cstddef>
 #include <stdint.h>
@@ -16,10 +19,12 @@ struct drm_i915_gem_relocation_entry;
 namespace NEO {
 
 class DrmMemoryManager;
+class DrmGemCloseWorker;
 class Drm;
 
 class BufferObject {
     friend DrmMemoryManager;
+    friend DrmGemCloseWorker;
 
   public:
     BufferObject(Drm *drm, int handle);
@@ -50,6 +55,11 @@ class BufferObject {
     uint64_t peekUnmapSize() const { return unmapSize; }
     bool peekIsReusableAllocation() const { return this->isReused; }
 
+    bool isInResidencyEpoch(uint32_t contextId, uint64_t epoch) const { return this->residencyEpochs[contextId] == epoch; }
+    void setResidencyEpoch(uint32_t contextId, uint64_t epoch) { this->residencyEpochs[contextId] = epoch; }
+    // epochs are unique in the process, so CSRs sharing an os context id never see each other's stamps
+    static uint64_t acquireResidencyEpoch() { return ++residencyEpochCounter; }
+
   protected:
     Drm *drm;
 
@@ -69,5 +79,13 @@ class BufferObject {
     void *lockedAddress; // CPU side virtual address
 
     uint64_t unmapSize = 0;
+
+    // Last residency epoch of each os context this BO was added to, used for O(1) dedup of exec objects
+    std::array<uint64_t, maxOsContextCount> residencyEpochs = {};
+
+    // Link in the gem close worker pending list
+    BufferObject *nextToClose = nullptr;
+
+    static std::atomic<uint64_t> residencyEpochCounter;
 };
 } // namespace NEO
@@ -7,6 +7,7 @@
 
 #pragma once
 #include "runtime/command_stream/device_command_stream.h"
+#include "runtime/os_interface/linux/drm_buffer_object.h"
 #include "runtime/os_interface/linux/drm_gem_close_worker.h"
 
 #include "drm/i915_drm.h"
@@ -39,6 +40,7 @@ class DrmCommandStreamReceiver : public DeviceCommandStreamReceiver<GfxFamily> {
 
     FlushStamp flush(BatchBuffer &batchBuffer, ResidencyContainer &allocationsForResidency) override;
     void makeResident(GraphicsAllocation &gfxAllocation) override;
+    void makeAllocationsResident(ArrayRef<GraphicsAllocation *const> gfxAllocations) override;
     void processResidency(const ResidencyContainer &allocationsForResidency) override;
     void makeNonResident(GraphicsAllocation &gfxAllocation) override;
     bool waitForFlushStamp(FlushStamp &flushStampToWait) override;
@@ -54,8 +56,10 @@ class DrmCommandStreamReceiver : public DeviceCommandStreamReceiver<GfxFamily> {
     void makeResident(BufferObject *bo);
     void flushInternal(const BatchBuffer &batchBuffer, const ResidencyContainer &allocationsForResidency);
     void exec(const BatchBuffer &batchBuffer, uint32_t drmContextId);
+    void clearResidency();
 
     std::vector<BufferObject *> residency;
+    uint64_t residencyEpoch = BufferObject::acquireResidencyEpoch();
     std::vector<drm_i915_gem_exec_object2> execObjectsStorage;
     Drm *drm;
     gemCloseWorkerMode gemCloseWorkerOperationMode;
@@ -91,7 +91,14 @@ void DrmCommandStreamReceiver<GfxFamily>::exec(const BatchBuffer &batchBuffer, u
                        this->execObjectsStorage.data());
     UNRECOVERABLE_IF(err != 0);
 
+    clearResidency();
+}
+
+template <typename GfxFamily>
+void DrmCommandStreamReceiver<GfxFamily>::clearResidency() {
+    // A new epoch invalidates all BO stamps at once, no need to walk the residency vector
     this->residency.clear();
+    this->residencyEpoch = BufferObject::acquireResidencyEpoch();
 }
 
 template <typename GfxFamily>
@@ -103,16 +110,26 @@ void DrmCommandStreamReceiver<GfxFamily>::makeResident(GraphicsAllocation &gfxAl
     CommandStreamReceiver::makeResident(gfxAllocation);
 }
 
+template <typename GfxFamily>
+void DrmCommandStreamReceiver<GfxFamily>::makeAllocationsResident(ArrayRef<GraphicsAllocation *const> gfxAllocations) {
+    auto submissionTaskCount = this->taskCount + 1;
+    auto contextId = osContext->getContextId();
+    for (auto gfxAllocation : gfxAllocations) {
+        if (gfxAllocation->getUnderlyingBufferSize() == 0) {
+            continue;
+        }
+        this->makeResidentForSubmission(*gfxAllocation, submissionTaskCount, contextId);
+    }
+}
+
 template <typename GfxFamily>
 void DrmCommandStreamReceiver<GfxFamily>::makeResident(BufferObject *bo) {
     if (bo) {
-        if (bo->peekIsReusableAllocation()) {
-            for (auto bufferObject : this->residency) {
-                if (bufferObject == bo) {
-                    return;
-                }
-            }
+        const auto osContextId = osContext->getContextId();
+        if (bo->isInResidencyEpoch(osContextId, this->residencyEpoch)) {
+            return;
         }
+        bo->setResidencyEpoch(osContextId, this->residencyEpoch);
 
         residency.push_back(bo);
     }
@@ -143,7 +160,7 @@ void DrmCommandStreamReceiver<GfxFamily>::makeNonResident(GraphicsAllocation &gf
     // If makeNonResident is called before flush, vector will be cleared.
     if (gfxAllocation.isResident(this->osContext->getContextId())) {
         if (this->residency.size() != 0) {
-            this->residency.clear();
+            clearResidency();
         }
         for (auto fragmentId = 0u; fragmentId < gfxAllocation.fragmentsStorage.fragmentCount; fragmentId++) {
             gfxAllocation.fragmentsStorage.fragmentStorageData[fragmentId].residency->resident[osContext->getContextId()] = false;
@@ -8,6 +8,7 @@
 #include "runtime/os_interface/linux/drm_gem_close_worker.h"
 
 #include "core/helpers/aligned_memory.h"
+#include "runtime/os_interface/debug_settings_manager.h"
 #include "runtime/os_interface/linux/drm_buffer_object.h"
 #include "runtime/os_interface/linux/drm_command_stream.h"
 #include "runtime/os_interface/linux/drm_memory_manager.h"
@@ -21,6 +22,13 @@
 namespace NEO {
 
 DrmGemCloseWorker::DrmGemCloseWorker(DrmMemoryManager &memoryManager) : memoryManager(memoryManager) {
+    batchedMode = DebugManager.flags.EnableBatchedGemClose.get();
+    if (DebugManager.flags.GemCloseBatchSize.get() > 0) {
+        batchSize = static_cast<uint32_t>(DebugManager.flags.GemCloseBatchSize.get());
+    }
+    // more than four batches waiting for the worker counts as backpressure
+    highWatermark = 4 * batchSize;
+    chunk.reserve(batchSize);
     thread = Thread::create(worker, reinterpret_cast<void *>(this));
 }
 
@@ -41,6 +49,10 @@ DrmGemCloseWorker::~DrmGemCloseWorker() {
 }
 
 void DrmGemCloseWorker::push(BufferObject *bo) {
+    if (batchedMode) {
+        pushBatched(bo);
+        return;
+    }
     std::unique_lock<std::mutex> lock(closeWorkerMutex);
     workCount++;
     queue.push(bo);
@@ -60,47 +72,142 @@ bool DrmGemCloseWorker::isEmpty() {
     return workCount.load() == 0;
 }
 
+GemCloseWorkerMetrics DrmGemCloseWorker::getMetrics() const {
+    GemCloseWorkerMetrics metrics;
+    metrics.pushed = pushedCount.load();
+    metrics.closed = closedCount.load();
+    metrics.batches = batchesCount.load();
+    metrics.blockingWaits = blockingWaitsCount.load();
+    metrics.maxPending = maxPending.load();
+    metrics.pushesOverHighWatermark = pushesOverHighWatermark.load();
+    return metrics;
+}
+
 inline void DrmGemCloseWorker::close(BufferObject *bo) {
     bo->wait(-1);
     memoryManager.unreference(bo, false);
     workCount--;
 }
 
-void *DrmGemCloseWorker::worker(void *arg) {
-    DrmGemCloseWorker *self = reinterpret_cast<DrmGemCloseWorker *>(arg);
+void DrmGemCloseWorker::pushBatched(BufferObject *bo) {
+    pushedCount++;
+    uint64_t pending = ++workCount;
+    auto currentMax = maxPending.load(std::memory_order_relaxed);
+    while (pending > currentMax && !maxPending.compare_exchange_weak(currentMax, pending, std::memory_order_relaxed)) {
+    }
+    if (pending > highWatermark) {
+        pushesOverHighWatermark++;
+    }
+
+    auto head = pendingHead.load(std::memory_order_relaxed);
+    do {
+        bo->nextToClose = head;
+    } while (!pendingHead.compare_exchange_weak(head, bo, std::memory_order_release, std::memory_order_relaxed));
+
+    if (head == nullptr) {
+        // Only the push to an empty list wakes the worker, taking the lock orders it after the worker's emptiness check
+        std::lock_guard<std::mutex> lock(closeWorkerMutex);
+        condition.notify_one();
+    }
+}
+
+BufferObject *DrmGemCloseWorker::takePendingInPushOrder() {
+    BufferObject *pending = pendingHead.exchange(nullptr, std::memory_order_acquire);
+    BufferObject *reversed = nullptr;
+    while (pending) {
+        auto next = pending->nextToClose;
+        pending->nextToClose = reversed;
+        reversed = pending;
+        pending = next;
+    }
+    return reversed;
+}
+
+void DrmGemCloseWorker::closeBatch(BufferObject *pendingList) {
+    while (pendingList) {
+        chunk.clear();
+        while (pendingList && chunk.size() < batchSize) {
+            chunk.push_back(pendingList);
+            pendingList = pendingList->nextToClose;
+        }
+        closeChunk();
+    }
+}
+
+void DrmGemCloseWorker::closeChunk() {
+    // Waiting for the most recently pushed object first leaves the earlier ones mostly idle, their waits return immediately.
+    // Every object is still waited since objects of one chunk may be used on different engines.
+    for (auto iter = chunk.rbegin(); iter != chunk.rend(); iter++) {
+        auto bo = *iter;
+        bo->nextToClose = nullptr;
+        bo->wait(-1);
+        blockingWaitsCount++;
+        memoryManager.unreference(bo, false);
+        closedCount++;
+        workCount--;
+    }
+    batchesCount++;
+}
+
+void DrmGemCloseWorker::processBatched() {
+    std::unique_lock<std::mutex> lock(closeWorkerMutex, std::defer_lock);
+
+    while (active) {
+        lock.lock();
+        while (pendingHead.load(std::memory_order_acquire) == nullptr && active) {
+            condition.wait(lock);
+        }
+        lock.unlock();
+
+        closeBatch(takePendingInPushOrder());
+    }
+
+    closeBatch(takePendingInPushOrder());
+}
+
+void DrmGemCloseWorker::processQueue() {
     BufferObject *workItem = nullptr;
     std::queue<BufferObject *> localQueue;
-    std::unique_lock<std::mutex> lock(self->closeWorkerMutex);
+    std::unique_lock<std::mutex> lock(closeWorkerMutex);
     lock.unlock();
 
-    while (self->active) {
+    while (active) {
         lock.lock();
         workItem = nullptr;
 
-        while (self->queue.empty() && self->active) {
-            self->condition.wait(lock);
+        while (queue.empty() && active) {
+            condition.wait(lock);
         }
 
-        if (!self->queue.empty()) {
-            localQueue.swap(self->queue);
+        if (!queue.empty()) {
+            localQueue.swap(queue);
         }
 
         lock.unlock();
         while (!localQueue.empty()) {
             workItem = localQueue.front();
             localQueue.pop();
-            self->close(workItem);
+            close(workItem);
         }
     }
 
     lock.lock();
-    while (!self->queue.empty()) {
-        workItem = self->queue.front();
-        self->queue.pop();
-        self->close(workItem);
+    while (!queue.empty()) {
+        workItem = queue.front();
+        queue.pop();
+        close(workItem);
     }
 
     lock.unlock();
+}
+
+void *DrmGemCloseWorker::worker(void *arg) {
+    DrmGemCloseWorker *self = reinterpret_cast<DrmGemCloseWorker *>(arg);
+    if (self->batchedMode) {
+        self->processBatched();
+    } else {
+        self->processQueue();
+    }
     self->workerDone.store(true);
     return nullptr;
 }
@@ -13,6 +13,7 @@
 #include <mutex>
 #include <queue>
 #include <set>
+#include <vector>
 
 namespace NEO {
 class DrmMemoryManager;
@@ -24,6 +25,15 @@ enum gemCloseWorkerMode {
     gemCloseWorkerActive
 };
 
+struct GemCloseWorkerMetrics {
+    uint64_t pushed = 0;
+    uint64_t closed = 0;
+    uint64_t batches = 0;
+    uint64_t blockingWaits = 0;
+    uint64_t maxPending = 0;
+    uint64_t pushesOverHighWatermark = 0;
+};
+
 class DrmGemCloseWorker {
   public:
     DrmGemCloseWorker(DrmMemoryManager &memoryManager);
@@ -36,18 +46,42 @@ class DrmGemCloseWorker {
     void close(bool blocking);
 
     bool isEmpty();
+    GemCloseWorkerMetrics getMetrics() const;
 
   protected:
     void close(BufferObject *workItem);
     void closeThread();
     static void *worker(void *arg);
+    void processQueue();
+
+    // Batched mode: producers push onto a lock-free list, the worker takes the whole list
+    // at once and closes it in chunks with a single wake-up per chunk
+    void processBatched();
+    BufferObject *takePendingInPushOrder();
+    void closeBatch(BufferObject *pendingList);
+    void closeChunk();
+    void pushBatched(BufferObject *bo);
+
     bool active = true;
+    bool batchedMode = false;
+    uint32_t batchSize = 64u;
+    uint32_t highWatermark = 256u;
 
     std::unique_ptr<Thread> thread;
 
     std::queue<BufferObject *> queue;
     std::atomic<uint32_t> workCount{0};
 
+    std::atomic<BufferObject *> pendingHead{nullptr};
+    std::vector<BufferObject *> chunk;
+
+    std::atomic<uint64_t> pushedCount{0};
+    std::atomic<uint64_t> closedCount{0};
+    std::atomic<uint64_t> batchesCount{0};
+    std::atomic<uint64_t> blockingWaitsCount{0};
+    std::atomic<uint64_t> maxPending{0};
+    std::atomic<uint64_t> pushesOverHighWatermark{0};
+
     DrmMemoryManager &memoryManager;
 
     std::mutex closeWorkerMutex;
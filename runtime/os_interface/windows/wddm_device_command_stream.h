@@ -26,6 +26,7 @@ class WddmCommandStreamReceiver : public DeviceCommandStreamReceiver<GfxFamily>
 
     FlushStamp flush(BatchBuffer &batchBuffer, ResidencyContainer &allocationsForResidency) override;
     void makeResident(GraphicsAllocation &gfxAllocation) override;
+    void makeAllocationsResident(ArrayRef<GraphicsAllocation *const> gfxAllocations) override;
     void processResidency(const ResidencyContainer &allocationsForResidency) override;
     void processEviction() override;
     bool waitForFlushStamp(FlushStamp &flushStampToWait) override;
@@ -116,6 +116,17 @@ void WddmCommandStreamReceiver<GfxFamily>::makeResident(GraphicsAllocation &gfxA
     CommandStreamReceiver::makeResident(gfxAllocation);
 }
 
+template <typename GfxFamily>
+void WddmCommandStreamReceiver<GfxFamily>::makeAllocationsResident(ArrayRef<GraphicsAllocation *const> gfxAllocations) {
+    if (DebugManager.flags.ResidencyDebugEnable.get()) {
+        for (auto gfxAllocation : gfxAllocations) {
+            makeResident(*gfxAllocation);
+        }
+        return;
+    }
+    CommandStreamReceiver::makeAllocationsResident(gfxAllocations);
+}
+
 template <typename GfxFamily>
 void WddmCommandStreamReceiver<GfxFamily>::processResidency(const ResidencyContainer &allocationsForResidency) {
     bool success = static_cast<OsContextWin *>(osContext)->getResidencyController().makeResidentResidencyAllocations(allocationsForResidency);
@@ -12,6 +12,7 @@
 #include "runtime/api/api.h"
 #include "runtime/command_stream/command_stream_receiver.h"
 #include "runtime/compiler_interface/compiler_interface.h"
+#include "runtime/compiler_interface/compiler_thread_pool.h"
 #include "runtime/device/root_device.h"
 #include "runtime/event/async_events_handler.h"
 #include "runtime/execution_environment/execution_environment.h"
@@ -50,11 +51,16 @@ Platform *constructPlatform() {
 Platform::Platform() {
     devices.reserve(4);
     setAsyncEventsHandler(std::unique_ptr<AsyncEventsHandler>(new AsyncEventsHandler()));
+    auto compilerThreadsCount = CompilerThreadPool::getMaxThreadsCount(DebugManager.flags.CompilerThreadPoolSize.get());
+    if (compilerThreadsCount > 0u) {
+        setCompilerThreadPool(std::make_unique<CompilerThreadPool>(compilerThreadsCount));
+    }
     executionEnvironment = new ExecutionEnvironment;
     executionEnvironment->incRefInternal();
 }
 
 Platform::~Platform() {
+    compilerThreadPool.reset();
     asyncEventsHandler->closeThread();
     for (auto dev : this->devices) {
         if (dev) {
@@ -252,4 +258,9 @@ std::unique_ptr<AsyncEventsHandler> Platform::setAsyncEventsHandler(std::unique_
     return handler;
 }
 
+std::unique_ptr<CompilerThreadPool> Platform::setCompilerThreadPool(std::unique_ptr<CompilerThreadPool> threadPool) {
+    compilerThreadPool.swap(threadPool);
+    return threadPool;
+}
+
 } // namespace NEO
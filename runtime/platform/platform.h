@@ -18,6 +18,7 @@
 namespace NEO {
 
 class CompilerInterface;
+class CompilerThreadPool;
 class Device;
 class AsyncEventsHandler;
 class ExecutionEnvironment;
@@ -55,6 +56,8 @@ class Platform : public BaseObject<_cl_platform_id> {
     const PlatformInfo &getPlatformInfo() const;
     AsyncEventsHandler *getAsyncEventsHandler();
     std::unique_ptr<AsyncEventsHandler> setAsyncEventsHandler(std::unique_ptr<AsyncEventsHandler> handler);
+    CompilerThreadPool *getCompilerThreadPool() { return compilerThreadPool.get(); }
+    std::unique_ptr<CompilerThreadPool> setCompilerThreadPool(std::unique_ptr<CompilerThreadPool> threadPool);
     ExecutionEnvironment *peekExecutionEnvironment() { return executionEnvironment; }
 
   protected:
@@ -70,6 +73,7 @@ class Platform : public BaseObject<_cl_platform_id> {
     DeviceVector devices;
     std::string compilerExtensions;
     std::unique_ptr<AsyncEventsHandler> asyncEventsHandler;
+    std::unique_ptr<CompilerThreadPool> compilerThreadPool;
     ExecutionEnvironment *executionEnvironment = nullptr;
 };
 
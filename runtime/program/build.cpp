@@ -7,6 +7,7 @@
 
 #include "runtime/compiler_interface/compiler_interface.h"
 #include "runtime/compiler_interface/compiler_options.h"
+#include "runtime/compiler_interface/compiler_thread_pool.h"
 #include "runtime/device/device.h"
 #include "runtime/gtpin/gtpin_notify.h"
 #include "runtime/helpers/validators.h"
@@ -29,6 +30,11 @@ cl_int Program::build(
     bool enableCaching) {
     cl_int retVal = CL_SUCCESS;
 
+    // a previous build request may still be in progress on a compiler thread, its status must not be changed
+    if (!tryStartBuild()) {
+        return CL_INVALID_OPERATION;
+    }
+
     do {
         if (((deviceList == nullptr) && (numDevices != 0)) ||
             ((deviceList != nullptr) && (numDevices == 0))) {
@@ -48,13 +54,55 @@ cl_int Program::build(
             retVal = CL_INVALID_DEVICE;
             break;
         }
+    } while (false);
 
-        // check to see if a previous build request is in progress
-        if (buildStatus == CL_BUILD_IN_PROGRESS) {
-            retVal = CL_INVALID_OPERATION;
-            break;
+    if (retVal != CL_SUCCESS) {
+        buildStatus = CL_BUILD_ERROR;
+        programBinaryType = CL_PROGRAM_BINARY_TYPE_NONE;
+        if (funcNotify != nullptr) {
+            (*funcNotify)(this, userData);
+        }
+        return retVal;
+    }
+
+    auto compilerThreadPool = platform() ? platform()->getCompilerThreadPool() : nullptr;
+    if ((funcNotify != nullptr) && (compilerThreadPool != nullptr)) {
+        buildAsync(*compilerThreadPool, buildOptions, funcNotify, userData, enableCaching);
+        return CL_SUCCESS;
+    }
+
+    return buildWithValidatedArgs(buildOptions, funcNotify, userData, enableCaching);
+}
+
+void Program::buildAsync(CompilerThreadPool &compilerThreadPool, const char *buildOptions,
+                         void(CL_CALLBACK *funcNotify)(cl_program program, void *userData),
+                         void *userData, bool enableCaching) {
+    std::string asyncBuildOptions = (buildOptions) ? buildOptions : "";
+
+    // keep the program alive until the callback is delivered, even if the application releases it earlier
+    this->incRefInternal();
+    compilerThreadPool.submit([this, asyncBuildOptions, funcNotify, userData, enableCaching]() {
+        buildWithValidatedArgs(asyncBuildOptions.c_str(), funcNotify, userData, enableCaching);
+        this->decRefInternal();
+    });
+}
+
+bool Program::tryStartBuild() {
+    auto currentBuildStatus = buildStatus.load();
+    do {
+        if (currentBuildStatus == CL_BUILD_IN_PROGRESS) {
+            return false;
         }
+    } while (!buildStatus.compare_exchange_weak(currentBuildStatus, CL_BUILD_IN_PROGRESS));
+    return true;
+}
 
+cl_int Program::buildWithValidatedArgs(const char *buildOptions,
+                                       void(CL_CALLBACK *funcNotify)(cl_program program, void *userData),
+                                       void *userData, bool enableCaching) {
+    cl_int retVal = CL_SUCCESS;
+
+    do {
         if (isCreatedFromBinary == false) {
             buildStatus = CL_BUILD_IN_PROGRESS;
 
@@ -155,6 +155,7 @@ cl_int Program::getBuildInfo(cl_device_id device, cl_program_build_info paramNam
     const void *pSrc = nullptr;
     size_t srcSize = 0;
     size_t retSize = 0;
+    cl_build_status currentBuildStatus = CL_BUILD_NONE;
     cl_device_id device_id = pDevice;
 
     if (device != device_id) {
@@ -170,8 +171,9 @@ cl_int Program::getBuildInfo(cl_device_id device, cl_program_build_info paramNam
 
     switch (paramName) {
     case CL_PROGRAM_BUILD_STATUS:
+        currentBuildStatus = buildStatus;
         srcSize = retSize = sizeof(cl_build_status);
-        pSrc = &buildStatus;
+        pSrc = &currentBuildStatus;
         break;
 
     case CL_PROGRAM_BUILD_OPTIONS:
@@ -10,11 +10,13 @@
 #include "core/helpers/ptr_math.h"
 #include "core/helpers/string.h"
 #include "core/memory_manager/unified_memory_manager.h"
+#include "runtime/compiler_interface/compiler_thread_pool.h"
 #include "runtime/context/context.h"
 #include "runtime/device/device.h"
 #include "runtime/gtpin/gtpin_notify.h"
 #include "runtime/helpers/hash.h"
 #include "runtime/memory_manager/memory_manager.h"
+#include "runtime/platform/platform.h"
 #include "runtime/program/program.h"
 
 #include "patch_list.h"
@@ -37,7 +39,7 @@ const KernelInfo *Program::getKernelInfo(
     auto it = std::find_if(kernelInfoArray.begin(), kernelInfoArray.end(),
                            [=](const KernelInfo *kInfo) { return (0 == strcmp(kInfo->name.c_str(), kernelName)); });
 
-    return (it != kernelInfoArray.end()) ? *it : nullptr;
+    return (it != kernelInfoArray.end()) ? ensureKernelInfoDecoded(*it) : nullptr;
 }
 
 size_t Program::getNumKernels() const {
@@ -46,7 +48,7 @@ size_t Program::getNumKernels() const {
 
 const KernelInfo *Program::getKernelInfo(size_t ordinal) const {
     DEBUG_BREAK_IF(ordinal >= kernelInfoArray.size());
-    return kernelInfoArray[ordinal];
+    return ensureKernelInfoDecoded(kernelInfoArray[ordinal]);
 }
 
 std::string Program::getKernelNamesString() const {
@@ -66,7 +68,31 @@ size_t Program::processKernel(
     const void *pKernelBlob,
     uint32_t kernelNum,
     cl_int &retVal) {
+    KernelInfo *pKernelInfo = nullptr;
+    auto sizeProcessed = decodeKernel(pKernelBlob, kernelNum, pKernelInfo, retVal);
+    if (pKernelInfo) {
+        addKernelInfo(pKernelInfo);
+    }
+    return sizeProcessed;
+}
+
+void Program::addKernelInfo(KernelInfo *pKernelInfo) {
+    kernelInfoArray.push_back(pKernelInfo);
+    if (pKernelInfo->hasDeviceEnqueue()) {
+        parentKernelInfoArray.push_back(pKernelInfo);
+    }
+    if (pKernelInfo->requiresSubgroupIndependentForwardProgress()) {
+        subgroupKernelInfoArray.push_back(pKernelInfo);
+    }
+}
+
+size_t Program::decodeKernel(
+    const void *pKernelBlob,
+    uint32_t kernelNum,
+    KernelInfo *&pDecodedKernelInfo,
+    cl_int &retVal) {
     size_t sizeProcessed = 0;
+    pDecodedKernelInfo = nullptr;
 
     do {
         auto pKernelInfo = new KernelInfo();
@@ -75,72 +101,174 @@ size_t Program::processKernel(
             break;
         }
 
-        auto pCurKernelPtr = pKernelBlob;
-        pKernelInfo->heapInfo.pBlob = pKernelBlob;
+        auto pPatchList = indexKernelHeaps(*pKernelInfo, pKernelBlob);
 
-        pKernelInfo->heapInfo.pKernelHeader = reinterpret_cast<const SKernelBinaryHeaderCommon *>(pCurKernelPtr);
-        pCurKernelPtr = ptrOffset(pCurKernelPtr, sizeof(SKernelBinaryHeaderCommon));
+        retVal = materializeKernelInfo(*pKernelInfo, kernelNum);
+        if (retVal != CL_SUCCESS) {
+            delete pKernelInfo;
+            sizeProcessed = ptrDiff(pPatchList, pKernelBlob);
+            break;
+        }
 
-        std::string readName{reinterpret_cast<const char *>(pCurKernelPtr), pKernelInfo->heapInfo.pKernelHeader->KernelNameSize};
-        pKernelInfo->name = readName.c_str();
-        pCurKernelPtr = ptrOffset(pCurKernelPtr, pKernelInfo->heapInfo.pKernelHeader->KernelNameSize);
+        sizeProcessed = pKernelInfo->heapInfo.blobSize;
+        pDecodedKernelInfo = pKernelInfo;
+    } while (false);
 
-        pKernelInfo->heapInfo.pKernelHeap = pCurKernelPtr;
-        pCurKernelPtr = ptrOffset(pCurKernelPtr, pKernelInfo->heapInfo.pKernelHeader->KernelHeapSize);
+    return sizeProcessed;
+}
 
-        pKernelInfo->heapInfo.pGsh = pCurKernelPtr;
-        pCurKernelPtr = ptrOffset(pCurKernelPtr, pKernelInfo->heapInfo.pKernelHeader->GeneralStateHeapSize);
+const void *Program::indexKernelHeaps(KernelInfo &kernelInfo, const void *pKernelBlob) {
+    auto pCurKernelPtr = pKernelBlob;
+    kernelInfo.heapInfo.pBlob = pKernelBlob;
 
-        pKernelInfo->heapInfo.pDsh = pCurKernelPtr;
-        pCurKernelPtr = ptrOffset(pCurKernelPtr, pKernelInfo->heapInfo.pKernelHeader->DynamicStateHeapSize);
+    kernelInfo.heapInfo.pKernelHeader = reinterpret_cast<const SKernelBinaryHeaderCommon *>(pCurKernelPtr);
+    pCurKernelPtr = ptrOffset(pCurKernelPtr, sizeof(SKernelBinaryHeaderCommon));
 
-        pKernelInfo->heapInfo.pSsh = const_cast<void *>(pCurKernelPtr);
-        pCurKernelPtr = ptrOffset(pCurKernelPtr, pKernelInfo->heapInfo.pKernelHeader->SurfaceStateHeapSize);
+    std::string readName{reinterpret_cast<const char *>(pCurKernelPtr), kernelInfo.heapInfo.pKernelHeader->KernelNameSize};
+    kernelInfo.name = readName.c_str();
+    pCurKernelPtr = ptrOffset(pCurKernelPtr, kernelInfo.heapInfo.pKernelHeader->KernelNameSize);
 
-        pKernelInfo->heapInfo.pPatchList = pCurKernelPtr;
+    kernelInfo.heapInfo.pKernelHeap = pCurKernelPtr;
+    pCurKernelPtr = ptrOffset(pCurKernelPtr, kernelInfo.heapInfo.pKernelHeader->KernelHeapSize);
 
-        retVal = parsePatchList(*pKernelInfo, kernelNum);
-        if (retVal != CL_SUCCESS) {
-            delete pKernelInfo;
-            sizeProcessed = ptrDiff(pCurKernelPtr, pKernelBlob);
-            break;
-        }
+    kernelInfo.heapInfo.pGsh = pCurKernelPtr;
+    pCurKernelPtr = ptrOffset(pCurKernelPtr, kernelInfo.heapInfo.pKernelHeader->GeneralStateHeapSize);
 
-        auto pKernelHeader = pKernelInfo->heapInfo.pKernelHeader;
-        auto pKernel = ptrOffset(pKernelBlob, sizeof(SKernelBinaryHeaderCommon));
+    kernelInfo.heapInfo.pDsh = pCurKernelPtr;
+    pCurKernelPtr = ptrOffset(pCurKernelPtr, kernelInfo.heapInfo.pKernelHeader->DynamicStateHeapSize);
 
-        if (genBinary)
-            pKernelInfo->gpuPointerSize = reinterpret_cast<const SProgramBinaryHeader *>(genBinary)->GPUPointerSizeInBytes;
+    kernelInfo.heapInfo.pSsh = const_cast<void *>(pCurKernelPtr);
+    pCurKernelPtr = ptrOffset(pCurKernelPtr, kernelInfo.heapInfo.pKernelHeader->SurfaceStateHeapSize);
 
-        uint32_t kernelSize =
-            pKernelHeader->DynamicStateHeapSize +
-            pKernelHeader->GeneralStateHeapSize +
-            pKernelHeader->KernelHeapSize +
-            pKernelHeader->KernelNameSize +
-            pKernelHeader->PatchListSize +
-            pKernelHeader->SurfaceStateHeapSize;
+    kernelInfo.heapInfo.pPatchList = pCurKernelPtr;
 
-        pKernelInfo->heapInfo.blobSize = kernelSize + sizeof(SKernelBinaryHeaderCommon);
+    auto pKernelHeader = kernelInfo.heapInfo.pKernelHeader;
+    uint32_t kernelSize =
+        pKernelHeader->DynamicStateHeapSize +
+        pKernelHeader->GeneralStateHeapSize +
+        pKernelHeader->KernelHeapSize +
+        pKernelHeader->KernelNameSize +
+        pKernelHeader->PatchListSize +
+        pKernelHeader->SurfaceStateHeapSize;
 
-        uint32_t kernelCheckSum = pKernelInfo->heapInfo.pKernelHeader->CheckSum;
+    kernelInfo.heapInfo.blobSize = kernelSize + sizeof(SKernelBinaryHeaderCommon);
 
-        uint64_t hashValue = Hash::hash(reinterpret_cast<const char *>(pKernel), kernelSize);
+    return pCurKernelPtr;
+}
+
+cl_int Program::materializeKernelInfo(KernelInfo &kernelInfo, uint32_t kernelNum) {
+    auto retVal = parsePatchList(kernelInfo, kernelNum);
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+
+    if (genBinary)
+        kernelInfo.gpuPointerSize = reinterpret_cast<const SProgramBinaryHeader *>(genBinary)->GPUPointerSizeInBytes;
+
+    uint32_t kernelCheckSum = kernelInfo.heapInfo.pKernelHeader->CheckSum;
+
+    auto pKernel = ptrOffset(kernelInfo.heapInfo.pBlob, sizeof(SKernelBinaryHeaderCommon));
+    auto kernelSize = kernelInfo.heapInfo.blobSize - sizeof(SKernelBinaryHeaderCommon);
+    uint64_t hashValue = Hash::hash(reinterpret_cast<const char *>(pKernel), kernelSize);
+
+    uint32_t calcCheckSum = hashValue & 0xFFFFFFFF;
+    kernelInfo.isValid = (calcCheckSum == kernelCheckSum);
+
+    return CL_SUCCESS;
+}
+
+cl_int Program::indexKernelsForLazyDecoding(const void *pKernelBlobs, uint32_t numKernels) {
+    cl_int retVal = CL_SUCCESS;
+    auto pCurKernelBlob = pKernelBlobs;
+
+    for (uint32_t i = 0; i < numKernels && retVal == CL_SUCCESS; i++) {
+        auto pKernelInfo = new KernelInfo();
+        indexKernelHeaps(*pKernelInfo, pCurKernelBlob);
+        pCurKernelBlob = ptrOffset(pCurKernelBlob, pKernelInfo->heapInfo.blobSize);
+
+        if (requiresEagerDecoding(*pKernelInfo)) {
+            retVal = materializeKernelInfo(*pKernelInfo, i);
+            if (retVal != CL_SUCCESS) {
+                delete pKernelInfo;
+                break;
+            }
+        } else {
+            pendingKernelDecodes[pKernelInfo] = i;
+        }
+        addKernelInfo(pKernelInfo);
+    }
+
+    lazyKernelDecodesCount = pendingKernelDecodes.size();
+    return retVal;
+}
 
-        uint32_t calcCheckSum = hashValue & 0xFFFFFFFF;
-        pKernelInfo->isValid = (calcCheckSum == kernelCheckSum);
+bool Program::requiresEagerDecoding(const KernelInfo &kernelInfo) const {
+    // Kernels which affect program-wide state (linking, device enqueue, block kernels) are decoded at load.
+    // Walking token headers is cheap compared to a full decode, which allocates and uploads the ISA.
+    if (kernelInfo.name.rfind("_dispatch_") != std::string::npos) {
+        return true;
+    }
 
-        retVal = CL_SUCCESS;
-        sizeProcessed = sizeof(SKernelBinaryHeaderCommon) + kernelSize;
-        kernelInfoArray.push_back(pKernelInfo);
-        if (pKernelInfo->hasDeviceEnqueue()) {
-            parentKernelInfoArray.push_back(pKernelInfo);
+    auto pPatchList = kernelInfo.heapInfo.pPatchList;
+    auto patchListSize = kernelInfo.heapInfo.pKernelHeader->PatchListSize;
+    auto pCurPatchListPtr = pPatchList;
+    while (ptrDiff(pCurPatchListPtr, pPatchList) < patchListSize) {
+        auto pPatch = reinterpret_cast<const SPatchItemHeader *>(pCurPatchListPtr);
+        switch (pPatch->Token) {
+        case PATCH_TOKEN_PROGRAM_SYMBOL_TABLE:
+        case PATCH_TOKEN_PROGRAM_RELOCATION_TABLE:
+            return true;
+        case PATCH_TOKEN_EXECUTION_ENVIRONMENT: {
+            auto pExecutionEnvironment = reinterpret_cast<const SPatchExecutionEnvironment *>(pPatch);
+            if (pExecutionEnvironment->HasDeviceEnqueue || pExecutionEnvironment->SubgroupIndependentForwardProgressRequired) {
+                return true;
+            }
+        } break;
+        default:
+            break;
         }
-        if (pKernelInfo->requiresSubgroupIndependentForwardProgress()) {
-            subgroupKernelInfoArray.push_back(pKernelInfo);
+        if (pPatch->Size == 0) {
+            return true;
         }
-    } while (false);
+        pCurPatchListPtr = ptrOffset(pCurPatchListPtr, pPatch->Size);
+    }
+    return false;
+}
 
-    return sizeProcessed;
+cl_int Program::decodeAllPendingKernels() {
+    cl_int retVal = CL_SUCCESS;
+    for (auto kernelInfo : kernelInfoArray) {
+        if (ensureKernelInfoDecoded(kernelInfo) == nullptr) {
+            retVal = CL_INVALID_KERNEL;
+        }
+    }
+    return retVal;
+}
+
+const KernelInfo *Program::ensureKernelInfoDecoded(const KernelInfo *kernelInfo) const {
+    if (lazyKernelDecodesCount == 0u) {
+        return kernelInfo;
+    }
+
+    std::lock_guard<std::mutex> lock(kernelDecodeMtx);
+    if (failedKernelDecodes.count(kernelInfo) != 0) {
+        return nullptr;
+    }
+    auto pendingDecode = pendingKernelDecodes.find(kernelInfo);
+    if (pendingDecode == pendingKernelDecodes.end()) {
+        return kernelInfo;
+    }
+
+    auto self = const_cast<Program *>(this);
+    auto decodedKernelInfo = const_cast<KernelInfo *>(kernelInfo);
+    auto retVal = self->materializeKernelInfo(*decodedKernelInfo, pendingDecode->second);
+    self->pendingKernelDecodes.erase(pendingDecode);
+    if (retVal != CL_SUCCESS) {
+        self->failedKernelDecodes.insert(kernelInfo);
+        return nullptr;
+    }
+    self->lazyKernelDecodesCount--;
+    return kernelInfo;
 }
 
 cl_int Program::parsePatchList(KernelInfo &kernelInfo, uint32_t kernelNum) {
@@ -810,12 +938,14 @@ cl_int Program::parsePatchList(KernelInfo &kernelInfo, uint32_t kernelNum) {
 
         case PATCH_TOKEN_PROGRAM_SYMBOL_TABLE: {
             const auto patch = reinterpret_cast<const iOpenCL::SPatchFunctionTableInfo *>(pPatch);
+            std::lock_guard<std::mutex> lock(linkerInputMtx);
             prepareLinkerInputStorage();
             linkerInput->decodeExportedFunctionsSymbolTable(patch + 1, patch->NumEntries, kernelNum);
         } break;
 
         case PATCH_TOKEN_PROGRAM_RELOCATION_TABLE: {
             const auto patch = reinterpret_cast<const iOpenCL::SPatchFunctionTableInfo *>(pPatch);
+            std::lock_guard<std::mutex> lock(linkerInputMtx);
             prepareLinkerInputStorage();
             linkerInput->decodeRelocationTable(patch + 1, patch->NumEntries, kernelNum);
         } break;
@@ -1138,10 +1268,17 @@ cl_int Program::processGenBinary() {
         pCurBinaryPtr = ptrOffset(pCurBinaryPtr, pGenBinaryHeader->PatchListSize);
 
         auto numKernels = pGenBinaryHeader->NumberOfKernels;
-        for (uint32_t i = 0; i < numKernels && retVal == CL_SUCCESS; i++) {
+        auto compilerThreadPool = platform() ? platform()->getCompilerThreadPool() : nullptr;
+        if (DebugManager.flags.EnableLazyKernelDecoding.get() && !isKernelDebugEnabled()) {
+            retVal = indexKernelsForLazyDecoding(pCurBinaryPtr, numKernels);
+        } else if ((compilerThreadPool != nullptr) && (numKernels > 1)) {
+            retVal = processKernelsInParallel(*compilerThreadPool, pCurBinaryPtr, numKernels);
+        } else {
+            for (uint32_t i = 0; i < numKernels && retVal == CL_SUCCESS; i++) {
 
-            size_t bytesProcessed = processKernel(pCurBinaryPtr, i, retVal);
-            pCurBinaryPtr = ptrOffset(pCurBinaryPtr, bytesProcessed);
+                size_t bytesProcessed = processKernel(pCurBinaryPtr, i, retVal);
+                pCurBinaryPtr = ptrOffset(pCurBinaryPtr, bytesProcessed);
+            }
         }
 
         if (programScopePatchListSize != 0u) {
@@ -1149,6 +1286,11 @@ cl_int Program::processGenBinary() {
         }
     } while (false);
 
+    if ((retVal == CL_SUCCESS) && linkerInput) {
+        // relocations may target any kernel's ISA
+        retVal = decodeAllPendingKernels();
+    }
+
     if (retVal == CL_SUCCESS) {
         retVal = linkBinary();
     }
@@ -1156,6 +1298,41 @@ cl_int Program::processGenBinary() {
     return retVal;
 }
 
+cl_int Program::processKernelsInParallel(CompilerThreadPool &compilerThreadPool, const void *pKernelBlobs, uint32_t numKernels) {
+    // kernel blobs are laid out back to back, so their starts are known from the headers alone
+    std::vector<const void *> kernelBlobs(numKernels);
+    auto pCurKernelBlob = pKernelBlobs;
+    for (uint32_t i = 0; i < numKernels; i++) {
+        kernelBlobs[i] = pCurKernelBlob;
+        auto pKernelHeader = reinterpret_cast<const SKernelBinaryHeaderCommon *>(pCurKernelBlob);
+        pCurKernelBlob = ptrOffset(pCurKernelBlob, sizeof(SKernelBinaryHeaderCommon) +
+                                                       pKernelHeader->KernelNameSize +
+                                                       pKernelHeader->KernelHeapSize +
+                                                       pKernelHeader->GeneralStateHeapSize +
+                                                       pKernelHeader->DynamicStateHeapSize +
+                                                       pKernelHeader->SurfaceStateHeapSize +
+                                                       pKernelHeader->PatchListSize);
+    }
+
+    std::vector<KernelInfo *> decodedKernels(numKernels, nullptr);
+    std::vector<cl_int> decodeResults(numKernels, CL_SUCCESS);
+    compilerThreadPool.parallelFor(numKernels, [&](uint32_t kernelNum) {
+        decodeKernel(kernelBlobs[kernelNum], kernelNum, decodedKernels[kernelNum], decodeResults[kernelNum]);
+    });
+
+    // register in binary order, so kernel ordinals match the sequential path
+    cl_int retVal = CL_SUCCESS;
+    for (uint32_t i = 0; i < numKernels; i++) {
+        if (decodedKernels[i]) {
+            addKernelInfo(decodedKernels[i]);
+        }
+        if (retVal == CL_SUCCESS) {
+            retVal = decodeResults[i];
+        }
+    }
+    return retVal;
+}
+
 bool Program::validateGenBinaryDevice(GFXCORE_FAMILY device) const {
     bool isValid = familyEnabled[device];
 
@@ -95,8 +95,7 @@ Program::Program(ExecutionEnvironment &executionEnvironment, Context *context, b
 }
 
 Program::~Program() {
-    delete[] genBinary;
-    genBinary = nullptr;
+    releaseGenBinary();
 
     delete[] irBinary;
     irBinary = nullptr;
@@ -327,9 +326,31 @@ cl_int Program::getSource(std::string &binary) const {
 void Program::storeGenBinary(
     const void *pSrc,
     const size_t srcSize) {
+    releaseGenBinary();
     storeBinary(genBinary, genBinarySize, pSrc, srcSize);
 }
 
+void Program::storeGenBinary(
+    std::shared_ptr<const void> backingStorage,
+    ArrayRef<const char> binary) {
+    DEBUG_BREAK_IF(!(backingStorage && binary.size() > 0));
+
+    releaseGenBinary();
+    genBinaryStorage = std::move(backingStorage);
+    // binary is only read while processing, kernel heaps are copied out when allocations are created
+    genBinary = const_cast<char *>(binary.begin());
+    genBinarySize = binary.size();
+}
+
+void Program::releaseGenBinary() {
+    if (genBinaryStorage == nullptr) {
+        delete[] genBinary;
+    }
+    genBinaryStorage.reset();
+    genBinary = nullptr;
+    genBinarySize = 0;
+}
+
 void Program::storeIrBinary(
     const void *pSrc,
     const size_t srcSize,
@@ -486,6 +507,11 @@ void Program::cleanCurrentKernelInfo() {
         delete kernelInfo;
     }
     kernelInfoArray.clear();
+
+    std::lock_guard<std::mutex> lock(kernelDecodeMtx);
+    pendingKernelDecodes.clear();
+    failedKernelDecodes.clear();
+    lazyKernelDecodesCount = 0u;
 }
 
 void Program::updateNonUniformFlag() {
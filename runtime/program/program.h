@@ -7,6 +7,7 @@
 
 #pragma once
 #include "core/compiler_interface/linker.h"
+#include "core/utilities/arrayref.h"
 #include "elf/reader.h"
 #include "elf/writer.h"
 #include "runtime/api/cl_types.h"
@@ -20,8 +21,13 @@
 #include "igfxfmid.h"
 #include "patch_list.h"
 
+#include <atomic>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #define OCLRT_ALIGN(a, b) ((((a) % (b)) != 0) ? ((a) - ((a) % (b)) + (b)) : (a))
@@ -29,6 +35,7 @@
 namespace NEO {
 class Context;
 class CompilerInterface;
+class CompilerThreadPool;
 class ExecutionEnvironment;
 template <>
 struct OpenCLObjectMapper<_cl_program> {
@@ -168,6 +175,8 @@ class Program : public BaseObject<_cl_program> {
     cl_int getSource(std::string &binary) const;
 
     void storeGenBinary(const void *pSrc, const size_t srcSize);
+    // binary is referenced in place and must stay valid for as long as backingStorage is alive
+    void storeGenBinary(std::shared_ptr<const void> backingStorage, ArrayRef<const char> binary);
 
     char *getGenBinary(size_t &genBinarySize) const {
         genBinarySize = this->genBinarySize;
@@ -296,8 +305,26 @@ class Program : public BaseObject<_cl_program> {
     cl_int parsePatchList(KernelInfo &pKernelInfo, uint32_t kernelNum);
 
     size_t processKernel(const void *pKernelBlob, uint32_t kernelNum, cl_int &retVal);
+    size_t decodeKernel(const void *pKernelBlob, uint32_t kernelNum, KernelInfo *&pKernelInfo, cl_int &retVal);
+    const void *indexKernelHeaps(KernelInfo &kernelInfo, const void *pKernelBlob);
+    cl_int materializeKernelInfo(KernelInfo &kernelInfo, uint32_t kernelNum);
+    cl_int indexKernelsForLazyDecoding(const void *pKernelBlobs, uint32_t numKernels);
+    bool requiresEagerDecoding(const KernelInfo &kernelInfo) const;
+    cl_int decodeAllPendingKernels();
+    const KernelInfo *ensureKernelInfoDecoded(const KernelInfo *kernelInfo) const;
+    void addKernelInfo(KernelInfo *pKernelInfo);
+    cl_int processKernelsInParallel(CompilerThreadPool &compilerThreadPool, const void *pKernelBlobs, uint32_t numKernels);
+
+    cl_int buildWithValidatedArgs(const char *buildOptions,
+                                  void(CL_CALLBACK *funcNotify)(cl_program program, void *userData),
+                                  void *userData, bool enableCaching);
+    void buildAsync(CompilerThreadPool &compilerThreadPool, const char *buildOptions,
+                    void(CL_CALLBACK *funcNotify)(cl_program program, void *userData),
+                    void *userData, bool enableCaching);
 
     void storeBinary(char *&pDst, size_t &dstSize, const void *pSrc, const size_t srcSize);
+    bool tryStartBuild();
+    void releaseGenBinary();
 
     bool validateGenBinaryDevice(GFXCORE_FAMILY device) const;
     bool validateGenBinaryHeader(const iOpenCL::SProgramBinaryHeader *pGenBinaryHeader) const;
@@ -327,6 +354,7 @@ class Program : public BaseObject<_cl_program> {
 
     char *genBinary;
     size_t genBinarySize;
+    std::shared_ptr<const void> genBinaryStorage;
 
     char *irBinary;
     size_t irBinarySize;
@@ -337,6 +365,10 @@ class Program : public BaseObject<_cl_program> {
     CreatedFrom createdFrom = CreatedFrom::UNKNOWN;
 
     std::vector<KernelInfo *> kernelInfoArray;
+    std::unordered_map<const KernelInfo *, uint32_t> pendingKernelDecodes;
+    std::unordered_set<const KernelInfo *> failedKernelDecodes;
+    std::atomic<size_t> lazyKernelDecodesCount{0u};
+    mutable std::mutex kernelDecodeMtx;
     std::vector<KernelInfo *> parentKernelInfoArray;
     std::vector<KernelInfo *> subgroupKernelInfoArray;
     BlockKernelManager *blockKernelManager;
@@ -350,7 +382,8 @@ class Program : public BaseObject<_cl_program> {
 
     size_t globalVarTotalSize;
 
-    cl_build_status buildStatus;
+    // written by builds running on compiler threads
+    std::atomic<cl_build_status> buildStatus;
     bool isCreatedFromBinary;
     bool isProgramBinaryResolved;
 
@@ -365,6 +398,7 @@ class Program : public BaseObject<_cl_program> {
     bool allowNonUniform;
 
     std::unique_ptr<LinkerInput> linkerInput;
+    std::mutex linkerInputMtx;
     Linker::RelocatedSymbolsMap symbols;
 
     std::map<const Device *, std::string> buildLog;
@@ -27,6 +27,8 @@ class TbxSockets {
     virtual bool readMMIO(uint32_t offset, uint32_t *value) = 0;
     virtual bool writeMMIO(uint32_t offset, uint32_t value) = 0;
 
+    virtual bool flush() = 0;
+
     static TbxSockets *create();
 };
 } // namespace NEO
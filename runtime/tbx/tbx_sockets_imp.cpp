@@ -8,7 +8,10 @@
 #include "runtime/tbx/tbx_sockets_imp.h"
 
 #include "core/helpers/debug_helpers.h"
+#include "core/helpers/ptr_math.h"
 #include "core/helpers/string.h"
+#include "core/memory_manager/memory_constants.h"
+#include "runtime/os_interface/debug_settings_manager.h"
 
 #ifdef WIN32
 #ifndef WIN32_LEAN_AND_MEAN
@@ -20,6 +23,7 @@ typedef int socklen_t;
 #include <netdb.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/uio.h>
 #include <unistd.h>
 typedef struct sockaddr SOCKADDR;
 #define SOCKET_ERROR -1
@@ -38,6 +42,7 @@ TbxSocketsImp::TbxSocketsImp(std::ostream &err)
 
 void TbxSocketsImp::close() {
     if (0 != m_socket) {
+        flushPipelinedWrites();
 #ifdef WIN32
         ::shutdown(m_socket, 0x02 /*SD_BOTH*/);
 
@@ -97,6 +102,11 @@ bool TbxSocketsImp::init(const std::string &hostNameOrIp, uint16_t port) {
         cmd.u.control_req.has = 1;
 
         sendWriteData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size);
+
+        if (DebugManager.flags.TbxPipelinedWriteBufferSize.get() > 0) {
+            pipelinedWriteBufferSize = static_cast<size_t>(DebugManager.flags.TbxPipelinedWriteBufferSize.get()) * MemoryConstants::kiloByte;
+            pipelinedWrites.reserve(pipelinedWriteBufferSize);
+        }
     } while (false);
 
     return m_socket != INVALID_SOCKET;
@@ -146,7 +156,7 @@ bool TbxSocketsImp::readMMIO(uint32_t offset, uint32_t *data) {
         cmd.u.mmio_req.msg_type = MSG_TYPE_MMIO;
         cmd.u.mmio_req.size = sizeof(uint32_t);
 
-        success = sendWriteData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size);
+        success = flushPipelinedWrites() && sendWriteData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size);
         if (!success) {
             break;
         }
@@ -183,7 +193,7 @@ bool TbxSocketsImp::writeMMIO(uint32_t offset, uint32_t value) {
     cmd.u.mmio_req.write = 1;
     cmd.u.mmio_req.size = sizeof(uint32_t);
 
-    return sendWriteData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size);
+    return queueWriteData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size, nullptr, 0);
 }
 
 bool TbxSocketsImp::readMemory(uint64_t addrOffset, void *data, size_t size) {
@@ -202,7 +212,7 @@ bool TbxSocketsImp::readMemory(uint64_t addrOffset, void *data, size_t size) {
 
     bool success;
     do {
-        success = sendWriteData(&cmd, sizeof(HAS_HDR) + sizeof(HAS_READ_DATA_REQ));
+        success = flushPipelinedWrites() && sendWriteData(&cmd, sizeof(HAS_HDR) + sizeof(HAS_READ_DATA_REQ));
         if (!success) {
             break;
         }
@@ -242,19 +252,10 @@ bool TbxSocketsImp::writeMemory(uint64_t physAddr, const void *data, size_t size
     cmd.u.write_req.cacheline_disable = cmd.u.write_req.frontdoor;
     cmd.u.write_req.memory_type = type;
 
-    bool success;
-    do {
-        success = sendWriteData(&cmd, sizeof(HAS_HDR) + sizeof(HAS_WRITE_DATA_REQ));
-        if (!success) {
-            break;
-        }
-
-        success = sendWriteData(data, size);
-        if (!success) {
-            cerrStream << "Problem sending write data?" << std::endl;
-            break;
-        }
-    } while (false);
+    auto success = queueWriteData(&cmd, sizeof(HAS_HDR) + sizeof(HAS_WRITE_DATA_REQ), data, size);
+    if (!success) {
+        cerrStream << "Problem sending write data?" << std::endl;
+    }
 
     DEBUG_BREAK_IF(!success);
     return success;
@@ -271,7 +272,7 @@ bool TbxSocketsImp::writeGTT(uint32_t offset, uint64_t entry) {
     cmd.u.gtt64_req.data = static_cast<uint32_t>(entry & 0xffffffff);
     cmd.u.gtt64_req.data_h = static_cast<uint32_t>(entry >> 32);
 
-    return sendWriteData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size);
+    return queueWriteData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size, nullptr, 0);
 }
 
 bool TbxSocketsImp::sendWriteData(const void *buffer, size_t sizeInBytes) {
@@ -295,6 +296,77 @@ bool TbxSocketsImp::sendWriteData(const void *buffer, size_t sizeInBytes) {
     return true;
 }
 
+bool TbxSocketsImp::sendWriteMessage(const void *header, size_t headerSize, const void *data, size_t dataSize) {
+#ifdef WIN32
+    return sendWriteData(header, headerSize) && (dataSize == 0 || sendWriteData(data, dataSize));
+#else
+    iovec buffers[] = {{const_cast<void *>(header), headerSize}, {const_cast<void *>(data), dataSize}};
+    iovec *remainingBuffers = buffers;
+    int remainingBuffersCount = dataSize != 0 ? 2 : 1;
+
+    do {
+        auto bytesSent = ::writev(m_socket, remainingBuffers, remainingBuffersCount);
+        if (bytesSent == 0 || bytesSent == WSAECONNRESET) {
+            logErrorInfo("Connection Closed.");
+            return false;
+        }
+
+        if (bytesSent == SOCKET_ERROR) {
+            logErrorInfo("Error on writev()");
+            return false;
+        }
+
+        auto bytesLeft = static_cast<size_t>(bytesSent);
+        while (remainingBuffersCount > 0 && bytesLeft >= remainingBuffers->iov_len) {
+            bytesLeft -= remainingBuffers->iov_len;
+            remainingBuffers++;
+            remainingBuffersCount--;
+        }
+        if (remainingBuffersCount > 0) {
+            remainingBuffers->iov_base = ptrOffset(remainingBuffers->iov_base, bytesLeft);
+            remainingBuffers->iov_len -= bytesLeft;
+        }
+    } while (remainingBuffersCount > 0);
+
+    return true;
+#endif
+}
+
+bool TbxSocketsImp::queueWriteData(const void *header, size_t headerSize, const void *data, size_t dataSize) {
+    if (pipelinedWriteBufferSize == 0) {
+        return sendWriteMessage(header, headerSize, data, dataSize);
+    }
+
+    if (pipelinedWrites.size() + headerSize + dataSize > pipelinedWriteBufferSize) {
+        if (!flushPipelinedWrites()) {
+            return false;
+        }
+        if (headerSize + dataSize > pipelinedWriteBufferSize) {
+            return sendWriteMessage(header, headerSize, data, dataSize);
+        }
+    }
+
+    auto headerBytes = reinterpret_cast<const char *>(header);
+    pipelinedWrites.insert(pipelinedWrites.end(), headerBytes, headerBytes + headerSize);
+    auto dataBytes = reinterpret_cast<const char *>(data);
+    pipelinedWrites.insert(pipelinedWrites.end(), dataBytes, dataBytes + dataSize);
+    return true;
+}
+
+bool TbxSocketsImp::flush() {
+    return flushPipelinedWrites();
+}
+
+bool TbxSocketsImp::flushPipelinedWrites() {
+    if (pipelinedWrites.empty()) {
+        return true;
+    }
+
+    auto success = sendWriteData(pipelinedWrites.data(), pipelinedWrites.size());
+    pipelinedWrites.clear();
+    return success;
+}
+
 bool TbxSocketsImp::getResponseData(void *buffer, size_t sizeInBytes) {
     size_t totalRecv = 0;
     auto dataBuffer = static_cast<char *>(buffer);
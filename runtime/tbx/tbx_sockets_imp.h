@@ -11,6 +11,7 @@
 #include "os_socket.h"
 
 #include <iostream>
+#include <vector>
 
 namespace NEO {
 
@@ -30,12 +31,17 @@ class TbxSocketsImp : public TbxSockets {
     bool readMMIO(uint32_t offset, uint32_t *data) override;
     bool writeMMIO(uint32_t offset, uint32_t data) override;
 
+    bool flush() override;
+
   protected:
     std::ostream &cerrStream;
     SOCKET m_socket = 0;
 
     bool connectToServer(const std::string &hostNameOrIp, uint16_t port);
-    bool sendWriteData(const void *buffer, size_t sizeInBytes);
+    MOCKABLE_VIRTUAL bool sendWriteData(const void *buffer, size_t sizeInBytes);
+    MOCKABLE_VIRTUAL bool sendWriteMessage(const void *header, size_t headerSize, const void *data, size_t dataSize);
+    bool queueWriteData(const void *header, size_t headerSize, const void *data, size_t dataSize);
+    bool flushPipelinedWrites();
     bool getResponseData(void *buffer, size_t sizeInBytes);
 
     inline uint32_t getNextTransID() { return transID++; }
@@ -43,5 +49,9 @@ class TbxSocketsImp : public TbxSockets {
     void logErrorInfo(const char *tag);
 
     uint32_t transID = 0;
+
+    // write messages need no response, in pipelined mode they are collected here and sent on flush or before the next read
+    std::vector<char> pipelinedWrites;
+    size_t pipelinedWriteBufferSize = 0;
 };
 } // namespace NEO
@@ -10,15 +10,28 @@
 #include "core/helpers/debug_helpers.h"
 #include "core/utilities/idlist.h"
 #include "runtime/memory_manager/memory_manager.h"
+#include "runtime/os_interface/debug_settings_manager.h"
 
 #include <atomic>
 #include <cstdint>
+#include <functional>
+#include <memory>
 #include <mutex>
+#include <new>
+#include <type_traits>
 #include <vector>
 
 namespace NEO {
 class GraphicsAllocation;
 
+namespace TagAllocatorHelper {
+inline uint32_t getThreadSlot() {
+    static std::atomic<uint32_t> threadsCount{0u};
+    thread_local uint32_t threadSlot = threadsCount++;
+    return threadSlot;
+}
+} // namespace TagAllocatorHelper
+
 template <typename TagType>
 class TagAllocator;
 
@@ -41,6 +54,8 @@ struct TagNode : public IDNode<TagNode<TagType>> {
     GraphicsAllocation *gfxAllocation = nullptr;
     uint64_t gpuAddress = 0;
     std::atomic<uint32_t> refCount{0};
+    uint32_t freeStackReference = 0;
+    std::atomic<uint32_t> nextFreeStackReference{0};
 
     template <typename TagType2>
     friend class TagAllocator;
@@ -56,6 +71,15 @@ class TagAllocator {
                                                                                                                    tagAlignment(tagAlignment) {
 
         this->tagSize = alignUp(tagSize, tagAlignment);
+        useThreadCache = DebugManager.flags.EnableTagAllocatorThreadCache.get();
+        if (useThreadCache) {
+            poolBases.reset(new std::atomic<NodeType *>[maxPoolsCount]);
+            magazinesMemory = allocateAlignedMemory(sizeof(TagMagazine) * magazinesCount, MemoryConstants::cacheLineSize);
+            magazines = static_cast<TagMagazine *>(magazinesMemory.get());
+            for (uint32_t i = 0; i < magazinesCount; i++) {
+                new (&magazines[i]) TagMagazine;
+            }
+        }
         populateFreeTags();
     }
 
@@ -73,9 +97,19 @@ class TagAllocator {
             delete[] nodesMemory;
         }
         tagPoolMemory.clear();
+
+        if (useThreadCache) {
+            freeStackHead.store(0u);
+            for (uint32_t i = 0; i < magazinesCount; i++) {
+                magazines[i].count = 0u;
+            }
+        }
     }
 
     NodeType *getTag() {
+        if (useThreadCache) {
+            return getTagFromThreadCache();
+        }
         if (freeTags.peekIsEmpty()) {
             releaseDeferredTags();
         }
@@ -93,7 +127,9 @@ class TagAllocator {
 
     MOCKABLE_VIRTUAL void returnTag(NodeType *node) {
         if (node->refCount.fetch_sub(1) == 1) {
-            if (node->tagForCpuAccess->canBeReleased()) {
+            if (useThreadCache) {
+                returnTagToThreadCache(node);
+            } else if (node->tagForCpuAccess->canBeReleased()) {
                 returnTagToFreePool(node);
             } else {
                 returnTagToDeferredPool(node);
@@ -102,6 +138,22 @@ class TagAllocator {
     }
 
   protected:
+    static constexpr uint32_t magazineCapacity = 32u;
+    static constexpr uint32_t magazinesCount = 16u;
+    static constexpr uint32_t poolReferenceShift = 22u;
+    static constexpr uint32_t maxPoolsCount = 1u << (32u - poolReferenceShift);
+
+    // Cache of free nodes used by threads mapped to the same slot, aligned to start its own cache line
+    struct alignas(MemoryConstants::cacheLineSize) TagMagazine {
+        bool tryLock() { return !locked.exchange(true, std::memory_order_acquire); }
+        void unlock() { locked.store(false, std::memory_order_release); }
+
+        std::atomic<bool> locked{false};
+        uint32_t count = 0u;
+        NodeType *nodes[magazineCapacity];
+    };
+    static_assert(std::is_trivially_destructible<TagMagazine>::value, "magazines are released without calling destructors");
+
     IDList<NodeType> freeTags;
     IDList<NodeType> usedTags;
     IDList<NodeType> deferredTags;
@@ -115,6 +167,148 @@ class TagAllocator {
 
     std::mutex allocatorMutex;
 
+    bool useThreadCache = false;
+    // operator new does not have to honor the cache line alignment of magazines
+    std::unique_ptr<void, std::function<decltype(alignedFree)>> magazinesMemory;
+    TagMagazine *magazines = nullptr;
+    // Nodes are referenced in the free stack by pool index and position in the pool, the upper half of
+    // the stack head is a version bumped on every update so that a concurrent pop cannot suffer from ABA
+    std::unique_ptr<std::atomic<NodeType *>[]> poolBases;
+    std::atomic<uint64_t> freeStackHead{0u};
+
+    NodeType *getTagFromThreadCache() {
+        auto &magazine = magazines[TagAllocatorHelper::getThreadSlot() % magazinesCount];
+        NodeType *node = nullptr;
+        if (magazine.tryLock()) {
+            if (magazine.count == 0u) {
+                while (magazine.count < magazineCapacity / 2) {
+                    auto freeNode = popFromFreeStack();
+                    if (freeNode == nullptr) {
+                        break;
+                    }
+                    magazine.nodes[magazine.count++] = freeNode;
+                }
+            }
+            if (magazine.count > 0u) {
+                node = magazine.nodes[--magazine.count];
+            }
+            magazine.unlock();
+        }
+        if (node == nullptr) {
+            node = popFromFreeStack();
+        }
+        if (node == nullptr) {
+            releaseDeferredTagsUpToWatermark();
+            node = popFromFreeStack();
+        }
+        if (node == nullptr) {
+            std::unique_lock<std::mutex> lock(allocatorMutex);
+            node = popFromFreeStack();
+            if (node == nullptr) {
+                populateFreeTags();
+                node = popFromFreeStack();
+            }
+        }
+        node->incRefCount();
+        node->tagForCpuAccess->initialize();
+        return node;
+    }
+
+    void returnTagToThreadCache(NodeType *node) {
+        if (!node->tagForCpuAccess->canBeReleased()) {
+            deferredTags.pushTailOne(*node);
+            return;
+        }
+
+        auto &magazine = magazines[TagAllocatorHelper::getThreadSlot() % magazinesCount];
+        if (!magazine.tryLock()) {
+            pushToFreeStack(node, node);
+            return;
+        }
+        if (magazine.count == magazineCapacity) {
+            auto first = magazine.nodes[magazineCapacity / 2];
+            for (auto i = magazineCapacity / 2; i < magazineCapacity - 1; i++) {
+                magazine.nodes[i]->nextFreeStackReference.store(magazine.nodes[i + 1]->freeStackReference, std::memory_order_relaxed);
+            }
+            pushToFreeStack(first, magazine.nodes[magazineCapacity - 1]);
+            magazine.count = magazineCapacity / 2;
+        }
+        magazine.nodes[magazine.count++] = node;
+        magazine.unlock();
+    }
+
+    NodeType *getNodeByFreeStackReference(uint32_t reference) {
+        reference--;
+        return &poolBases[reference >> poolReferenceShift].load(std::memory_order_acquire)[reference & ((1u << poolReferenceShift) - 1)];
+    }
+
+    // Nodes from first to last have to be already linked through nextFreeStackReference
+    void pushToFreeStack(NodeType *first, NodeType *last) {
+        auto head = freeStackHead.load(std::memory_order_relaxed);
+        uint64_t newHead = 0u;
+        do {
+            last->nextFreeStackReference.store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+            newHead = (((head >> 32) + 1) << 32) | first->freeStackReference;
+        } while (!freeStackHead.compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    NodeType *popFromFreeStack() {
+        auto head = freeStackHead.load(std::memory_order_acquire);
+        while (static_cast<uint32_t>(head) != 0u) {
+            auto node = getNodeByFreeStackReference(static_cast<uint32_t>(head));
+            uint64_t newHead = (((head >> 32) + 1) << 32) | node->nextFreeStackReference.load(std::memory_order_relaxed);
+            if (freeStackHead.compare_exchange_weak(head, newHead, std::memory_order_acquire, std::memory_order_acquire)) {
+                return node;
+            }
+        }
+        return nullptr;
+    }
+
+    // Deferred tags are kept in the order they were returned and tend to complete in that order,
+    // so completed tags are released in bulk up to the first one still in use. The whole list is
+    // checked only when nothing could be released that way.
+    void releaseDeferredTagsUpToWatermark() {
+        auto currentNode = deferredTags.detachNodes();
+        NodeType *firstReleased = nullptr;
+        NodeType *lastReleased = nullptr;
+        IDList<NodeType, false> pendingDeferredTags;
+
+        while (currentNode != nullptr && currentNode->tagForCpuAccess->canBeReleased()) {
+            auto nextNode = currentNode->next;
+            linkReleasedNode(currentNode, firstReleased, lastReleased);
+            currentNode = nextNode;
+        }
+        bool checkAllNodes = (firstReleased == nullptr);
+        while (currentNode != nullptr) {
+            auto nextNode = currentNode->next;
+            if (checkAllNodes && currentNode->tagForCpuAccess->canBeReleased()) {
+                linkReleasedNode(currentNode, firstReleased, lastReleased);
+            } else {
+                pendingDeferredTags.pushTailOne(*currentNode);
+            }
+            currentNode = nextNode;
+        }
+
+        if (firstReleased != nullptr) {
+            pushToFreeStack(firstReleased, lastReleased);
+        }
+        if (!pendingDeferredTags.peekIsEmpty()) {
+            // tags returned while the list was detached are newer than the pending ones
+            deferredTags.spliceFront(*pendingDeferredTags.detachNodes());
+        }
+    }
+
+    void linkReleasedNode(NodeType *node, NodeType *&first, NodeType *&last) {
+        node->prev = nullptr;
+        node->next = nullptr;
+        if (last == nullptr) {
+            first = node;
+        } else {
+            last->nextFreeStackReference.store(node->freeStackReference, std::memory_order_relaxed);
+        }
+        last = node;
+    }
+
     MOCKABLE_VIRTUAL void returnTagToFreePool(NodeType *node) {
         NodeType *usedNode = usedTags.removeOne(*node).release();
         DEBUG_BREAK_IF(usedNode == nullptr);
@@ -143,17 +337,34 @@ class TagAllocator {
 
         NodeType *nodesMemory = new NodeType[nodeCount];
 
+        auto poolIndex = static_cast<uint32_t>(tagPoolMemory.size());
+        if (useThreadCache) {
+            UNRECOVERABLE_IF(poolIndex >= maxPoolsCount || nodeCount >= (1u << poolReferenceShift));
+            poolBases[poolIndex].store(nodesMemory, std::memory_order_release);
+        }
+
         for (size_t i = 0; i < nodeCount; ++i) {
             nodesMemory[i].allocator = this;
             nodesMemory[i].gfxAllocation = graphicsAllocation;
             nodesMemory[i].tagForCpuAccess = reinterpret_cast<TagType *>(Start);
             nodesMemory[i].gpuAddress = gpuBaseAddress + (i * tagSize);
-            freeTags.pushTailOne(nodesMemory[i]);
+            if (useThreadCache) {
+                nodesMemory[i].freeStackReference = (poolIndex << poolReferenceShift) + static_cast<uint32_t>(i) + 1;
+                if (i > 0) {
+                    nodesMemory[i - 1].nextFreeStackReference.store(nodesMemory[i].freeStackReference, std::memory_order_relaxed);
+                }
+            } else {
+                freeTags.pushTailOne(nodesMemory[i]);
+            }
             Start += tagSize;
         }
         DEBUG_BREAK_IF(Start > End);
         ((void)(End));
         tagPoolMemory.push_back(nodesMemory);
+
+        if (useThreadCache && nodeCount > 0) {
+            pushToFreeStack(&nodesMemory[0], &nodesMemory[nodeCount - 1]);
+        }
     }
 
     void releaseDeferredTags() {
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "core/memory_manager/memory_constants.h"
+#include "runtime/aub/dirty_page_tracker.h"
+
+#include "gtest/gtest.h"
+
+#include <utility>
+#include <vector>
+
+using namespace NEO;
+
+struct DirtyPageTrackerTest : public ::testing::Test {
+    void writeDirtyRanges(uint64_t gpuAddress, const void *cpuAddress, size_t size, uint32_t memoryBank = 0, uint64_t entryBits = 3) {
+        writtenRanges.clear();
+        tracker.writeDirtyRanges(gpuAddress, cpuAddress, size, memoryBank, entryBits, [&](size_t offset, size_t rangeSize) {
+            writtenRanges.push_back({offset, rangeSize});
+        });
+    }
+
+    DirtyPageTracker tracker;
+    std::vector<std::pair<size_t, size_t>> writtenRanges;
+    const uint64_t gpuAddress = 0x10000;
+    const size_t pageSize = MemoryConstants::pageSize;
+};
+
+TEST_F(DirtyPageTrackerTest, givenRangeWrittenForFirstTimeWhenWritingDirtyRangesThenWholeRangeIsWritten) {
+    std::vector<char> memory(4 * pageSize, 1);
+
+    writeDirtyRanges(gpuAddress, memory.data(), memory.size());
+
+    ASSERT_EQ(1u, writtenRanges.size());
+    EXPECT_EQ(0u, writtenRanges[0].first);
+    EXPECT_EQ(memory.size(), writtenRanges[0].second);
+    EXPECT_EQ(memory.size(), tracker.peekBytesWritten());
+    EXPECT_EQ(0u, tracker.peekBytesSkipped());
+}
+
+TEST_F(DirtyPageTrackerTest, givenModifiedPagesWhenWritingDirtyRangesAgainThenOnlyRunsOfModifiedPagesAreWritten) {
+    std::vector<char> memory(4 * pageSize, 1);
+    writeDirtyRanges(gpuAddress, memory.data(), memory.size());
+    tracker.resetStatistics();
+
+    memory[0] = 2;
+    memory[2 * pageSize] = 2;
+    memory[3 * pageSize + 1] = 2;
+    writeDirtyRanges(gpuAddress, memory.data(), memory.size());
+
+    ASSERT_EQ(2u, writtenRanges.size());
+    EXPECT_EQ(0u, writtenRanges[0].first);
+    EXPECT_EQ(pageSize, writtenRanges[0].second);
+    EXPECT_EQ(2 * pageSize, writtenRanges[1].first);
+    EXPECT_EQ(2 * pageSize, writtenRanges[1].second);
+    EXPECT_EQ(3 * pageSize, tracker.peekBytesWritten());
+    EXPECT_EQ(pageSize, tracker.peekBytesSkipped());
+}
+
+TEST_F(DirtyPageTrackerTest, givenUnalignedRangeWhenWritingDirtyRangesThenPagesAreSplitOnGpuPageBoundaries) {
+    std::vector<char> memory(2 * pageSize, 1);
+    auto unalignedGpuAddress = gpuAddress + pageSize / 2;
+    writeDirtyRanges(unalignedGpuAddress, memory.data(), memory.size());
+
+    memory[pageSize] = 2;
+    writeDirtyRanges(unalignedGpuAddress, memory.data(), memory.size());
+
+    ASSERT_EQ(1u, writtenRanges.size());
+    EXPECT_EQ(pageSize / 2, writtenRanges[0].first);
+    EXPECT_EQ(pageSize, writtenRanges[0].second);
+}
+
+TEST_F(DirtyPageTrackerTest, givenInvalidatedPagesOrTrackerResetWhenWritingDirtyRangesThenThesePagesAreWrittenAgain) {
+    std::vector<char> memory(3 * pageSize, 1);
+    writeDirtyRanges(gpuAddress, memory.data(), memory.size());
+    EXPECT_EQ(3u, tracker.peekTrackedPagesCount());
+
+    tracker.invalidate(gpuAddress + pageSize, pageSize);
+    EXPECT_EQ(2u, tracker.peekTrackedPagesCount());
+    writeDirtyRanges(gpuAddress, memory.data(), memory.size());
+    ASSERT_EQ(1u, writtenRanges.size());
+    EXPECT_EQ(pageSize, writtenRanges[0].first);
+    EXPECT_EQ(pageSize, writtenRanges[0].second);
+
+    tracker.reset();
+    EXPECT_EQ(0u, tracker.peekTrackedPagesCount());
+    writeDirtyRanges(gpuAddress, memory.data(), memory.size());
+    ASSERT_EQ(1u, writtenRanges.size());
+    EXPECT_EQ(memory.size(), writtenRanges[0].second);
+}
+
+TEST_F(DirtyPageTrackerTest, givenUnchangedContentsWhenMemoryBankOrEntryBitsChangeThenPagesAreWrittenAgain) {
+    std::vector<char> memory(pageSize, 1);
+    writeDirtyRanges(gpuAddress, memory.data(), memory.size(), 0, 3);
+
+    writeDirtyRanges(gpuAddress, memory.data(), memory.size(), 1, 3);
+    EXPECT_EQ(1u, writtenRanges.size());
+
+    writeDirtyRanges(gpuAddress, memory.data(), memory.size(), 1, 7);
+    EXPECT_EQ(1u, writtenRanges.size());
+
+    writeDirtyRanges(gpuAddress, memory.data(), memory.size(), 1, 7);
+    EXPECT_TRUE(writtenRanges.empty());
+}
@@ -0,0 +1,222 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/aub_mem_dump/aub_file_writer.h"
+#include "runtime/aub_mem_dump/aub_mem_dump.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <thread>
+
+using namespace AubMemDump;
+
+TEST(AubFileWriterTest, givenWritesExceedingBufferSizeWhenFlushedThenOutputContainsAllDataInOrder) {
+    std::ostringstream output;
+    std::string expected;
+    {
+        AubFileWriter writer(output, 16);
+        for (int i = 0; i < 100; i++) {
+            std::string record = "record" + std::to_string(i) + ";";
+            expected += record;
+            writer.write(record.c_str(), record.size());
+        }
+        writer.flush();
+        EXPECT_EQ(expected, output.str());
+
+        std::string largeRecord(64, 'x');
+        expected += largeRecord;
+        writer.write(largeRecord.c_str(), largeRecord.size());
+    }
+    EXPECT_EQ(expected, output.str());
+}
+
+TEST(AubFileWriterTest, givenNoWritesWhenWriterIsDestroyedThenOutputIsEmpty) {
+    std::ostringstream output;
+    {
+        AubFileWriter writer(output, 16);
+        writer.flush();
+    }
+    EXPECT_TRUE(output.str().empty());
+}
+
+struct BlockingStreamBuf : public std::streambuf {
+    std::streamsize xsputn(const char *data, std::streamsize size) override {
+        std::unique_lock<std::mutex> lock(mtx);
+        writeStarted = true;
+        writeStartedCondition.notify_all();
+        releaseCondition.wait(lock, [this] { return released; });
+        written.append(data, static_cast<size_t>(size));
+        return size;
+    }
+
+    void waitForWriteStarted() {
+        std::unique_lock<std::mutex> lock(mtx);
+        writeStartedCondition.wait(lock, [this] { return writeStarted; });
+    }
+
+    void release() {
+        std::unique_lock<std::mutex> lock(mtx);
+        released = true;
+        releaseCondition.notify_all();
+    }
+
+    std::mutex mtx;
+    std::condition_variable writeStartedCondition;
+    std::condition_variable releaseCondition;
+    bool writeStarted = false;
+    bool released = false;
+    std::string written;
+};
+
+TEST(AubFileWriterTest, givenWriteInProgressWhenSubmittingThenSubmitReturnsWithoutWaitingForOutput) {
+    BlockingStreamBuf streamBuf;
+    std::ostream output(&streamBuf);
+    {
+        AubFileWriter writer(output, 16);
+        writer.write("AAAAAAAA", 8);
+        writer.submit();
+        streamBuf.waitForWriteStarted();
+
+        writer.write("BBBBBBBB", 8);
+        writer.submit();
+        writer.write("CCCCCCCC", 8);
+        writer.submit();
+        EXPECT_TRUE(streamBuf.written.empty());
+
+        streamBuf.release();
+    }
+    EXPECT_EQ("AAAAAAAABBBBBBBBCCCCCCCC", streamBuf.written);
+}
+
+struct MockAubFileWriter : public AubFileWriter {
+    using AubFileWriter::AubFileWriter;
+
+    size_t getPendingBufferSize() {
+        std::unique_lock<std::mutex> lock(mtx);
+        return pendingBuffer.size();
+    }
+};
+
+TEST(AubFileWriterTest, givenWriteInProgressWhenSubmittingMoreThanBufferSizeThenPendingBufferStaysBoundedAndSubmitBlocks) {
+    BlockingStreamBuf streamBuf;
+    std::ostream output(&streamBuf);
+    const size_t bufferSize = 16;
+    const size_t submissionsCount = 10;
+    std::string expected = "AAAAAAAA";
+    std::atomic<size_t> submissionsDone(0);
+    size_t maxPendingBufferSize = 0;
+    {
+        MockAubFileWriter writer(output, bufferSize);
+        writer.write("AAAAAAAA", 8);
+        writer.submit();
+        streamBuf.waitForWriteStarted();
+
+        std::string records;
+        for (size_t i = 0; i < submissionsCount; i++) {
+            records += std::string(8, static_cast<char>('B' + i));
+        }
+        expected += records;
+
+        std::thread submitter([&] {
+            for (size_t i = 0; i < submissionsCount; i++) {
+                writer.write(records.c_str() + i * 8, 8);
+                writer.submit();
+                maxPendingBufferSize = std::max(maxPendingBufferSize, writer.getPendingBufferSize());
+                submissionsDone++;
+            }
+        });
+
+        while (submissionsDone < 2) {
+            std::this_thread::yield();
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        EXPECT_EQ(2u, submissionsDone);
+        EXPECT_EQ(bufferSize, writer.getPendingBufferSize());
+        EXPECT_TRUE(streamBuf.written.empty());
+
+        streamBuf.release();
+        submitter.join();
+    }
+    EXPECT_EQ(submissionsCount, submissionsDone);
+    EXPECT_GE(bufferSize, maxPendingBufferSize);
+    EXPECT_EQ(expected, streamBuf.written);
+}
+
+TEST(AubFileWriterTest, givenAubFileStreamWithWriterWhenFlushingWhileWriteIsInProgressThenFlushReturns) {
+    BlockingStreamBuf streamBuf;
+    std::ostream output(&streamBuf);
+    AubFileStream stream;
+    stream.fileWriter = std::make_unique<AubFileWriter>(output, 16);
+
+    stream.write("AAAAAAAA", 8);
+    stream.flush();
+    streamBuf.waitForWriteStarted();
+
+    stream.write("BBBBBBBB", 8);
+    stream.flush();
+    EXPECT_TRUE(streamBuf.written.empty());
+
+    streamBuf.release();
+    stream.fileWriter.reset();
+    EXPECT_EQ("AAAAAAAABBBBBBBB", streamBuf.written);
+}
+
+TEST(AubFileWriterTest, givenSubmissionPerFlushWhenWritingToFileThenOutputMatchesSynchronousWrites) {
+    const char *syncFileName = "aub_file_writer_sync.aub";
+    const char *asyncFileName = "aub_file_writer_async.aub";
+    const size_t submissionsCount = 64;
+    std::string record(64 * 1024, 0);
+
+    auto writeSubmissions = [&](const char *fileName, bool async) {
+        std::ofstream file(fileName, std::ofstream::binary);
+        std::unique_ptr<AubFileWriter> writer(async ? new AubFileWriter(file, 1024 * 1024) : nullptr);
+        std::chrono::nanoseconds submitTime(0);
+        for (size_t i = 0; i < submissionsCount; i++) {
+            record.assign(record.size(), static_cast<char>('a' + i % 26));
+            auto start = std::chrono::steady_clock::now();
+            if (writer) {
+                writer->write(record.c_str(), record.size());
+                writer->submit();
+            } else {
+                file.write(record.c_str(), record.size());
+                file.flush();
+            }
+            submitTime += std::chrono::steady_clock::now() - start;
+        }
+        writer.reset();
+        return std::chrono::duration_cast<std::chrono::microseconds>(submitTime).count() / static_cast<long long>(submissionsCount);
+    };
+
+    auto syncSubmitUs = writeSubmissions(syncFileName, false);
+    auto asyncSubmitUs = writeSubmissions(asyncFileName, true);
+
+    std::ifstream syncFile(syncFileName, std::ifstream::binary);
+    std::ifstream asyncFile(asyncFileName, std::ifstream::binary);
+    std::string syncContents((std::istreambuf_iterator<char>(syncFile)), std::istreambuf_iterator<char>());
+    std::string asyncContents((std::istreambuf_iterator<char>(asyncFile)), std::istreambuf_iterator<char>());
+    syncFile.close();
+    asyncFile.close();
+    std::remove(syncFileName);
+    std::remove(asyncFileName);
+
+    EXPECT_EQ(submissionsCount * record.size(), asyncContents.size());
+    EXPECT_TRUE(syncContents == asyncContents);
+
+    RecordProperty("synchronousSubmitUs", std::to_string(syncSubmitUs));
+    RecordProperty("asynchronousSubmitUs", std::to_string(asyncSubmitUs));
+}
@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "core/helpers/aligned_memory.h"
+#include "runtime/command_queue/local_id_gen.h"
+#include "runtime/command_queue/local_ids_cache.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+
+using namespace NEO;
+
+struct MockLocalIdsCache : public LocalIdsCache {
+    using LocalIdsCache::entries;
+    using LocalIdsCache::findAndTouch;
+    using LocalIdsCache::LocalIdsCache;
+};
+
+struct LocalIdsCacheTest : public ::testing::Test {
+    void SetUp() override {
+        generated = allocateAlignedMemory(bufferSize, 32);
+        cached = allocateAlignedMemory(bufferSize, 32);
+        memset(generated.get(), 0, bufferSize);
+    }
+
+    size_t getLocalIdsSize(uint16_t simd, const std::array<uint16_t, 3> &localWorkSize) {
+        return getThreadsPerWG(simd, localWorkSize[0] * localWorkSize[1] * localWorkSize[2]) * getPerThreadSizeLocalIDs(simd);
+    }
+
+    static constexpr size_t bufferSize = 64 * 1024;
+    const std::array<uint8_t, 3> walkOrder = {{0, 1, 2}};
+    std::unique_ptr<void, std::function<decltype(alignedFree)>> generated;
+    std::unique_ptr<void, std::function<decltype(alignedFree)>> cached;
+};
+
+TEST_F(LocalIdsCacheTest, givenEmptyCacheWhenLocalIdsAreSetThenTheyMatchGeneratedLocalIdsAndMissIsCounted) {
+    MockLocalIdsCache cache(4u);
+    std::array<uint16_t, 3> localWorkSize = {{8, 4, 2}};
+    auto size = getLocalIdsSize(16, localWorkSize);
+
+    generateLocalIDs(generated.get(), 16, localWorkSize, walkOrder, false);
+    cache.setLocalIds(cached.get(), size, 16, localWorkSize, walkOrder, false);
+
+    EXPECT_EQ(0, memcmp(generated.get(), cached.get(), size));
+    EXPECT_EQ(1u, cache.getNumEntries());
+    EXPECT_EQ(0u, cache.getHits());
+    EXPECT_EQ(1u, cache.getMisses());
+}
+
+TEST_F(LocalIdsCacheTest, givenCachedLocalIdsWhenTheSameDispatchIsSetAgainThenCachedLocalIdsAreCopiedAndHitIsCounted) {
+    MockLocalIdsCache cache(4u);
+    std::array<uint16_t, 3> localWorkSize = {{64, 1, 1}};
+    auto size = getLocalIdsSize(32, localWorkSize);
+
+    generateLocalIDs(generated.get(), 32, localWorkSize, walkOrder, false);
+    cache.setLocalIds(cached.get(), size, 32, localWorkSize, walkOrder, false);
+    memset(cached.get(), 0, size);
+    cache.setLocalIds(cached.get(), size, 32, localWorkSize, walkOrder, false);
+
+    EXPECT_EQ(0, memcmp(generated.get(), cached.get(), size));
+    EXPECT_EQ(1u, cache.getNumEntries());
+    EXPECT_EQ(1u, cache.getHits());
+    EXPECT_EQ(1u, cache.getMisses());
+}
+
+TEST_F(LocalIdsCacheTest, givenDispatchesDifferingInOneKeyComponentWhenLocalIdsAreSetThenSeparateEntriesAreCreated) {
+    MockLocalIdsCache cache(8u);
+    std::array<uint16_t, 3> localWorkSize = {{4, 4, 4}};
+    std::array<uint8_t, 3> otherWalkOrder = {{2, 1, 0}};
+
+    cache.setLocalIds(cached.get(), getLocalIdsSize(8, localWorkSize), 8, localWorkSize, walkOrder, false);
+    cache.setLocalIds(cached.get(), getLocalIdsSize(16, localWorkSize), 16, localWorkSize, walkOrder, false);
+    cache.setLocalIds(cached.get(), getLocalIdsSize(8, localWorkSize), 8, localWorkSize, otherWalkOrder, false);
+    cache.setLocalIds(cached.get(), getLocalIdsSize(8, localWorkSize), 8, localWorkSize, walkOrder, true);
+    cache.setLocalIds(cached.get(), getLocalIdsSize(8, {{4, 4, 2}}), 8, {{4, 4, 2}}, walkOrder, false);
+
+    EXPECT_EQ(5u, cache.getNumEntries());
+    EXPECT_EQ(0u, cache.getHits());
+    EXPECT_EQ(5u, cache.getMisses());
+
+    generateLocalIDs(generated.get(), 8, localWorkSize, otherWalkOrder, false);
+    cache.setLocalIds(cached.get(), getLocalIdsSize(8, localWorkSize), 8, localWorkSize, otherWalkOrder, false);
+    EXPECT_EQ(0, memcmp(generated.get(), cached.get(), getLocalIdsSize(8, localWorkSize)));
+    EXPECT_EQ(1u, cache.getHits());
+}
+
+TEST_F(LocalIdsCacheTest, givenFullCacheWhenNewDispatchIsSetThenLeastRecentlyUsedEntryIsReplaced) {
+    MockLocalIdsCache cache(2u);
+    std::array<uint16_t, 3> lwsA = {{16, 1, 1}};
+    std::array<uint16_t, 3> lwsB = {{32, 1, 1}};
+    std::array<uint16_t, 3> lwsC = {{256, 1, 1}};
+
+    cache.setLocalIds(cached.get(), getLocalIdsSize(16, lwsA), 16, lwsA, walkOrder, false);
+    cache.setLocalIds(cached.get(), getLocalIdsSize(16, lwsB), 16, lwsB, walkOrder, false);
+    cache.setLocalIds(cached.get(), getLocalIdsSize(16, lwsA), 16, lwsA, walkOrder, false);
+    cache.setLocalIds(cached.get(), getLocalIdsSize(16, lwsC), 16, lwsC, walkOrder, false);
+
+    EXPECT_EQ(2u, cache.getNumEntries());
+    ASSERT_EQ(2u, cache.entries.size());
+    EXPECT_EQ(lwsC, cache.entries.front().key.localWorkSize);
+    EXPECT_EQ(getLocalIdsSize(16, lwsC), cache.entries.front().localIdsSize);
+    EXPECT_EQ(lwsA, cache.entries.back().key.localWorkSize);
+
+    generateLocalIDs(generated.get(), 16, lwsC, walkOrder, false);
+    EXPECT_EQ(0, memcmp(generated.get(), cached.get(), getLocalIdsSize(16, lwsC)));
+}
+
+TEST_F(LocalIdsCacheTest, givenSizeDifferentFromGeneratedLocalIdsWhenLocalIdsAreSetThenTheyAreGeneratedWithoutCaching) {
+    MockLocalIdsCache cache(4u);
+    std::array<uint16_t, 3> localWorkSize = {{16, 2, 1}};
+    auto size = getLocalIdsSize(16, localWorkSize);
+
+    generateLocalIDs(generated.get(), 16, localWorkSize, walkOrder, false);
+    cache.setLocalIds(cached.get(), size + 32, 16, localWorkSize, walkOrder, false);
+
+    EXPECT_EQ(0, memcmp(generated.get(), cached.get(), size));
+    EXPECT_EQ(0u, cache.getNumEntries());
+    EXPECT_EQ(0u, cache.getHits());
+    EXPECT_EQ(0u, cache.getMisses());
+}
+
+TEST_F(LocalIdsCacheTest, givenCachedLocalIdsWhenEntryIsEvictedThenLocalIdsObtainedBeforeEvictionStayValid) {
+    MockLocalIdsCache cache(1u);
+    std::array<uint16_t, 3> lwsA = {{32, 1, 1}};
+    std::array<uint16_t, 3> lwsB = {{64, 1, 1}};
+    LocalIdsCache::Key keyA = {lwsA, walkOrder, 16, false};
+
+    cache.setLocalIds(cached.get(), getLocalIdsSize(16, lwsA), 16, lwsA, walkOrder, false);
+    auto localIds = cache.findAndTouch(keyA);
+    ASSERT_NE(nullptr, localIds);
+
+    cache.setLocalIds(cached.get(), getLocalIdsSize(16, lwsB), 16, lwsB, walkOrder, false);
+    EXPECT_EQ(nullptr, cache.findAndTouch(keyA));
+    EXPECT_EQ(1u, cache.getNumEntries());
+
+    generateLocalIDs(generated.get(), 16, lwsA, walkOrder, false);
+    EXPECT_EQ(0, memcmp(generated.get(), localIds.get(), getLocalIdsSize(16, lwsA)));
+}
@@ -0,0 +1,228 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_queue/command_queue_hw.h"
+#include "runtime/command_queue/recorded_dispatch_sequence.h"
+#include "runtime/event/event.h"
+#include "test.h"
+#include "unit_tests/fixtures/hello_world_fixture.h"
+#include "unit_tests/helpers/hw_parse.h"
+#include "unit_tests/mocks/mock_kernel.h"
+#include "unit_tests/mocks/mock_mdi.h"
+
+using namespace NEO;
+
+template <typename FixtureFactory>
+struct RecordedDispatchSequenceFixture : public HelloWorldFixture<FixtureFactory>,
+                                         public HardwareParse,
+                                         public ::testing::Test {
+    typedef HelloWorldFixture<FixtureFactory> ParentClass;
+
+    void SetUp() override {
+        ParentClass::SetUp();
+        HardwareParse::SetUp();
+    }
+
+    void TearDown() override {
+        HardwareParse::TearDown();
+        ParentClass::TearDown();
+    }
+
+    cl_int recordKernels(uint32_t count) {
+        this->pCmdQ->beginCapture(sequence);
+        for (uint32_t i = 0; i < count; i++) {
+            auto retVal = this->pCmdQ->enqueueKernel(this->pKernel, 1, nullptr, globalWorkSize, localWorkSize, 0, nullptr, nullptr);
+            if (retVal != CL_SUCCESS) {
+                this->pCmdQ->endCapture();
+                return retVal;
+            }
+        }
+        this->pCmdQ->endCapture();
+        return CL_SUCCESS;
+    }
+
+    template <typename FamilyType>
+    size_t countStallingPipeControlsBetweenWalkers() {
+        using GPGPU_WALKER = typename FamilyType::GPGPU_WALKER;
+        using PIPE_CONTROL = typename FamilyType::PIPE_CONTROL;
+        this->template parseCommands<FamilyType>(*this->pCmdQ);
+
+        auto walkers = findAll<GPGPU_WALKER *>(cmdList.begin(), cmdList.end());
+        size_t stallsBetweenWalkers = 0;
+        for (size_t i = 1; i < walkers.size(); i++) {
+            for (auto pipeControl : findAll<PIPE_CONTROL *>(walkers[i - 1], walkers[i])) {
+                if (genCmdCast<PIPE_CONTROL *>(*pipeControl)->getCommandStreamerStallEnable()) {
+                    stallsBetweenWalkers++;
+                    break;
+                }
+            }
+        }
+        return stallsBetweenWalkers;
+    }
+
+    size_t globalWorkSize[3] = {16, 1, 1};
+    size_t localWorkSize[3] = {16, 1, 1};
+    RecordedDispatchSequence sequence;
+};
+
+struct OOQFixtureFactory : public HelloWorldFixtureFactory {
+    typedef OOQueueFixture CommandQueueFixture;
+};
+
+using RecordedDispatchSequenceTest = RecordedDispatchSequenceFixture<HelloWorldFixtureFactory>;
+using RecordedDispatchSequenceOOQTest = RecordedDispatchSequenceFixture<OOQFixtureFactory>;
+
+TEST_F(RecordedDispatchSequenceTest, givenCapturingQueueWhenKernelsAreEnqueuedThenTheyAreRecordedAndNotSubmitted) {
+    auto taskCountBefore = pCmdQ->taskCount;
+    auto commandStreamUsedBefore = pCmdQ->getCS(0).getUsed();
+
+    EXPECT_EQ(CL_SUCCESS, recordKernels(3));
+
+    EXPECT_FALSE(pCmdQ->isCapturing());
+    EXPECT_EQ(taskCountBefore, pCmdQ->taskCount);
+    EXPECT_EQ(commandStreamUsedBefore, pCmdQ->getCS(0).getUsed());
+    EXPECT_EQ(3u, sequence.getNumSlots());
+    EXPECT_EQ(3u, sequence.getMultiDispatchInfo().size());
+    for (size_t slot = 0; slot < sequence.getNumSlots(); slot++) {
+        EXPECT_NE(nullptr, sequence.getRecordedKernel(slot));
+        EXPECT_NE(pKernel, sequence.getRecordedKernel(slot));
+    }
+    EXPECT_EQ(nullptr, sequence.getRecordedKernel(3));
+}
+
+TEST_F(RecordedDispatchSequenceTest, givenCapturingQueueWhenKernelIsEnqueuedWithEventsThenErrorIsReturned) {
+    cl_event event = nullptr;
+    pCmdQ->beginCapture(sequence);
+    EXPECT_EQ(CL_INVALID_OPERATION, pCmdQ->enqueueKernel(pKernel, 1, nullptr, globalWorkSize, localWorkSize, 0, nullptr, &event));
+    EXPECT_EQ(CL_INVALID_OPERATION, pCmdQ->enqueueRecordedSequence(sequence, 0, nullptr, nullptr));
+    pCmdQ->endCapture();
+
+    EXPECT_EQ(nullptr, event);
+    EXPECT_EQ(0u, sequence.getNumSlots());
+}
+
+TEST_F(RecordedDispatchSequenceTest, givenRecordedKernelWhenOriginalKernelArgumentChangesThenRecordedSlotKeepsItsArgument) {
+    ASSERT_EQ(CL_SUCCESS, recordKernels(1));
+    auto recordedKernel = sequence.getRecordedKernel(0);
+    EXPECT_EQ(srcBuffer, recordedKernel->getKernelArg(0));
+    EXPECT_EQ(destBuffer, recordedKernel->getKernelArg(1));
+
+    pKernel->setArg(0, destBuffer);
+    EXPECT_EQ(srcBuffer, recordedKernel->getKernelArg(0));
+
+    cl_mem newArg = destBuffer;
+    EXPECT_EQ(CL_SUCCESS, sequence.setKernelArg(0, 0, sizeof(cl_mem), &newArg));
+    EXPECT_EQ(destBuffer, recordedKernel->getKernelArg(0));
+    EXPECT_EQ(CL_INVALID_VALUE, sequence.setKernelArg(1, 0, sizeof(cl_mem), &newArg));
+}
+
+TEST_F(RecordedDispatchSequenceTest, givenRecordedSequenceWhenItIsReplayedThenAllKernelsAreSubmittedAsOneTask) {
+    ASSERT_EQ(CL_SUCCESS, recordKernels(4));
+    auto taskCountBefore = pCmdQ->taskCount;
+
+    cl_event event = nullptr;
+    EXPECT_EQ(CL_SUCCESS, pCmdQ->enqueueRecordedSequence(sequence, 0, nullptr, &event));
+    EXPECT_EQ(taskCountBefore + 1, pCmdQ->taskCount);
+    ASSERT_NE(nullptr, event);
+    EXPECT_EQ(static_cast<cl_command_type>(CL_COMMAND_NDRANGE_KERNEL), castToObject<Event>(event)->getCommandType());
+    castToObject<Event>(event)->release();
+
+    EXPECT_EQ(CL_SUCCESS, pCmdQ->enqueueRecordedSequence(sequence, 0, nullptr, nullptr));
+    EXPECT_EQ(taskCountBefore + 2, pCmdQ->taskCount);
+}
+
+HWCMDTEST_F(IGFX_GEN8_CORE, RecordedDispatchSequenceTest, givenRecordedSequenceWhenItIsReplayedThenWalkerIsProgrammedForEachRecordedKernel) {
+    using GPGPU_WALKER = typename FamilyType::GPGPU_WALKER;
+    ASSERT_EQ(CL_SUCCESS, recordKernels(4));
+
+    EXPECT_EQ(CL_SUCCESS, pCmdQ->enqueueRecordedSequence(sequence, 0, nullptr, nullptr));
+    parseCommands<FamilyType>(*pCmdQ);
+
+    auto walkers = findAll<GPGPU_WALKER *>(cmdList.begin(), cmdList.end());
+    EXPECT_EQ(4u, walkers.size());
+}
+
+TEST_F(RecordedDispatchSequenceTest, givenEmptySequenceWhenItIsReplayedThenSuccessIsReturned) {
+    EXPECT_EQ(CL_SUCCESS, pCmdQ->enqueueRecordedSequence(sequence, 0, nullptr, nullptr));
+}
+
+HWCMDTEST_F(IGFX_GEN8_CORE, RecordedDispatchSequenceTest, givenInOrderQueueWhenSecondKernelReadsOutputOfFirstKernelThenStallingPipeControlIsProgrammedBetweenWalkers) {
+    ASSERT_EQ(CL_SUCCESS, recordKernels(2));
+    cl_mem firstKernelOutput = destBuffer;
+    cl_mem secondKernelOutput = srcBuffer;
+    EXPECT_EQ(CL_SUCCESS, sequence.setKernelArg(1, 0, sizeof(cl_mem), &firstKernelOutput));
+    EXPECT_EQ(CL_SUCCESS, sequence.setKernelArg(1, 1, sizeof(cl_mem), &secondKernelOutput));
+
+    EXPECT_EQ(0u, sequence.getMultiDispatchInfo().begin()[0].dispatchInitCommands.estimateCommandsSize());
+    EXPECT_EQ(sizeof(typename FamilyType::PIPE_CONTROL), sequence.getMultiDispatchInfo().begin()[1].dispatchInitCommands.estimateCommandsSize());
+
+    EXPECT_EQ(CL_SUCCESS, pCmdQ->enqueueRecordedSequence(sequence, 0, nullptr, nullptr));
+    EXPECT_EQ(1u, countStallingPipeControlsBetweenWalkers<FamilyType>());
+}
+
+HWCMDTEST_F(IGFX_GEN8_CORE, RecordedDispatchSequenceOOQTest, givenOutOfOrderQueueWhenRecordedSequenceIsReplayedThenWalkersAreNotSeparatedByStall) {
+    ASSERT_EQ(CL_SUCCESS, recordKernels(2));
+    for (auto &dispatchInfo : sequence.getMultiDispatchInfo()) {
+        EXPECT_EQ(0u, dispatchInfo.dispatchInitCommands.estimateCommandsSize());
+    }
+
+    EXPECT_EQ(CL_SUCCESS, pCmdQ->enqueueRecordedSequence(sequence, 0, nullptr, nullptr));
+    EXPECT_EQ(0u, countStallingPipeControlsBetweenWalkers<FamilyType>());
+}
+
+TEST_F(RecordedDispatchSequenceTest, givenDifferentKernelsWhenSequenceIsReplayedThenNumGroupsAndLocalSizesArePatchedForEachKernel) {
+    MockKernelWithInternals firstKernel(*pDevice, &pCmdQ->getContext());
+    MockKernelWithInternals secondKernel(*pDevice, &pCmdQ->getContext());
+    for (auto kernel : {&firstKernel, &secondKernel}) {
+        kernel->dataParameterStream.DataParameterStreamSize = 9 * sizeof(uint32_t);
+        for (uint32_t dim = 0; dim < 3; dim++) {
+            kernel->kernelInfo.workloadInfo.localWorkSizeOffsets[dim] = dim * sizeof(uint32_t);
+            kernel->kernelInfo.workloadInfo.localWorkSizeOffsets2[dim] = (3 + dim) * sizeof(uint32_t);
+            kernel->kernelInfo.workloadInfo.numWorkGroupsOffset[dim] = (6 + dim) * sizeof(uint32_t);
+        }
+    }
+    size_t firstGlobalWorkSize[3] = {32, 1, 1};
+    size_t firstLocalWorkSize[3] = {16, 1, 1};
+    size_t secondGlobalWorkSize[3] = {64, 1, 1};
+    size_t secondLocalWorkSize[3] = {8, 1, 1};
+
+    pCmdQ->beginCapture(sequence);
+    EXPECT_EQ(CL_SUCCESS, pCmdQ->enqueueKernel(firstKernel.mockKernel, 1, nullptr, firstGlobalWorkSize, firstLocalWorkSize, 0, nullptr, nullptr));
+    EXPECT_EQ(CL_SUCCESS, pCmdQ->enqueueKernel(secondKernel.mockKernel, 1, nullptr, secondGlobalWorkSize, secondLocalWorkSize, 0, nullptr, nullptr));
+    pCmdQ->endCapture();
+    ASSERT_EQ(2u, sequence.getNumSlots());
+    ASSERT_EQ(2u, sequence.getMultiDispatchInfo().size());
+
+    EXPECT_EQ(CL_SUCCESS, pCmdQ->enqueueRecordedSequence(sequence, 0, nullptr, nullptr));
+
+    const uint32_t expectedValues[2][9] = {{16, 1, 1, 16, 1, 1, 2, 1, 1},
+                                           {8, 1, 1, 8, 1, 1, 8, 1, 1}};
+    for (size_t slot = 0; slot < 2; slot++) {
+        auto recordedKernel = sequence.getRecordedKernel(slot);
+        ASSERT_EQ(9 * sizeof(uint32_t), recordedKernel->getCrossThreadDataSize());
+        auto crossThreadData = reinterpret_cast<const uint32_t *>(recordedKernel->getCrossThreadData());
+        for (size_t i = 0; i < 9; i++) {
+            EXPECT_EQ(expectedValues[slot][i], crossThreadData[i]) << "slot: " << slot << ", dword: " << i;
+        }
+    }
+}
+
+TEST_F(RecordedDispatchSequenceTest, givenRecordedKernelsWhenOnlyLaterKernelRequiresCacheFlushThenSequenceRequiresCacheFlush) {
+    MockKernelWithInternals firstKernel(*pDevice, &pCmdQ->getContext());
+    MockKernelWithInternals secondKernel(*pDevice, &pCmdQ->getContext());
+    MockMultiDispatchInfo multiDispatchInfo(std::vector<Kernel *>({firstKernel.mockKernel, secondKernel.mockKernel}));
+    multiDispatchInfo.setIndependentKernels(true);
+
+    firstKernel.mockKernel->cacheFlushCommandRequired = false;
+    secondKernel.mockKernel->cacheFlushCommandRequired = true;
+    EXPECT_EQ(secondKernel.mockKernel, multiDispatchInfo.peekKernelRequiringCacheFlush(*pCmdQ));
+    EXPECT_TRUE(multiDispatchInfo.isMainKernel(secondKernel.mockKernel));
+
+    multiDispatchInfo.setIndependentKernels(false);
+    EXPECT_EQ(nullptr, multiDispatchInfo.peekKernelRequiringCacheFlush(*pCmdQ));
+    EXPECT_FALSE(multiDispatchInfo.isMainKernel(secondKernel.mockKernel));
+}
@@ -548,6 +548,55 @@ HWTEST_F(AubFileStreamTests, givenAubCommandStreamReceiverWhenMakeResidentIsCall
     EXPECT_TRUE(aubCsr->writeMemoryCalled);
 }
 
+HWTEST_F(AubFileStreamTests, givenDirtyPageTrackingWhenUnchangedAllocationIsMadeResidentAgainThenItsMemoryIsNotWrittenAgain) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableAubDirtyPageTracking.set(true);
+    auto aubExecutionEnvironment = getEnvironment<MockAubCsr<FamilyType>>(true, true, true);
+    auto aubCsr = aubExecutionEnvironment->template getCsr<MockAubCsr<FamilyType>>();
+    ASSERT_NE(nullptr, aubCsr->dirtyPageTracker);
+
+    alignas(MemoryConstants::pageSize) static char memory[MemoryConstants::pageSize] = {};
+    MockGraphicsAllocation allocation(memory, sizeof(memory));
+    allocation.setAllocationType(GraphicsAllocation::AllocationType::KERNEL_ISA);
+    ResidencyContainer allocationsForResidency = {&allocation};
+    aubCsr->processResidency(allocationsForResidency);
+    EXPECT_TRUE(aubCsr->writeMemoryCalled);
+
+    aubCsr->writeMemoryCalled = false;
+    aubCsr->processResidency(allocationsForResidency);
+    EXPECT_FALSE(aubCsr->writeMemoryCalled);
+
+    memory[0]++;
+    aubCsr->processResidency(allocationsForResidency);
+    EXPECT_TRUE(aubCsr->writeMemoryCalled);
+
+    aubCsr->writeMemoryCalled = false;
+    aubCsr->onAllocationFreed(allocation);
+    EXPECT_EQ(0u, aubCsr->dirtyPageTracker->peekTrackedPagesCount());
+    aubCsr->processResidency(allocationsForResidency);
+    EXPECT_TRUE(aubCsr->writeMemoryCalled);
+}
+
+HWTEST_F(AubFileStreamTests, givenDirtyPageTrackingWhenGpuWritableAllocationIsMadeResidentAgainThenItsMemoryIsAlwaysWritten) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableAubDirtyPageTracking.set(true);
+    auto aubExecutionEnvironment = getEnvironment<MockAubCsr<FamilyType>>(true, true, true);
+    auto aubCsr = aubExecutionEnvironment->template getCsr<MockAubCsr<FamilyType>>();
+    ASSERT_NE(nullptr, aubCsr->dirtyPageTracker);
+
+    alignas(MemoryConstants::pageSize) static char memory[MemoryConstants::pageSize] = {};
+    MockGraphicsAllocation allocation(memory, sizeof(memory));
+    allocation.setAllocationType(GraphicsAllocation::AllocationType::BUFFER);
+    ResidencyContainer allocationsForResidency = {&allocation};
+    aubCsr->processResidency(allocationsForResidency);
+    EXPECT_TRUE(aubCsr->writeMemoryCalled);
+
+    aubCsr->writeMemoryCalled = false;
+    aubCsr->processResidency(allocationsForResidency);
+    EXPECT_TRUE(aubCsr->writeMemoryCalled);
+    EXPECT_EQ(0u, aubCsr->dirtyPageTracker->peekTrackedPagesCount());
+}
+
 HWTEST_F(AubFileStreamTests, givenAubCommandStreamReceiverWhenExpectMemoryEqualIsCalledThenItShouldCallTheExpectedFunctions) {
     auto aubExecutionEnvironment = getEnvironment<MockAubCsr<FamilyType>>(true, true, true);
     auto aubCsr = aubExecutionEnvironment->template getCsr<MockAubCsr<FamilyType>>();
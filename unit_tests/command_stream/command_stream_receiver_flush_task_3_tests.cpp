@@ -23,6 +23,8 @@
 #include "unit_tests/mocks/mock_program.h"
 #include "unit_tests/mocks/mock_submissions_aggregator.h"
 
+#include <thread>
+
 using namespace NEO;
 
 typedef UltCommandStreamReceiverTest CommandStreamReceiverFlushTaskTests;
@@ -1618,3 +1620,88 @@ HWTEST_F(CommandStreamReceiverFlushTaskTests, whenPerDssBackBufferProgrammingEna
 
     EXPECT_EQ(0u, commandStreamReceiver.createPerDssBackedBufferCalled);
 }
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrWhenFlushTaskIsCalledThenMocsIndexAndL3ConfigAreCachedForDevice) {
+    configureCSRtoNonDirtyState<FamilyType>();
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    flushTask(commandStreamReceiver);
+
+    auto &stateInputsCache = commandStreamReceiver.stateInputsCache;
+    auto &hwHelper = HwHelper::get(pDevice->getHardwareInfo().platform.eRenderCoreFamily);
+    EXPECT_EQ(pDevice, stateInputsCache.device);
+    EXPECT_TRUE(stateInputsCache.mocsIndexValid[L3CachingSettings::l3CacheOn]);
+    EXPECT_FALSE(stateInputsCache.mocsIndexValid[L3CachingSettings::l3CacheOff]);
+    EXPECT_EQ(hwHelper.getMocsIndex(*pDevice->getGmmHelper(), true, false), stateInputsCache.mocsIndex[L3CachingSettings::l3CacheOn]);
+    EXPECT_TRUE(stateInputsCache.l3ConfigValid[0]);
+    EXPECT_EQ(PreambleHelper<FamilyType>::getL3Config(pDevice->getHardwareInfo(), false), stateInputsCache.l3Config[0]);
+    EXPECT_EQ(commandStreamReceiver.latestSentStatelessMocsConfig, stateInputsCache.mocsIndex[L3CachingSettings::l3CacheOn]);
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenMocsIndexCachedForDeviceWhenFlushTaskIsCalledAgainThenCachedMocsIndexIsProgrammed) {
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    flushTask(commandStreamReceiver);
+    ASSERT_TRUE(commandStreamReceiver.stateInputsCache.mocsIndexValid[L3CachingSettings::l3CacheOn]);
+
+    auto cachedMocsIndex = commandStreamReceiver.stateInputsCache.mocsIndex[L3CachingSettings::l3CacheOn] + 1;
+    commandStreamReceiver.stateInputsCache.mocsIndex[L3CachingSettings::l3CacheOn] = cachedMocsIndex;
+    flushTask(commandStreamReceiver);
+
+    EXPECT_EQ(cachedMocsIndex, commandStreamReceiver.latestSentStatelessMocsConfig);
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInBatchingModeWithCounterWhenFlushCountIsReachedThenPendingCommandBuffersAreFlushedInSingleSubmission) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.BatchedDispatchFlushCount.set(3);
+
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pDevice, 0);
+    auto &commandStream = commandQueue.getCS(4096u);
+
+    auto mockCsr = new MockCsrHw2<FamilyType>(*pDevice->executionEnvironment);
+    pDevice->resetCommandStreamReceiver(mockCsr);
+    mockCsr->overrideDispatchPolicy(DispatchMode::BatchedDispatchWithCounter);
+
+    auto mockedSubmissionsAggregator = new mockSubmissionsAggregator();
+    mockCsr->overrideSubmissionAggregator(mockedSubmissionsAggregator);
+
+    DispatchFlags dispatchFlags = DispatchFlagsHelper::createDefaultDispatchFlags();
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+
+    for (uint32_t i = 0; i < 2; i++) {
+        mockCsr->flushTask(commandStream, 0, dsh, ioh, ssh, taskLevel, dispatchFlags, *pDevice);
+    }
+    EXPECT_EQ(0, mockCsr->flushCalledCount);
+    EXPECT_EQ(2u, mockedSubmissionsAggregator->peekPendingCommandBuffersCount());
+
+    mockCsr->flushTask(commandStream, 0, dsh, ioh, ssh, taskLevel, dispatchFlags, *pDevice);
+    EXPECT_EQ(1, mockCsr->flushCalledCount);
+    EXPECT_TRUE(mockedSubmissionsAggregator->peekCommandBuffers().peekIsEmpty());
+    EXPECT_EQ(0u, mockedSubmissionsAggregator->peekPendingCommandBuffersCount());
+    EXPECT_EQ(2u, mockCsr->peekSubmissionsSavedByBatching());
+    EXPECT_EQ(3u, mockCsr->peekLatestFlushedTaskCount());
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInBatchingModeWithCounterWhenOldestCommandBufferExceedsFlushTimeoutThenNextFlushTaskFlushesPendingCommandBuffers) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.BatchedDispatchFlushCount.set(100);
+    DebugManager.flags.BatchedDispatchFlushTimeoutMicroseconds.set(1000);
+
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pDevice, 0);
+    auto &commandStream = commandQueue.getCS(4096u);
+
+    auto mockCsr = new MockCsrHw2<FamilyType>(*pDevice->executionEnvironment);
+    pDevice->resetCommandStreamReceiver(mockCsr);
+    mockCsr->overrideDispatchPolicy(DispatchMode::BatchedDispatchWithCounter);
+
+    DispatchFlags dispatchFlags = DispatchFlagsHelper::createDefaultDispatchFlags();
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+
+    mockCsr->flushTask(commandStream, 0, dsh, ioh, ssh, taskLevel, dispatchFlags, *pDevice);
+    EXPECT_FALSE(mockCsr->isBatchedDispatchFlushThresholdReached());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    EXPECT_TRUE(mockCsr->isBatchedDispatchFlushThresholdReached());
+
+    mockCsr->flushTask(commandStream, 0, dsh, ioh, ssh, taskLevel, dispatchFlags, *pDevice);
+    EXPECT_EQ(1, mockCsr->flushCalledCount);
+    EXPECT_FALSE(mockCsr->isBatchedDispatchFlushThresholdReached());
+}
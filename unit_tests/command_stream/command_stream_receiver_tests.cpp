@@ -186,6 +186,25 @@ TEST_F(CommandStreamReceiverTest, makeResidentPushesAllocationToMemoryManagerRes
     memoryManager->freeGraphicsMemory(graphicsAllocation);
 }
 
+TEST_F(CommandStreamReceiverTest, givenAllocationsWhenMadeResidentInBulkThenEachAllocationIsAddedOnceWithSubmissionTaskCount) {
+    MockGraphicsAllocation allocation0;
+    MockGraphicsAllocation allocation1;
+    std::vector<GraphicsAllocation *> allocations = {&allocation0, &allocation1, &allocation0};
+    auto contextId = commandStreamReceiver->getOsContext().getContextId();
+    auto submissionTaskCount = commandStreamReceiver->peekTaskCount() + 1;
+
+    commandStreamReceiver->makeAllocationsResident(allocations);
+
+    auto &residencyAllocations = commandStreamReceiver->getResidencyAllocations();
+    ASSERT_EQ(2u, residencyAllocations.size());
+    EXPECT_EQ(&allocation0, residencyAllocations[0]);
+    EXPECT_EQ(&allocation1, residencyAllocations[1]);
+    EXPECT_EQ(submissionTaskCount, allocation0.getTaskCount(contextId));
+    EXPECT_EQ(submissionTaskCount, allocation1.getTaskCount(contextId));
+    EXPECT_EQ(submissionTaskCount, allocation0.getResidencyTaskCount(contextId));
+    EXPECT_EQ(submissionTaskCount, allocation1.getResidencyTaskCount(contextId));
+}
+
 TEST_F(CommandStreamReceiverTest, makeResidentWithoutParametersDoesNothing) {
     commandStreamReceiver->processResidency(commandStreamReceiver->getResidencyAllocations());
     auto &residencyAllocations = commandStreamReceiver->getResidencyAllocations();
@@ -572,6 +572,45 @@ TEST(SubmissionsAggregator, givenCommandBuffersRequiringDifferentSliceCountSetti
     EXPECT_EQ(1u, cmdBuffer->inspectionId);
 }
 
+TEST(SubmissionsAggregator, givenThirdCommandBufferIncompatibleWithPrimaryWhenAggregateIsCalledThenOnlyFirstTwoAreAggregated) {
+    MockSubmissionAggregator submissionsAggregator;
+
+    std::unique_ptr<Device> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    CommandBuffer *cmdBuffer = new CommandBuffer(*device);
+    CommandBuffer *cmdBuffer2 = new CommandBuffer(*device);
+    CommandBuffer *cmdBuffer3 = new CommandBuffer(*device);
+
+    cmdBuffer3->batchBuffer.low_priority = true;
+
+    submissionsAggregator.recordCommandBuffer(cmdBuffer);
+    submissionsAggregator.recordCommandBuffer(cmdBuffer2);
+    submissionsAggregator.recordCommandBuffer(cmdBuffer3);
+    EXPECT_EQ(3u, submissionsAggregator.peekPendingCommandBuffersCount());
+
+    ResourcePackage resourcePackage;
+    size_t totalUsedSize = 0;
+    size_t totalMemoryBudget = 200;
+    submissionsAggregator.aggregateCommandBuffers(resourcePackage, totalUsedSize, totalMemoryBudget, 0u);
+    EXPECT_EQ(cmdBuffer->inspectionId, cmdBuffer2->inspectionId);
+    EXPECT_NE(cmdBuffer->inspectionId, cmdBuffer3->inspectionId);
+    EXPECT_EQ(1u, submissionsAggregator.peekPendingCommandBuffersCount());
+    EXPECT_EQ(1u, submissionsAggregator.peekCoalescedCommandBuffersCount());
+}
+
+TEST(SubmissionsAggregator, givenNoPendingCommandBuffersWhenCommandBufferIsRecordedThenOldestPendingTimeIsUpdatedOnlyForFirstOne) {
+    MockSubmissionAggregator submissionsAggregator;
+
+    std::unique_ptr<Device> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    auto timeBeforeRecord = std::chrono::steady_clock::now();
+    submissionsAggregator.recordCommandBuffer(new CommandBuffer(*device));
+    auto oldestPendingTime = submissionsAggregator.peekOldestPendingCommandBufferTime();
+    EXPECT_LE(timeBeforeRecord, oldestPendingTime);
+
+    submissionsAggregator.recordCommandBuffer(new CommandBuffer(*device));
+    EXPECT_EQ(oldestPendingTime, submissionsAggregator.peekOldestPendingCommandBufferTime());
+    EXPECT_EQ(2u, submissionsAggregator.peekPendingCommandBuffersCount());
+}
+
 struct SubmissionsAggregatorTests : public ::testing::Test {
     void SetUp() override {
         device.reset(MockDevice::createWithNewExecutionEnvironment<MockDevice>(platformDevices[0]));
@@ -33,6 +33,8 @@
 #include "unit_tests/mocks/mock_mdi.h"
 #include "unit_tests/mocks/mock_os_context.h"
 #include "unit_tests/mocks/mock_tbx_csr.h"
+#include "unit_tests/mocks/mock_tbx_sockets.h"
+#include "unit_tests/mocks/mock_tbx_stream.h"
 
 #include "tbx_command_stream_fixture.h"
 
@@ -831,4 +833,22 @@ HWTEST_F(TbxCommandStreamTests, givenTbxCsrInNonSubCaptureModeWhenCheckAndActiva
     auto status = tbxCsr.checkAndActivateAubSubCapture(dispatchInfo);
     EXPECT_FALSE(status.isActive);
     EXPECT_FALSE(status.wasActiveInPreviousEnqueue);
-}
\ No newline at end of file
+}
+HWTEST_F(TbxCommandStreamTests, givenTbxCsrWithoutHardwareContextWhenBatchBufferIsSubmittedThenSocketIsFlushedAfterExeclistSubmission) {
+    MockTbxCsr<FamilyType> tbxCsr{*pDevice->executionEnvironment};
+    tbxCsr.aubManager = nullptr;
+    MockOsContext osContext(0, 1, aub_stream::ENGINE_RCS, PreemptionMode::Disabled, false);
+    tbxCsr.setupContext(osContext);
+    ASSERT_EQ(nullptr, tbxCsr.hardwareContextController.get());
+
+    auto mockTbxSocket = new MockTbxSockets();
+    static_cast<MockTbxStream &>(tbxCsr.tbxStream).socket = mockTbxSocket;
+    tbxCsr.initializeEngine();
+    EXPECT_EQ(0u, mockTbxSocket->flushCalled);
+
+    char batchBuffer[64] = {};
+    tbxCsr.submitBatchBuffer(0x10000, batchBuffer, sizeof(batchBuffer), MemoryBanks::MainBank, 0);
+
+    EXPECT_EQ(1u, mockTbxSocket->flushCalled);
+    EXPECT_EQ(0u, mockTbxSocket->writesSinceFlush);
+}
@@ -26,3 +26,16 @@ TEST(TbxStreamTests, givenTbxStreamWhenWriteMemoryIsCalledThenTypeIsZero) {
     mockTbxStream->writePTE(0, 0, 0);
     EXPECT_EQ(0u, mockTbxSocket->typeCapturedFromWriteMemory);
 }
+
+TEST(TbxStreamTests, givenTbxStreamWhenFlushIsCalledThenSocketIsFlushed) {
+    MockTbxStream tbxStream;
+    MockTbxSockets *mockTbxSocket = new MockTbxSockets();
+    tbxStream.socket = mockTbxSocket;
+
+    tbxStream.writeMMIO(0x2000, 1);
+    EXPECT_EQ(1u, mockTbxSocket->writesSinceFlush);
+
+    tbxStream.flush();
+    EXPECT_EQ(1u, mockTbxSocket->flushCalled);
+    EXPECT_EQ(0u, mockTbxSocket->writesSinceFlush);
+}
@@ -9,6 +9,7 @@
 #include "test.h"
 #include <core/helpers/aligned_memory.h>
 #include <core/helpers/string.h>
+#include <core/os_interface/os_mapped_file.h>
 #include <runtime/compiler_interface/binary_cache.h>
 #include <runtime/helpers/hash.h>
 #include <runtime/helpers/hw_info.h>
@@ -18,8 +19,10 @@
 #include <unit_tests/mocks/mock_program.h>
 
 #include <array>
+#include <cstdio>
 #include <list>
 #include <memory>
+#include <vector>
 
 using namespace NEO;
 using namespace std;
@@ -301,6 +304,131 @@ TEST_F(BinaryCacheTests, cacheThenLoad) {
     EXPECT_TRUE(ret);
 }
 
+TEST_F(BinaryCacheTests, givenLoadedBinaryWhenEntryIsCachedAgainThenPreviouslyLoadedBinaryIsNotModified) {
+    ExecutionEnvironment executionEnvironment;
+    MockProgram program(executionEnvironment);
+    static const char *hash = "SOME_REWRITTEN_HASH";
+    const char firstBinary[] = "FIRST_BINARY";
+    const char secondBinary[] = "SECOND_LONGER_BINARY";
+
+    EXPECT_TRUE(cache->cacheBinary(hash, firstBinary, sizeof(firstBinary)));
+    EXPECT_TRUE(cache->loadCachedBinary(hash, program));
+    EXPECT_TRUE(cache->cacheBinary(hash, secondBinary, sizeof(secondBinary)));
+
+    size_t binarySize = 0u;
+    auto loadedBinary = program.getGenBinary(binarySize);
+    ASSERT_EQ(sizeof(firstBinary), binarySize);
+    EXPECT_EQ(0, memcmp(firstBinary, loadedBinary, binarySize));
+
+    MockProgram program2(executionEnvironment);
+    EXPECT_TRUE(cache->loadCachedBinary(hash, program2));
+    loadedBinary = program2.getGenBinary(binarySize);
+    ASSERT_EQ(sizeof(secondBinary), binarySize);
+    EXPECT_EQ(0, memcmp(secondBinary, loadedBinary, binarySize));
+}
+
+TEST_F(BinaryCacheTests, givenSmallBinaryWhenLoadedThenBinaryIsCopiedAndLargeBinaryIsMappedOnlyWhenEntryCanBeReplacedWhileMapped) {
+    ExecutionEnvironment executionEnvironment;
+    static const char *smallHash = "SOME_SMALL_HASH";
+    static const char *largeHash = "SOME_LARGE_HASH";
+    std::vector<char> smallBinary(BinaryCache::maxCopiedBinarySize, 1);
+    std::vector<char> largeBinary(BinaryCache::maxCopiedBinarySize + 1, 2);
+
+    MockProgram smallProgram(executionEnvironment);
+    EXPECT_TRUE(cache->cacheBinary(smallHash, smallBinary.data(), static_cast<uint32_t>(smallBinary.size())));
+    EXPECT_TRUE(cache->loadCachedBinary(smallHash, smallProgram));
+    EXPECT_EQ(nullptr, smallProgram.genBinaryStorage);
+    ASSERT_EQ(smallBinary.size(), smallProgram.genBinarySize);
+    EXPECT_EQ(0, memcmp(smallBinary.data(), smallProgram.genBinary, smallBinary.size()));
+
+    MockProgram largeProgram(executionEnvironment);
+    EXPECT_TRUE(cache->cacheBinary(largeHash, largeBinary.data(), static_cast<uint32_t>(largeBinary.size())));
+    EXPECT_TRUE(cache->loadCachedBinary(largeHash, largeProgram));
+    EXPECT_EQ(MappedFile::isReplaceableWhileMapped(), largeProgram.genBinaryStorage != nullptr);
+    ASSERT_EQ(largeBinary.size(), largeProgram.genBinarySize);
+    EXPECT_EQ(0, memcmp(largeBinary.data(), largeProgram.genBinary, largeBinary.size()));
+}
+
+TEST(MappedFileTest, givenFileNameWhenGettingTemporaryFileNameThenNameIsUniquePerProcess) {
+    auto temporaryFileName = MappedFile::getTemporaryFileName("cache_entry");
+    EXPECT_EQ(0u, temporaryFileName.find("cache_entry."));
+    EXPECT_NE(std::string::npos, temporaryFileName.find(".tmp"));
+    EXPECT_NE(std::string("cache_entry.tmp"), temporaryFileName);
+}
+
+struct LegacyBinaryCacheTests : public ::testing::Test {
+    class MockBinaryCache : public BinaryCache {
+      public:
+        using BinaryCache::getCachedFilePath;
+
+        bool cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize) override {
+            return cacheResult && BinaryCache::cacheBinary(kernelFileHash, pBinary, binarySize);
+        }
+
+        bool cacheResult = true;
+    };
+
+    void SetUp() override {
+        legacyHash = BinaryCache::getLegacyCachedFileName(hwInfo, input, optionsRef, internalOptions);
+        currentHash = BinaryCache::getCachedFileName(hwInfo, input, optionsRef, internalOptions);
+        std::remove(cache.getCachedFilePath(currentHash).c_str());
+        EXPECT_TRUE(cache.cacheBinary(legacyHash, binary, sizeof(binary)));
+    }
+
+    void TearDown() override {
+        std::remove(cache.getCachedFilePath(currentHash).c_str());
+        std::remove(cache.getCachedFilePath(legacyHash).c_str());
+    }
+
+    ExecutionEnvironment executionEnvironment;
+    MockBinaryCache cache;
+    HardwareInfo hwInfo = *platformDevices[0];
+    const char source[21] = "__kernel void k() {}";
+    const char options[16] = "-cl-opt-disable";
+    const char binary[7] = "BINARY";
+    ArrayRef<const char> input{source, sizeof(source)};
+    ArrayRef<const char> optionsRef{options, sizeof(options)};
+    ArrayRef<const char> internalOptions;
+    std::string legacyHash;
+    std::string currentHash;
+};
+
+TEST_F(LegacyBinaryCacheTests, givenBinaryCachedUnderLegacyKeyWhenLoadingForInputsThenBinaryIsMovedToCurrentKey) {
+    MockProgram program(executionEnvironment);
+    EXPECT_NE(legacyHash, currentHash);
+    EXPECT_EQ(32u, currentHash.size());
+
+    std::string kernelFileHash;
+    EXPECT_TRUE(cache.loadCachedBinaryForInputs(hwInfo, input, optionsRef, internalOptions, kernelFileHash, program));
+    EXPECT_EQ(currentHash, kernelFileHash);
+    size_t binarySize = 0u;
+    auto loadedBinary = program.getGenBinary(binarySize);
+    ASSERT_EQ(sizeof(binary), binarySize);
+    EXPECT_EQ(0, memcmp(binary, loadedBinary, binarySize));
+
+    MockProgram program2(executionEnvironment);
+    EXPECT_TRUE(cache.loadCachedBinary(currentHash, program2));
+    loadedBinary = program2.getGenBinary(binarySize);
+    ASSERT_EQ(sizeof(binary), binarySize);
+    EXPECT_EQ(0, memcmp(binary, loadedBinary, binarySize));
+
+    MockProgram program3(executionEnvironment);
+    EXPECT_FALSE(cache.loadCachedBinary(legacyHash, program3));
+}
+
+TEST_F(LegacyBinaryCacheTests, givenBinaryCachedUnderLegacyKeyWhenCachingUnderCurrentKeyFailsThenLegacyEntryIsKept) {
+    MockProgram program(executionEnvironment);
+    cache.cacheResult = false;
+
+    std::string kernelFileHash;
+    EXPECT_TRUE(cache.loadCachedBinaryForInputs(hwInfo, input, optionsRef, internalOptions, kernelFileHash, program));
+    EXPECT_EQ(currentHash, kernelFileHash);
+
+    MockProgram program2(executionEnvironment);
+    EXPECT_FALSE(cache.loadCachedBinary(currentHash, program2));
+    EXPECT_TRUE(cache.loadCachedBinary(legacyHash, program2));
+}
+
 TEST_F(CompilerInterfaceCachedTests, canInjectCache) {
     std::unique_ptr<BinaryCache> cache(new BinaryCache());
     auto res1 = pCompilerInterface->replaceBinaryCache(cache.get());
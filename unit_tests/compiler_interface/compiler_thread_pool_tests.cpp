@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/compiler_interface/compiler_thread_pool.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace NEO;
+
+TEST(CompilerThreadPoolTest, givenNonPositiveRequestedThreadsCountWhenMaxThreadsCountIsQueriedThenZeroIsReturned) {
+    EXPECT_EQ(0u, CompilerThreadPool::getMaxThreadsCount(0));
+    EXPECT_EQ(0u, CompilerThreadPool::getMaxThreadsCount(-1));
+}
+
+TEST(CompilerThreadPoolTest, givenRequestedThreadsCountWhenMaxThreadsCountIsQueriedThenItIsBoundedByHardwareThreads) {
+    EXPECT_EQ(1u, CompilerThreadPool::getMaxThreadsCount(1));
+
+    auto hardwareThreads = std::thread::hardware_concurrency();
+    if (hardwareThreads != 0u) {
+        EXPECT_EQ(hardwareThreads, CompilerThreadPool::getMaxThreadsCount(static_cast<int32_t>(hardwareThreads) + 1));
+    }
+}
+
+TEST(CompilerThreadPoolTest, givenThreadPoolWhenTasksAreSubmittedThenAllAreExecuted) {
+    CompilerThreadPool threadPool(2u);
+    EXPECT_EQ(2u, threadPool.getNumThreads());
+
+    std::atomic<uint32_t> executedTasks{0u};
+    for (uint32_t i = 0; i < 16u; i++) {
+        threadPool.submit([&executedTasks] { executedTasks++; });
+    }
+    threadPool.waitForIdle();
+
+    EXPECT_EQ(16u, executedTasks);
+}
+
+TEST(CompilerThreadPoolTest, givenPendingTasksWhenThreadPoolIsDestroyedThenPendingTasksAreExecutedFirst) {
+    std::atomic<uint32_t> executedTasks{0u};
+    {
+        CompilerThreadPool threadPool(1u);
+        for (uint32_t i = 0; i < 8u; i++) {
+            threadPool.submit([&executedTasks] { executedTasks++; });
+        }
+    }
+    EXPECT_EQ(8u, executedTasks);
+}
+
+TEST(CompilerThreadPoolTest, givenThreadPoolWhenParallelForIsCalledThenEveryIndexIsProcessedExactlyOnce) {
+    CompilerThreadPool threadPool(3u);
+
+    std::atomic<uint32_t> hits[64];
+    for (auto &hit : hits) {
+        hit = 0u;
+    }
+    threadPool.parallelFor(64u, [&hits](uint32_t index) { hits[index]++; });
+
+    for (auto &hit : hits) {
+        EXPECT_EQ(1u, hit);
+    }
+}
+
+TEST(CompilerThreadPoolTest, givenZeroCountWhenParallelForIsCalledThenFunctionIsNotCalled) {
+    CompilerThreadPool threadPool(1u);
+
+    bool called = false;
+    threadPool.parallelFor(0u, [&called](uint32_t index) { called = true; });
+
+    EXPECT_FALSE(called);
+}
+
+TEST(CompilerThreadPoolTest, givenSingleThreadPoolWhenParallelForIsCalledFromTaskThenItCompletesOnCallingWorker) {
+    CompilerThreadPool threadPool(1u);
+
+    std::atomic<uint32_t> processedIndices{0u};
+    threadPool.submit([&threadPool, &processedIndices] {
+        threadPool.parallelFor(8u, [&processedIndices](uint32_t index) { processedIndices++; });
+    });
+    threadPool.waitForIdle();
+
+    EXPECT_EQ(8u, processedIndices);
+}
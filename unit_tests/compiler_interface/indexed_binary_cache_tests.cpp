@@ -0,0 +1,252 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "core/os_interface/os_file_lock.h"
+#include "runtime/compiler_interface/indexed_binary_cache.h"
+#include "runtime/execution_environment/execution_environment.h"
+#include "test.h"
+#include "unit_tests/mocks/mock_program.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+class MockIndexedBinaryCache : public IndexedBinaryCache {
+  public:
+    using IndexedBinaryCache::currentView;
+    using IndexedBinaryCache::getDataFileName;
+    using IndexedBinaryCache::getIndexFileName;
+    using IndexedBinaryCache::getLockFileName;
+    using IndexedBinaryCache::getTemporaryFileName;
+    using IndexedBinaryCache::IndexedBinaryCache;
+
+    std::shared_ptr<CacheView> openView(const CacheView *previousView) override {
+        openViewCalled++;
+        return IndexedBinaryCache::openView(previousView);
+    }
+
+    std::string getCurrentDataFileName() {
+        auto view = std::atomic_load(&currentView);
+        return view ? getDataFileName(view->header.dataFileId) : std::string();
+    }
+
+    uint32_t getEntriesCount() {
+        auto view = std::atomic_load(&currentView);
+        return view ? view->header.entriesCount : 0u;
+    }
+
+    uint32_t openViewCalled = 0u;
+};
+
+struct IndexedBinaryCacheTest : public ::testing::Test {
+    void SetUp() override {
+        cacheName = std::string("indexed_") + ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        cache = std::make_unique<MockIndexedBinaryCache>(cacheName, 1024u);
+    }
+
+    void TearDown() override {
+        std::remove(cache->getCurrentDataFileName().c_str());
+        std::remove(cache->getIndexFileName().c_str());
+        std::remove(cache->getLockFileName().c_str());
+    }
+
+    static bool fileExists(const std::string &fileName) {
+        return std::ifstream(fileName).good();
+    }
+
+    static size_t getFileSize(const std::string &fileName) {
+        std::ifstream file(fileName, std::ios::binary | std::ios::ate);
+        return file.good() ? static_cast<size_t>(file.tellg()) : 0u;
+    }
+
+    bool loadAndCompare(MockIndexedBinaryCache &cache, const std::string &key, const std::vector<char> &expected) {
+        MockProgram program(executionEnvironment);
+        if (!cache.loadCachedBinary(key, program)) {
+            return false;
+        }
+        size_t binarySize = 0u;
+        auto binary = program.getGenBinary(binarySize);
+        return binarySize == expected.size() && memcmp(binary, expected.data(), binarySize) == 0;
+    }
+
+    ExecutionEnvironment executionEnvironment;
+    std::string cacheName;
+    std::unique_ptr<MockIndexedBinaryCache> cache;
+};
+
+TEST_F(IndexedBinaryCacheTest, givenEmptyBinaryWhenCachingThenFalseIsReturned) {
+    EXPECT_FALSE(cache->cacheBinary("some_hash", nullptr, 12u));
+    EXPECT_FALSE(cache->cacheBinary("some_hash", "Data", 0u));
+}
+
+TEST_F(IndexedBinaryCacheTest, givenEmptyCacheWhenLoadingThenFalseIsReturned) {
+    MockProgram program(executionEnvironment);
+    EXPECT_FALSE(cache->loadCachedBinary("----do-not-exists----", program));
+}
+
+TEST_F(IndexedBinaryCacheTest, givenCachedBinariesWhenLoadingThenSameDataIsReturned) {
+    std::vector<char> binary1(64, 1);
+    std::vector<char> binary2(128, 2);
+
+    EXPECT_TRUE(cache->cacheBinary("hash1", binary1.data(), static_cast<uint32_t>(binary1.size())));
+    EXPECT_TRUE(cache->cacheBinary("hash2", binary2.data(), static_cast<uint32_t>(binary2.size())));
+    EXPECT_EQ(2u, cache->getEntriesCount());
+
+    EXPECT_TRUE(loadAndCompare(*cache, "hash1", binary1));
+    EXPECT_TRUE(loadAndCompare(*cache, "hash2", binary2));
+}
+
+TEST_F(IndexedBinaryCacheTest, givenBinaryCachedWithSameKeyWhenLoadingThenNewestBinaryIsReturned) {
+    std::vector<char> binary1(64, 1);
+    std::vector<char> binary2(32, 2);
+
+    EXPECT_TRUE(cache->cacheBinary("hash", binary1.data(), static_cast<uint32_t>(binary1.size())));
+    EXPECT_TRUE(cache->cacheBinary("hash", binary2.data(), static_cast<uint32_t>(binary2.size())));
+    EXPECT_EQ(1u, cache->getEntriesCount());
+
+    EXPECT_TRUE(loadAndCompare(*cache, "hash", binary2));
+}
+
+TEST_F(IndexedBinaryCacheTest, givenBinaryCachedByOtherCacheInstanceWhenLoadingThenPublishedBinaryIsFound) {
+    MockIndexedBinaryCache otherCache(cacheName, 1024u);
+    std::vector<char> binary(64, 3);
+
+    EXPECT_TRUE(otherCache.cacheBinary("hash", binary.data(), static_cast<uint32_t>(binary.size())));
+    EXPECT_TRUE(loadAndCompare(*cache, "hash", binary));
+}
+
+TEST_F(IndexedBinaryCacheTest, givenBinaryExceedingSizeLimitWhenCachingThenFalseIsReturned) {
+    std::vector<char> binary(1024, 4);
+    EXPECT_FALSE(cache->cacheBinary("hash", binary.data(), static_cast<uint32_t>(binary.size())));
+    EXPECT_EQ(0u, cache->getEntriesCount());
+}
+
+TEST_F(IndexedBinaryCacheTest, givenSizeLimitReachedWhenCachingThenLeastRecentlyUsedBinaryIsEvicted) {
+    std::vector<char> binary(300, 5);
+
+    EXPECT_TRUE(cache->cacheBinary("hash1", binary.data(), static_cast<uint32_t>(binary.size())));
+    EXPECT_TRUE(cache->cacheBinary("hash2", binary.data(), static_cast<uint32_t>(binary.size())));
+    EXPECT_TRUE(cache->cacheBinary("hash3", binary.data(), static_cast<uint32_t>(binary.size())));
+    EXPECT_TRUE(loadAndCompare(*cache, "hash1", binary));
+
+    EXPECT_TRUE(cache->cacheBinary("hash4", binary.data(), static_cast<uint32_t>(binary.size())));
+    EXPECT_EQ(3u, cache->getEntriesCount());
+
+    EXPECT_TRUE(loadAndCompare(*cache, "hash1", binary));
+    EXPECT_FALSE(loadAndCompare(*cache, "hash2", binary));
+    EXPECT_TRUE(loadAndCompare(*cache, "hash3", binary));
+    EXPECT_TRUE(loadAndCompare(*cache, "hash4", binary));
+}
+
+TEST_F(IndexedBinaryCacheTest, givenCorruptedDataFileWhenLoadingThenChecksumMismatchIsReportedAsMiss) {
+    std::vector<char> binary(64, 6);
+    EXPECT_TRUE(cache->cacheBinary("hash", binary.data(), static_cast<uint32_t>(binary.size())));
+
+    {
+        std::fstream dataFile(cache->getCurrentDataFileName(), std::ios::in | std::ios::out | std::ios::binary);
+        ASSERT_TRUE(dataFile.good());
+        dataFile.seekp(16);
+        dataFile.put(7);
+    }
+
+    MockIndexedBinaryCache otherCache(cacheName, 1024u);
+    EXPECT_FALSE(loadAndCompare(otherCache, "hash", binary));
+}
+
+TEST_F(IndexedBinaryCacheTest, givenCachedBinaryWhenCachingAnotherBinaryThenItIsAppendedToSameDataFile) {
+    std::vector<char> binary1(64, 1);
+    std::vector<char> binary2(128, 2);
+
+    EXPECT_TRUE(cache->cacheBinary("hash1", binary1.data(), static_cast<uint32_t>(binary1.size())));
+    auto dataFileName = cache->getCurrentDataFileName();
+    auto dataFileSize = getFileSize(dataFileName);
+
+    EXPECT_TRUE(cache->cacheBinary("hash2", binary2.data(), static_cast<uint32_t>(binary2.size())));
+    EXPECT_EQ(dataFileName, cache->getCurrentDataFileName());
+    EXPECT_EQ(dataFileSize + strlen("hash2") + binary2.size(), getFileSize(dataFileName));
+    EXPECT_TRUE(loadAndCompare(*cache, "hash1", binary1));
+    EXPECT_TRUE(loadAndCompare(*cache, "hash2", binary2));
+}
+
+TEST_F(IndexedBinaryCacheTest, givenCacheInstancesOpenedBeforeEachOtherPublishedWhenCachingThenEntriesOfBothAreKept) {
+    MockIndexedBinaryCache otherCache(cacheName, 1024u);
+    std::vector<char> binary1(64, 1);
+    std::vector<char> binary2(128, 2);
+
+    EXPECT_TRUE(cache->cacheBinary("hash1", binary1.data(), static_cast<uint32_t>(binary1.size())));
+    EXPECT_TRUE(otherCache.cacheBinary("hash2", binary2.data(), static_cast<uint32_t>(binary2.size())));
+    EXPECT_EQ(2u, otherCache.getEntriesCount());
+
+    MockIndexedBinaryCache newCache(cacheName, 1024u);
+    EXPECT_TRUE(loadAndCompare(newCache, "hash1", binary1));
+    EXPECT_TRUE(loadAndCompare(newCache, "hash2", binary2));
+}
+
+TEST_F(IndexedBinaryCacheTest, givenUnchangedIndexWhenLoadingMissingBinaryThenViewIsNotReopened) {
+    std::vector<char> binary(64, 1);
+    EXPECT_TRUE(cache->cacheBinary("hash1", binary.data(), static_cast<uint32_t>(binary.size())));
+    cache->openViewCalled = 0u;
+
+    MockProgram program(executionEnvironment);
+    for (int i = 0; i < 3; i++) {
+        EXPECT_FALSE(cache->loadCachedBinary("missing", program));
+    }
+    EXPECT_EQ(0u, cache->openViewCalled);
+
+    MockIndexedBinaryCache otherCache(cacheName, 1024u);
+    EXPECT_TRUE(otherCache.cacheBinary("hash2", binary.data(), static_cast<uint32_t>(binary.size())));
+    EXPECT_TRUE(loadAndCompare(*cache, "hash2", binary));
+    EXPECT_EQ(1u, cache->openViewCalled);
+}
+
+TEST_F(IndexedBinaryCacheTest, givenCompactionWhenPublishingThenUnreferencedDataAndTemporaryFilesAreRemoved) {
+    std::vector<char> binary(300, 5);
+    EXPECT_TRUE(cache->cacheBinary("hash1", binary.data(), static_cast<uint32_t>(binary.size())));
+    auto previousDataFileName = cache->getCurrentDataFileName();
+
+    auto orphanedDataFileName = cache->getDataFileName(0xabcu);
+    auto orphanedFileNames = {orphanedDataFileName,
+                              cache->getTemporaryFileName(orphanedDataFileName),
+                              cache->getTemporaryFileName(cache->getIndexFileName())};
+    for (auto &fileName : orphanedFileNames) {
+        std::ofstream(fileName) << "data";
+        EXPECT_TRUE(fileExists(fileName));
+    }
+
+    EXPECT_TRUE(cache->cacheBinary("hash2", binary.data(), static_cast<uint32_t>(binary.size())));
+    EXPECT_TRUE(cache->cacheBinary("hash3", binary.data(), static_cast<uint32_t>(binary.size())));
+    EXPECT_EQ(previousDataFileName, cache->getCurrentDataFileName());
+
+    EXPECT_TRUE(cache->cacheBinary("hash4", binary.data(), static_cast<uint32_t>(binary.size())));
+    EXPECT_NE(previousDataFileName, cache->getCurrentDataFileName());
+    EXPECT_TRUE(fileExists(cache->getCurrentDataFileName()));
+    EXPECT_FALSE(fileExists(previousDataFileName));
+    for (auto &fileName : orphanedFileNames) {
+        EXPECT_FALSE(fileExists(fileName));
+    }
+}
+
+TEST_F(IndexedBinaryCacheTest, givenLockFileHeldWhenCachingThenBinaryIsPublishedAfterLockIsReleased) {
+    std::vector<char> binary(64, 1);
+    auto fileLock = FileLock::acquire(cache->getLockFileName());
+    ASSERT_NE(nullptr, fileLock);
+
+    bool cached = false;
+    std::thread writer([&] { cached = cache->cacheBinary("hash", binary.data(), static_cast<uint32_t>(binary.size())); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(fileExists(cache->getIndexFileName()));
+
+    fileLock.reset();
+    writer.join();
+    EXPECT_TRUE(cached);
+    EXPECT_TRUE(loadAndCompare(*cache, "hash", binary));
+}
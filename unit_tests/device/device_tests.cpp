@@ -6,6 +6,7 @@
  */
 
 #include "core/unit_tests/helpers/debug_manager_state_restore.h"
+#include "runtime/command_queue/local_ids_cache.h"
 #include "runtime/device/device.h"
 #include "runtime/helpers/device_helpers.h"
 #include "runtime/helpers/hw_helper.h"
@@ -253,3 +254,22 @@ TEST(DeviceCreation, givenDeviceWhenCheckingEnginesCountThenNumberGreaterThanZer
     auto device = std::unique_ptr<Device>(MockDevice::createWithNewExecutionEnvironment<Device>(nullptr));
     EXPECT_GT(DeviceHelper::getEnginesCount(device->getHardwareInfo()), 0u);
 }
+
+TEST(DeviceCreation, givenLocalIdsCacheDisabledWhenDeviceIsCreatedThenLocalIdsCacheIsNotCreated) {
+    auto device = std::unique_ptr<Device>(MockDevice::createWithNewExecutionEnvironment<Device>(nullptr));
+    EXPECT_EQ(nullptr, device->getLocalIdsCache());
+}
+
+TEST(DeviceCreation, givenLocalIdsCacheEnabledWhenDeviceIsCreatedThenLocalIdsCacheWithRequestedSizeIsCreated) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableLocalIdsCache.set(true);
+
+    auto device = std::unique_ptr<Device>(MockDevice::createWithNewExecutionEnvironment<Device>(nullptr));
+    ASSERT_NE(nullptr, device->getLocalIdsCache());
+    EXPECT_EQ(LocalIdsCache::defaultMaxEntries, device->getLocalIdsCache()->getMaxEntries());
+
+    DebugManager.flags.LocalIdsCacheSize.set(5);
+    device.reset(MockDevice::createWithNewExecutionEnvironment<Device>(nullptr));
+    ASSERT_NE(nullptr, device->getLocalIdsCache());
+    EXPECT_EQ(5u, device->getLocalIdsCache()->getMaxEntries());
+}
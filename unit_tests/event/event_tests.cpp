@@ -32,6 +32,7 @@
 
 #include <memory>
 #include <type_traits>
+#include <vector>
 
 TEST(Event, NonCopyable) {
     EXPECT_FALSE(std::is_move_constructible<Event>::value);
@@ -189,6 +190,92 @@ TEST(Event, waitForEventsFlushesAllQueues) {
     EXPECT_EQ(1u, cmdQ2->flushCounter);
 }
 
+TEST(Event, givenCoalescedEventWaitsWhenWaitingForEventsFromQueuesSharingCsrThenWaitOnceForHighestTaskCount) {
+    class MockCommandQueueWithWaitCheck : public MockCommandQueue {
+      public:
+        MockCommandQueueWithWaitCheck(Context &context, Device *device) : MockCommandQueue(&context, device, nullptr) {
+        }
+        void waitUntilComplete(uint32_t taskCountToWait, FlushStamp flushStampToWait, bool useQuickKmdSleep) override {
+            waitCounter++;
+            taskCountWaited = taskCountToWait;
+        }
+        uint32_t waitCounter = 0;
+        uint32_t taskCountWaited = 0;
+    };
+
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableCoalescedEventWaits.set(true);
+
+    std::unique_ptr<Device> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    MockContext context;
+
+    std::unique_ptr<MockCommandQueueWithWaitCheck> cmdQ1(new MockCommandQueueWithWaitCheck(context, device.get()));
+    std::unique_ptr<MockCommandQueueWithWaitCheck> cmdQ2(new MockCommandQueueWithWaitCheck(context, device.get()));
+    ASSERT_EQ(&cmdQ1->getGpgpuCommandStreamReceiver(), &cmdQ2->getGpgpuCommandStreamReceiver());
+
+    std::unique_ptr<Event> event1(new Event(cmdQ1.get(), CL_COMMAND_NDRANGE_KERNEL, 4, 10));
+    std::unique_ptr<Event> event2(new Event(cmdQ2.get(), CL_COMMAND_NDRANGE_KERNEL, 5, 20));
+    std::unique_ptr<Event> event3(new Event(cmdQ1.get(), CL_COMMAND_NDRANGE_KERNEL, 6, 15));
+    std::unique_ptr<UserEvent> userEvent(new UserEvent(&context));
+    userEvent->setStatus(CL_COMPLETE);
+
+    cl_event eventWaitlist[] = {event1.get(), event2.get(), userEvent.get(), event3.get()};
+
+    EXPECT_EQ(CL_SUCCESS, Event::waitForEvents(4, eventWaitlist));
+
+    EXPECT_EQ(0u, cmdQ1->waitCounter);
+    EXPECT_EQ(1u, cmdQ2->waitCounter);
+    EXPECT_EQ(20u, cmdQ2->taskCountWaited);
+}
+
+TEST(Event, givenCoalescedEventWaitsWhenWaitingForLargeEventListAcrossQueuesSharingCsrThenSingleWaitIsDone) {
+    class MockCommandQueueWithWaitCheck : public MockCommandQueue {
+      public:
+        MockCommandQueueWithWaitCheck(Context &context, Device *device) : MockCommandQueue(&context, device, nullptr) {
+        }
+        void waitUntilComplete(uint32_t taskCountToWait, FlushStamp flushStampToWait, bool useQuickKmdSleep) override {
+            waitCounter++;
+            taskCountWaited = taskCountToWait;
+        }
+        uint32_t waitCounter = 0;
+        uint32_t taskCountWaited = 0;
+    };
+
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableCoalescedEventWaits.set(true);
+
+    std::unique_ptr<Device> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    MockContext context;
+
+    const uint32_t queueCount = 4;
+    const uint32_t eventsPerQueue = 128;
+    std::vector<std::unique_ptr<MockCommandQueueWithWaitCheck>> queues;
+    for (uint32_t queueId = 0; queueId < queueCount; queueId++) {
+        queues.emplace_back(new MockCommandQueueWithWaitCheck(context, device.get()));
+    }
+
+    std::vector<std::unique_ptr<Event>> events;
+    std::vector<cl_event> eventWaitlist;
+    uint32_t taskCount = 0;
+    for (uint32_t eventId = 0; eventId < eventsPerQueue; eventId++) {
+        for (auto &queue : queues) {
+            taskCount++;
+            events.emplace_back(new Event(queue.get(), CL_COMMAND_MARKER, taskCount, taskCount));
+            eventWaitlist.push_back(events.back().get());
+        }
+    }
+
+    EXPECT_EQ(CL_SUCCESS, Event::waitForEvents(static_cast<cl_uint>(eventWaitlist.size()), eventWaitlist.data()));
+
+    uint32_t waitCounter = 0;
+    for (auto &queue : queues) {
+        waitCounter += queue->waitCounter;
+    }
+    EXPECT_EQ(1u, waitCounter);
+    EXPECT_EQ(1u, queues.back()->waitCounter);
+    EXPECT_EQ(taskCount, queues.back()->taskCountWaited);
+}
+
 TEST(Event, waitForEventsWithNotReadyEventDoesNotFlushQueue) {
     class MockCommandQueueWithFlushCheck : public MockCommandQueue {
       public:
@@ -1380,6 +1467,114 @@ HWTEST_F(EventTest, givenEventWithNotReadyTaskLevelWhenUnblockedThenGetTaskLevel
     EXPECT_EQ(csr.taskLevel, childEvent1.getTaskLevel());
 }
 
+TEST_F(EventTest, givenIterativeEventUnblockingWhenDeepEventChainIsUnblockedThenTaskLevelsArePropagatedAlongChain) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableIterativeEventUnblocking.set(true);
+
+    const size_t chainLength = 1000;
+    UserEvent userEvent;
+    std::vector<std::unique_ptr<Event>> chain;
+    Event *parentEvent = &userEvent;
+    for (size_t eventId = 0; eventId < chainLength; eventId++) {
+        chain.emplace_back(new Event(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, Event::eventNotReady, Event::eventNotReady));
+        parentEvent->addChild(*chain.back());
+        parentEvent = chain.back().get();
+    }
+    EXPECT_TRUE(chain.back()->peekIsBlocked());
+
+    userEvent.setStatus(CL_COMPLETE);
+
+    EXPECT_FALSE(chain[0]->peekIsBlocked());
+    for (size_t eventId = 1; eventId < chainLength; eventId++) {
+        EXPECT_FALSE(chain[eventId]->peekIsBlocked());
+        EXPECT_EQ(chain[eventId - 1]->getTaskLevel() + 1, chain[eventId]->getTaskLevel());
+    }
+}
+
+struct EventCallbackOrderRecord {
+    static void CL_CALLBACK record(cl_event, cl_int, void *data) {
+        auto callbackRecord = static_cast<EventCallbackOrderRecord *>(data);
+        callbackRecord->order->push_back(callbackRecord->eventId);
+    }
+
+    std::vector<size_t> *order;
+    size_t eventId;
+};
+
+TEST_F(EventTest, givenIterativeEventUnblockingWhenEventTreeIsUnblockedThenCallbacksAreExecutedInRecursiveUnblockingOrder) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableAsyncEventsHandler.set(false);
+
+    auto unblockEventTree = [&](bool iterativeUnblocking) {
+        DebugManager.flags.EnableIterativeEventUnblocking.set(iterativeUnblocking);
+        std::vector<size_t> order;
+        UserEvent userEvent;
+        std::vector<std::unique_ptr<Event>> events;
+        std::vector<EventCallbackOrderRecord> records(4);
+        for (size_t eventId = 0; eventId < records.size(); eventId++) {
+            events.emplace_back(new Event(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, Event::eventNotReady, Event::eventNotReady));
+            records[eventId] = {&order, eventId};
+            events.back()->addCallback(EventCallbackOrderRecord::record, CL_SUBMITTED, &records[eventId]);
+        }
+        userEvent.addChild(*events[0]);
+        events[0]->addChild(*events[1]);
+        events[0]->addChild(*events[2]);
+        events[2]->addChild(*events[3]);
+
+        userEvent.setStatus(CL_COMPLETE);
+        return order;
+    };
+
+    auto recursiveOrder = unblockEventTree(false);
+    auto iterativeOrder = unblockEventTree(true);
+
+    ASSERT_EQ(4u, recursiveOrder.size());
+    EXPECT_EQ(0u, recursiveOrder.back());
+    EXPECT_EQ(recursiveOrder, iterativeOrder);
+}
+
+TEST_F(EventTest, givenIterativeEventUnblockingWhenCallbackSignalsEventsThenTheirChildrenAreUnblockedBeforeCallbackReturns) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableAsyncEventsHandler.set(false);
+    DebugManager.flags.EnableIterativeEventUnblocking.set(true);
+
+    struct CallbackData {
+        static void CL_CALLBACK signalEvents(cl_event, cl_int, void *data) {
+            auto callbackData = static_cast<CallbackData *>(data);
+            callbackData->completedEvent->addChild(*callbackData->lateChildEvent);
+            callbackData->lateChildUnblocked = !callbackData->lateChildEvent->peekIsBlocked();
+            callbackData->signaledEvent->setStatus(CL_COMPLETE);
+            callbackData->signaledChildUnblocked = !callbackData->signaledChildEvent->peekIsBlocked();
+        }
+
+        Event *completedEvent;
+        Event *lateChildEvent;
+        Event *signaledEvent;
+        Event *signaledChildEvent;
+        bool lateChildUnblocked;
+        bool signaledChildUnblocked;
+    };
+
+    UserEvent userEvent;
+    UserEvent completedEvent;
+    UserEvent signaledEvent;
+    completedEvent.setStatus(CL_COMPLETE);
+    std::unique_ptr<Event> childEvent(new Event(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, Event::eventNotReady, Event::eventNotReady));
+    std::unique_ptr<Event> lateChildEvent(new Event(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, Event::eventNotReady, Event::eventNotReady));
+    std::unique_ptr<Event> signaledChildEvent(new Event(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, Event::eventNotReady, Event::eventNotReady));
+    signaledEvent.addChild(*signaledChildEvent);
+    userEvent.addChild(*childEvent);
+
+    CallbackData callbackData = {&completedEvent, lateChildEvent.get(), &signaledEvent, signaledChildEvent.get(), false, false};
+    childEvent->addCallback(CallbackData::signalEvents, CL_SUBMITTED, &callbackData);
+
+    userEvent.setStatus(CL_COMPLETE);
+
+    EXPECT_FALSE(childEvent->peekIsBlocked());
+    EXPECT_TRUE(callbackData.lateChildUnblocked);
+    EXPECT_TRUE(callbackData.signaledChildUnblocked);
+}
+
 TEST_F(EventTest, addChildForEventCompleted) {
     VirtualEvent virtualEvent(pCmdQ, &mockContext);
     {
@@ -50,6 +50,16 @@ TEST(getMinLsbSet, basicValues) {
     // clang-format on
 }
 
+TEST(getLowestSetBit, basicValues) {
+    // clang-format off
+    EXPECT_EQ(0u,  getLowestSetBit(0x1ull));
+    EXPECT_EQ(16u, getLowestSetBit(0x8000000040010000ull));
+    EXPECT_EQ(32u, getLowestSetBit(0x100000000ull));
+    EXPECT_EQ(45u, getLowestSetBit(0x8000200000000000ull));
+    EXPECT_EQ(63u, getLowestSetBit(0x8000000000000000ull));
+    // clang-format on
+}
+
 TEST(getExponentWithLog2, zeroReturns32) {
     // clang-format off
     EXPECT_EQ(32u,  log2((uint32_t)0u));
@@ -5,10 +5,18 @@
  *
  */
 
+#include "core/memory_manager/memory_constants.h"
+#include "core/utilities/cpu_info.h"
 #include "runtime/helpers/hash.h"
+#include "runtime/helpers/hash128.h"
+#include "unit_tests/helpers/variable_backup.h"
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <set>
+#include <vector>
+
 using namespace NEO;
 
 TEST(HashTests, givenSamePointersWhenHashIsCalculatedThenSame32BitValuesAreGenerated) {
@@ -34,3 +42,110 @@ TEST(HashTests, givenDifferentPointersWhenHashIsCalculatedThenUnique32BitValuesA
 
     EXPECT_NE(hash1, hash2);
 }
+
+TEST(Hash128Tests, givenKnownInputWhenHashIsCalculatedThenValueIsStableAcrossReleases) {
+    auto value = Hash128::hash("abc", 3);
+    EXPECT_EQ(0x72f702b12558537eu, value[0]);
+    EXPECT_EQ(0xf5d9dac76fdcf770u, value[1]);
+}
+
+TEST(Hash128Tests, givenInputSplitIntoChunksWhenHashIsCalculatedThenValueIsSameAsForWholeInput) {
+    std::vector<char> data(1000);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<char>(i * 7);
+    }
+    auto expected = Hash128::hash(data.data(), data.size());
+
+    for (size_t chunkSize : {1u, 3u, 63u, 64u, 65u, 200u}) {
+        Hash128 hash;
+        for (size_t offset = 0; offset < data.size(); offset += chunkSize) {
+            hash.update(data.data() + offset, std::min(chunkSize, data.size() - offset));
+        }
+        EXPECT_EQ(expected, hash.finish()) << "chunk size: " << chunkSize;
+    }
+}
+
+TEST(Hash128Tests, givenMultiMegabyteModuleWhenSingleByteChangesThenHashChangesAndStreamedHashIsSameAsWhole) {
+    std::vector<char> module(4 * MemoryConstants::megaByte + 17);
+    for (size_t i = 0; i < module.size(); i++) {
+        module[i] = static_cast<char>(i * 31 + (i >> 8));
+    }
+    auto expected = Hash128::hash(module.data(), module.size());
+
+    Hash128 hash;
+    const size_t chunkSize = 64 * MemoryConstants::kiloByte + 1;
+    for (size_t offset = 0; offset < module.size(); offset += chunkSize) {
+        hash.update(module.data() + offset, std::min(chunkSize, module.size() - offset));
+    }
+    EXPECT_EQ(expected, hash.finish());
+
+    for (size_t offset : {static_cast<size_t>(0u), module.size() / 2, module.size() - 1}) {
+        module[offset]++;
+        EXPECT_NE(expected, Hash128::hash(module.data(), module.size())) << "offset: " << offset;
+        module[offset]--;
+    }
+}
+
+TEST(Hash128Tests, givenInputsDifferingOnlyInTrailingZerosWhenHashIsCalculatedThenValuesAreUnique) {
+    char data[Hash128::stripeSize + 1] = {};
+    std::set<Hash128::Value> hashes;
+    for (size_t size = 0; size <= Hash128::stripeSize; size++) {
+        EXPECT_TRUE(hashes.insert(Hash128::hash(data, size)).second) << "size: " << size;
+    }
+}
+
+TEST(Hash128Tests, givenScalarSse4AndAvx2StripeProcessingWhenHashIsCalculatedThenValuesAreSame) {
+    std::vector<char> data(1000);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<char>(i * 13);
+    }
+
+    std::vector<Hash128Helper::ProcessStripesFunc> processStripesFuncs;
+    if (CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureSsE41)) {
+        processStripesFuncs.push_back(processHash128Stripes<uint32x4_t>);
+    }
+    if (CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX2)) {
+        processStripesFuncs.push_back(processHash128Stripes<uint32x8_t>);
+    }
+
+    VariableBackup<Hash128Helper::ProcessStripesFunc> processStripesBackup(&Hash128Helper::processStripes);
+    for (size_t size : {0u, 1u, 64u, 100u, 1000u}) {
+        Hash128Helper::processStripes = processHash128Stripes<uint32_t>;
+        auto scalarValue = Hash128::hash(data.data(), size);
+        for (auto processStripesFunc : processStripesFuncs) {
+            Hash128Helper::processStripes = processStripesFunc;
+            EXPECT_EQ(scalarValue, Hash128::hash(data.data(), size)) << "size: " << size;
+        }
+    }
+
+    Hash128Helper::processStripes = processHash128Stripes<uint32_t>;
+    auto value = Hash128::hash("abc", 3);
+    EXPECT_EQ(0x72f702b12558537eu, value[0]);
+    EXPECT_EQ(0xf5d9dac76fdcf770u, value[1]);
+}
+
+namespace {
+uint32_t mockedCpuidFeaturesEcx = 0u;
+uint32_t mockedCpuidExtendedFeaturesEbx = 0u;
+
+void mockCpuid(int cpuInfo[4], int functionId) {
+    cpuInfo[0] = functionId == 0 ? 7 : 0;
+    cpuInfo[1] = functionId == 7 ? static_cast<int>(mockedCpuidExtendedFeaturesEbx) : 0;
+    cpuInfo[2] = functionId == 1 ? static_cast<int>(mockedCpuidFeaturesEcx) : 0;
+    cpuInfo[3] = 0;
+}
+} // namespace
+
+TEST(Hash128Tests, givenCpuFeaturesWhenStripeProcessingIsSelectedThenSimdPathIsUsedOnlyWhenSupported) {
+    VariableBackup<void (*)(int[4], int)> cpuidBackup(&CpuInfo::cpuidFunc, mockCpuid);
+
+    mockedCpuidFeaturesEcx = 0u;
+    mockedCpuidExtendedFeaturesEbx = 0u;
+    EXPECT_EQ(processHash128Stripes<uint32_t>, Hash128Helper::selectProcessStripes(CpuInfo()));
+
+    mockedCpuidFeaturesEcx = BIT(19);
+    EXPECT_EQ(processHash128Stripes<uint32x4_t>, Hash128Helper::selectProcessStripes(CpuInfo()));
+
+    mockedCpuidExtendedFeaturesEbx = BIT(5) | BIT(3) | BIT(8);
+    EXPECT_EQ(processHash128Stripes<uint32x8_t>, Hash128Helper::selectProcessStripes(CpuInfo()));
+}
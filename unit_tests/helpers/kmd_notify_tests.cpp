@@ -47,6 +47,8 @@ struct KmdNotifyTests : public ::testing::Test {
     class MockKmdNotifyHelper : public KmdNotifyHelper {
       public:
         using KmdNotifyHelper::acLineConnected;
+        using KmdNotifyHelper::adaptiveWaitEnabled;
+        using KmdNotifyHelper::expectedCompletionLatencyUs;
         using KmdNotifyHelper::getMicrosecondsSinceEpoch;
         using KmdNotifyHelper::lastWaitForCompletionTimestampUs;
         using KmdNotifyHelper::properties;
@@ -412,6 +414,186 @@ TEST_F(KmdNotifyTests, givenEnabledKmdNotifyMechanismWhenPowerSavingModeIsSetAnd
     EXPECT_EQ(0, timeout);
 }
 
+TEST_F(KmdNotifyTests, givenAdaptiveWaitDisabledByDefaultWhenHelperIsCreatedThenItIsNotEnabled) {
+    MockKmdNotifyHelper helper(&(hwInfo->capabilityTable.kmdNotifyProperties));
+    EXPECT_FALSE(helper.isAdaptiveWaitEnabled());
+}
+
+TEST_F(KmdNotifyTests, givenAdaptiveWaitEnabledAndNoCompletedWaitsWhenParametersAreObtainedThenInitialSpinTimeoutIsReturned) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableAdaptiveWait.set(true);
+    overrideKmdNotifyParams(true, 1000000, false, 0, false, 0);
+    MockKmdNotifyHelper helper(&(hwInfo->capabilityTable.kmdNotifyProperties));
+    EXPECT_TRUE(helper.isAdaptiveWaitEnabled());
+
+    int64_t timeout = 0;
+    bool timeoutEnabled = helper.obtainTimeoutParams(timeout, false, 1, 2, flushStampToWait, false);
+    EXPECT_TRUE(timeoutEnabled);
+    EXPECT_EQ(AdaptiveWaitConstants::initialSpinMicroseconds, timeout);
+}
+
+TEST_F(KmdNotifyTests, givenAdaptiveWaitEnabledWhenBasePolicyTimeoutIsShorterThenBaseTimeoutIsReturned) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableAdaptiveWait.set(true);
+    overrideKmdNotifyParams(true, 2, true, 1, false, 0);
+    MockKmdNotifyHelper helper(&(hwInfo->capabilityTable.kmdNotifyProperties));
+
+    int64_t timeout = 0;
+    EXPECT_TRUE(helper.obtainTimeoutParams(timeout, false, 1, 2, flushStampToWait, false));
+    EXPECT_EQ(2, timeout);
+
+    EXPECT_TRUE(helper.obtainTimeoutParams(timeout, true, 1, 2, flushStampToWait, false));
+    EXPECT_EQ(1, timeout);
+}
+
+TEST_F(KmdNotifyTests, givenAdaptiveWaitEnabledAndKmdNotifyDisabledWhenParametersAreObtainedThenLearnedSpinTimeoutIsEnabled) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableAdaptiveWait.set(true);
+    overrideKmdNotifyParams(false, 0, false, 0, false, 0);
+    MockKmdNotifyHelper helper(&(hwInfo->capabilityTable.kmdNotifyProperties));
+
+    int64_t timeout = 0;
+    helper.acLineConnected = true;
+    EXPECT_TRUE(helper.obtainTimeoutParams(timeout, false, 1, 2, flushStampToWait, false));
+    EXPECT_EQ(AdaptiveWaitConstants::initialSpinMicroseconds, timeout);
+
+    helper.recordWaitCompletion(true, 20, 0);
+    EXPECT_TRUE(helper.obtainTimeoutParams(timeout, false, 1, 2, flushStampToWait, false));
+    EXPECT_EQ(40, timeout);
+
+    helper.acLineConnected = false;
+    EXPECT_TRUE(helper.obtainTimeoutParams(timeout, false, 1, 2, flushStampToWait, false));
+    EXPECT_EQ(40, timeout);
+}
+
+TEST_F(KmdNotifyTests, givenAdaptiveWaitEnabledAndNoFlushStampWhenParametersAreObtainedThenTimeoutIsDisabled) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableAdaptiveWait.set(true);
+    MockKmdNotifyHelper helper(&(hwInfo->capabilityTable.kmdNotifyProperties));
+
+    int64_t timeout = 0;
+    EXPECT_FALSE(helper.obtainTimeoutParams(timeout, false, 1, 2, 0, false));
+}
+
+TEST_F(KmdNotifyTests, givenShortCompletionLatenciesWhenSpinTimeoutIsObtainedThenItIsTwiceTheExpectedLatency) {
+    MockKmdNotifyHelper helper(&(hwInfo->capabilityTable.kmdNotifyProperties));
+
+    helper.recordWaitCompletion(true, 40, 0);
+    EXPECT_EQ(40, helper.expectedCompletionLatencyUs);
+    EXPECT_EQ(80, helper.getAdaptiveSpinTimeout());
+
+    helper.recordWaitCompletion(true, 120, 0);
+    EXPECT_EQ(50, helper.expectedCompletionLatencyUs);
+    EXPECT_EQ(100, helper.getAdaptiveSpinTimeout());
+
+    helper.expectedCompletionLatencyUs = 0;
+    EXPECT_EQ(AdaptiveWaitConstants::minSpinMicroseconds, helper.getAdaptiveSpinTimeout());
+
+    helper.expectedCompletionLatencyUs = AdaptiveWaitConstants::maxSpinMicroseconds - 1;
+    EXPECT_EQ(AdaptiveWaitConstants::maxSpinMicroseconds, helper.getAdaptiveSpinTimeout());
+}
+
+TEST_F(KmdNotifyTests, givenLongCompletionLatenciesWhenSpinTimeoutIsObtainedThenMinimalSpinIsReturnedAndFullSpinIsProbedPeriodically) {
+    MockKmdNotifyHelper helper(&(hwInfo->capabilityTable.kmdNotifyProperties));
+
+    helper.recordWaitCompletion(false, AdaptiveWaitConstants::maxSpinMicroseconds * 10, 50);
+    for (uint32_t i = 1; i < AdaptiveWaitConstants::probeWaitInterval; i++) {
+        EXPECT_EQ(AdaptiveWaitConstants::minSpinMicroseconds, helper.getAdaptiveSpinTimeout());
+    }
+    EXPECT_EQ(AdaptiveWaitConstants::maxSpinMicroseconds, helper.getAdaptiveSpinTimeout());
+    EXPECT_EQ(AdaptiveWaitConstants::minSpinMicroseconds, helper.getAdaptiveSpinTimeout());
+}
+
+TEST_F(KmdNotifyTests, givenParkedWaitsWhenCompletionIsRecordedThenOnlySpinTimeLongerThanExpectedLatencyRaisesEstimate) {
+    MockKmdNotifyHelper helper(&(hwInfo->capabilityTable.kmdNotifyProperties));
+    helper.expectedCompletionLatencyUs = 40;
+
+    helper.recordWaitCompletion(false, 10, 5000);
+    EXPECT_EQ(40, helper.expectedCompletionLatencyUs);
+
+    helper.recordWaitCompletion(false, 80, 5000);
+    EXPECT_EQ(55, helper.expectedCompletionLatencyUs);
+}
+
+TEST_F(KmdNotifyTests, givenCompletedWaitsWhenStatisticsAreObtainedThenSpinAndParkCountersAndHistogramsAreUpdated) {
+    MockKmdNotifyHelper helper(&(hwInfo->capabilityTable.kmdNotifyProperties));
+
+    helper.recordWaitCompletion(true, 0, 0);
+    helper.recordWaitCompletion(true, 5, 0);
+    helper.recordWaitCompletion(false, 300, 100);
+
+    auto statistics = helper.getAdaptiveWaitStatistics();
+    EXPECT_EQ(2u, statistics.spinCompletions);
+    EXPECT_EQ(1u, statistics.parkedCompletions);
+    EXPECT_EQ(helper.expectedCompletionLatencyUs, statistics.expectedCompletionLatencyUs);
+    EXPECT_EQ(1u, statistics.spinLatencyHistogram[0]);
+    EXPECT_EQ(1u, statistics.spinLatencyHistogram[3]);
+    EXPECT_EQ(1u, statistics.wakeUpLatencyHistogram[7]);
+}
+
+TEST(KmdNotifyHelperTest, whenLatencyHistogramBucketIsObtainedThenLog2OfLatencyIsReturnedAndLastBucketIsSaturated) {
+    EXPECT_EQ(0u, KmdNotifyHelper::getLatencyHistogramBucket(-1));
+    EXPECT_EQ(0u, KmdNotifyHelper::getLatencyHistogramBucket(0));
+    EXPECT_EQ(1u, KmdNotifyHelper::getLatencyHistogramBucket(1));
+    EXPECT_EQ(2u, KmdNotifyHelper::getLatencyHistogramBucket(2));
+    EXPECT_EQ(2u, KmdNotifyHelper::getLatencyHistogramBucket(3));
+    EXPECT_EQ(11u, KmdNotifyHelper::getLatencyHistogramBucket(1024));
+    EXPECT_EQ(AdaptiveWaitConstants::latencyHistogramBuckets - 1, KmdNotifyHelper::getLatencyHistogramBucket(INT64_MAX));
+}
+
+HWTEST_F(KmdNotifyTests, givenAdaptiveWaitEnabledWhenTaskCountIsReachedWhileSpinningThenSpinCompletionIsRecorded) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableAdaptiveWait.set(true);
+    overrideKmdNotifyParams(true, 1000000, false, 0, false, 0);
+    auto csr = createMockCsr<FamilyType>();
+    EXPECT_TRUE(mockKmdNotifyHelper->isAdaptiveWaitEnabled());
+
+    EXPECT_CALL(*csr, waitForCompletionWithTimeout(true, AdaptiveWaitConstants::initialSpinMicroseconds, taskCountToWait)).Times(1).WillOnce(::testing::Return(true));
+    EXPECT_CALL(*csr, waitForFlushStamp(::testing::_)).Times(0);
+
+    csr->waitForTaskCountWithKmdNotifyFallback(taskCountToWait, flushStampToWait, false, false);
+
+    auto statistics = mockKmdNotifyHelper->getAdaptiveWaitStatistics();
+    EXPECT_EQ(1u, statistics.spinCompletions);
+    EXPECT_EQ(0u, statistics.parkedCompletions);
+    EXPECT_LE(0, statistics.expectedCompletionLatencyUs);
+}
+
+HWTEST_F(KmdNotifyTests, givenAdaptiveWaitEnabledWhenSpinTimesOutThenKmdWaitIsUsedAndParkedCompletionIsRecorded) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableAdaptiveWait.set(true);
+    overrideKmdNotifyParams(true, 1000000, false, 0, false, 0);
+    auto csr = createMockCsr<FamilyType>();
+
+    ::testing::InSequence is;
+    EXPECT_CALL(*csr, waitForCompletionWithTimeout(true, AdaptiveWaitConstants::initialSpinMicroseconds, taskCountToWait)).Times(1).WillOnce(::testing::Return(false));
+    EXPECT_CALL(*csr, waitForFlushStamp(flushStampToWait)).Times(1).WillOnce(::testing::Return(true));
+    EXPECT_CALL(*csr, waitForCompletionWithTimeout(false, 0, taskCountToWait)).Times(1).WillOnce(::testing::Return(true));
+
+    csr->waitForTaskCountWithKmdNotifyFallback(taskCountToWait, flushStampToWait, false, false);
+
+    auto statistics = mockKmdNotifyHelper->getAdaptiveWaitStatistics();
+    EXPECT_EQ(0u, statistics.spinCompletions);
+    EXPECT_EQ(1u, statistics.parkedCompletions);
+}
+
+HWTEST_F(KmdNotifyTests, givenAdaptiveWaitEnabledAndKmdNotifyDisabledWhenSpinTimesOutThenKmdWaitIsUsed) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableAdaptiveWait.set(true);
+    overrideKmdNotifyParams(false, 0, false, 0, false, 0);
+    auto csr = createMockCsr<FamilyType>();
+    mockKmdNotifyHelper->acLineConnected = true;
+
+    ::testing::InSequence is;
+    EXPECT_CALL(*csr, waitForCompletionWithTimeout(true, AdaptiveWaitConstants::initialSpinMicroseconds, taskCountToWait)).Times(1).WillOnce(::testing::Return(false));
+    EXPECT_CALL(*csr, waitForFlushStamp(flushStampToWait)).Times(1).WillOnce(::testing::Return(true));
+    EXPECT_CALL(*csr, waitForCompletionWithTimeout(false, 0, taskCountToWait)).Times(1).WillOnce(::testing::Return(true));
+
+    csr->waitForTaskCountWithKmdNotifyFallback(taskCountToWait, flushStampToWait, false, false);
+
+    EXPECT_EQ(1u, mockKmdNotifyHelper->getAdaptiveWaitStatistics().parkedCompletions);
+}
+
 #if defined(__clang__)
 #pragma clang diagnostic pop
 #endif
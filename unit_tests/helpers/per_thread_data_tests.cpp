@@ -8,6 +8,7 @@
 #include "core/command_stream/linear_stream.h"
 #include "core/helpers/aligned_memory.h"
 #include "runtime/command_queue/local_id_gen.h"
+#include "runtime/command_queue/local_ids_cache.h"
 #include "runtime/helpers/per_thread_data.h"
 #include "runtime/program/kernel_info.h"
 #include "test.h"
@@ -121,6 +122,26 @@ HWTEST_F(PerThreadDataXYZTests, sendPerThreadData_2x4x8) {
     EXPECT_EQ(64u * (3u * 2u * 4u * 8u) / 32u, sizeConsumed);
 }
 
+HWTEST_F(PerThreadDataXYZTests, givenLocalIdsCacheWhenPerThreadDataIsSentThenCachedLocalIdsMatchGeneratedOnes) {
+    MockGraphicsAllocation gfxAllocation(indirectHeapMemory, indirectHeapMemorySize);
+    LinearStream indirectHeap(&gfxAllocation);
+    LocalIdsCache localIdsCache(LocalIdsCache::defaultMaxEntries);
+
+    const size_t localWorkSizes[3]{2, 4, 8};
+    auto offsetGenerated = PerThreadDataHelper::sendPerThreadData(indirectHeap, simd, numChannels, localWorkSizes, workgroupWalkOrder, false);
+    auto offsetMiss = PerThreadDataHelper::sendPerThreadData(indirectHeap, simd, numChannels, localWorkSizes, workgroupWalkOrder, false, &localIdsCache);
+    auto offsetHit = PerThreadDataHelper::sendPerThreadData(indirectHeap, simd, numChannels, localWorkSizes, workgroupWalkOrder, false, &localIdsCache);
+
+    auto size = PerThreadDataHelper::getPerThreadDataSizeTotal(simd, numChannels, 2 * 4 * 8);
+    EXPECT_EQ(offsetGenerated + size, offsetMiss);
+    EXPECT_EQ(offsetMiss + size, offsetHit);
+    EXPECT_EQ(offsetHit + size, indirectHeap.getUsed());
+    EXPECT_EQ(0, memcmp(indirectHeapMemory + offsetGenerated, indirectHeapMemory + offsetMiss, size));
+    EXPECT_EQ(0, memcmp(indirectHeapMemory + offsetGenerated, indirectHeapMemory + offsetHit, size));
+    EXPECT_EQ(1u, localIdsCache.getMisses());
+    EXPECT_EQ(1u, localIdsCache.getHits());
+}
+
 HWTEST_F(PerThreadDataXYZTests, getThreadPayloadSize) {
     simd = 32;
     uint32_t size = PerThreadDataHelper::getThreadPayloadSize(threadPayload, simd);
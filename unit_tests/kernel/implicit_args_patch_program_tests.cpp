@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/kernel/implicit_args_patch_program.h"
+#include "runtime/program/kernel_info.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+struct ImplicitArgsPatchProgramTest : public ::testing::Test {
+    void SetUp() override {
+        for (uint32_t i = 0; i < ImplicitArgsPatchProgram::NumSources; i++) {
+            values[i] = 0x100 + i;
+        }
+        memset(crossThreadData, 0, sizeof(crossThreadData));
+    }
+
+    uint32_t readCrossThreadData(uint32_t offset) const {
+        return crossThreadData[offset / sizeof(uint32_t)];
+    }
+
+    WorkloadInfo workloadInfo;
+    ImplicitArgsPatchProgram patchProgram;
+    uint32_t values[ImplicitArgsPatchProgram::NumSources];
+    uint32_t crossThreadData[32];
+};
+
+TEST_F(ImplicitArgsPatchProgramTest, givenNoImplicitArgsWhenProgramIsBuiltThenItIsEmpty) {
+    patchProgram.build(workloadInfo);
+    EXPECT_TRUE(patchProgram.getOps().empty());
+    EXPECT_EQ(0u, patchProgram.getRequiredCrossThreadDataSize());
+
+    patchProgram.apply(reinterpret_cast<char *>(crossThreadData), 0u, values, true);
+}
+
+TEST_F(ImplicitArgsPatchProgramTest, givenAllImplicitArgsWhenProgramIsAppliedToMainKernelThenEveryOffsetIsPatched) {
+    uint32_t offset = 0;
+    for (uint32_t dim = 0; dim < 3; dim++) {
+        workloadInfo.globalWorkOffsetOffsets[dim] = offset++ * sizeof(uint32_t);
+        workloadInfo.globalWorkSizeOffsets[dim] = offset++ * sizeof(uint32_t);
+        workloadInfo.localWorkSizeOffsets[dim] = offset++ * sizeof(uint32_t);
+        workloadInfo.localWorkSizeOffsets2[dim] = offset++ * sizeof(uint32_t);
+        workloadInfo.enqueuedLocalWorkSizeOffsets[dim] = offset++ * sizeof(uint32_t);
+        workloadInfo.numWorkGroupsOffset[dim] = offset++ * sizeof(uint32_t);
+    }
+    workloadInfo.workDimOffset = offset++ * sizeof(uint32_t);
+
+    patchProgram.build(workloadInfo);
+    EXPECT_EQ(19u, patchProgram.getOps().size());
+    EXPECT_EQ(offset * sizeof(uint32_t), patchProgram.getRequiredCrossThreadDataSize());
+
+    patchProgram.apply(reinterpret_cast<char *>(crossThreadData), sizeof(crossThreadData), values, true);
+
+    for (uint32_t dim = 0; dim < 3; dim++) {
+        EXPECT_EQ(values[ImplicitArgsPatchProgram::GlobalWorkOffsetX + dim], readCrossThreadData(workloadInfo.globalWorkOffsetOffsets[dim]));
+        EXPECT_EQ(values[ImplicitArgsPatchProgram::GlobalWorkSizeX + dim], readCrossThreadData(workloadInfo.globalWorkSizeOffsets[dim]));
+        EXPECT_EQ(values[ImplicitArgsPatchProgram::LocalWorkSizeX + dim], readCrossThreadData(workloadInfo.localWorkSizeOffsets[dim]));
+        EXPECT_EQ(values[ImplicitArgsPatchProgram::LocalWorkSizeX + dim], readCrossThreadData(workloadInfo.localWorkSizeOffsets2[dim]));
+        EXPECT_EQ(values[ImplicitArgsPatchProgram::EnqueuedLocalWorkSizeX + dim], readCrossThreadData(workloadInfo.enqueuedLocalWorkSizeOffsets[dim]));
+        EXPECT_EQ(values[ImplicitArgsPatchProgram::NumWorkGroupsX + dim], readCrossThreadData(workloadInfo.numWorkGroupsOffset[dim]));
+    }
+    EXPECT_EQ(values[ImplicitArgsPatchProgram::WorkDim], readCrossThreadData(workloadInfo.workDimOffset));
+}
+
+TEST_F(ImplicitArgsPatchProgramTest, givenKernelWithSecondLocalWorkSizeWhenProgramIsAppliedToNonMainKernelThenFirstLocalWorkSizeAndNumWorkGroupsAreNotPatched) {
+    workloadInfo.localWorkSizeOffsets[0] = 0;
+    workloadInfo.localWorkSizeOffsets2[0] = 4;
+    workloadInfo.numWorkGroupsOffset[0] = 8;
+    workloadInfo.globalWorkSizeOffsets[0] = 12;
+
+    patchProgram.build(workloadInfo);
+    EXPECT_EQ(2u, patchProgram.getNumUnconditionalOps());
+
+    patchProgram.apply(reinterpret_cast<char *>(crossThreadData), sizeof(crossThreadData), values, false);
+
+    EXPECT_EQ(0u, readCrossThreadData(0));
+    EXPECT_EQ(values[ImplicitArgsPatchProgram::LocalWorkSizeX], readCrossThreadData(4));
+    EXPECT_EQ(0u, readCrossThreadData(8));
+    EXPECT_EQ(values[ImplicitArgsPatchProgram::GlobalWorkSizeX], readCrossThreadData(12));
+}
+
+TEST_F(ImplicitArgsPatchProgramTest, givenKernelWithoutSecondLocalWorkSizeWhenProgramIsAppliedToNonMainKernelThenFirstLocalWorkSizeIsPatched) {
+    workloadInfo.localWorkSizeOffsets[0] = 0;
+    workloadInfo.numWorkGroupsOffset[0] = 8;
+
+    patchProgram.build(workloadInfo);
+    EXPECT_EQ(1u, patchProgram.getNumUnconditionalOps());
+
+    patchProgram.apply(reinterpret_cast<char *>(crossThreadData), sizeof(crossThreadData), values, false);
+
+    EXPECT_EQ(values[ImplicitArgsPatchProgram::LocalWorkSizeX], readCrossThreadData(0));
+    EXPECT_EQ(0u, readCrossThreadData(8));
+}
+
+TEST_F(ImplicitArgsPatchProgramTest, givenCrossThreadDataSmallerThanRequiredWhenProgramIsAppliedThenAbortIsCalled) {
+    workloadInfo.workDimOffset = 16;
+    patchProgram.build(workloadInfo);
+
+    EXPECT_THROW(patchProgram.apply(reinterpret_cast<char *>(crossThreadData), 16u, values, true), std::exception);
+}
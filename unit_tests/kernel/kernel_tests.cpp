@@ -476,6 +476,12 @@ class CommandStreamReceiverMock : public CommandStreamReceiver {
         }
     }
 
+    void makeAllocationsResident(ArrayRef<GraphicsAllocation *const> graphicsAllocations) override {
+        for (auto graphicsAllocation : graphicsAllocations) {
+            makeResident(*graphicsAllocation);
+        }
+    }
+
     void makeNonResident(GraphicsAllocation &graphicsAllocation) override {
         residency.erase(graphicsAllocation.getUnderlyingBuffer());
         if (passResidencyCallToBaseClass) {
@@ -2432,6 +2438,46 @@ TEST_F(KernelCrossThreadTests, givenKernelWithPreferredWkgMultipleWhenItIsCreate
     delete kernel;
 }
 
+TEST_F(KernelCrossThreadTests, givenImplicitArgsPatchProgramDisabledWhenKernelIsInitializedThenPatchProgramIsNotCreated) {
+    pKernelInfo->workloadInfo.globalWorkOffsetOffsets[0] = 0;
+
+    MockKernel kernel(program.get(), *pKernelInfo, *pDevice);
+    ASSERT_EQ(CL_SUCCESS, kernel.initialize());
+    EXPECT_EQ(nullptr, kernel.getImplicitArgsPatchProgram());
+}
+
+TEST_F(KernelCrossThreadTests, givenImplicitArgsPatchProgramEnabledWhenItIsAppliedThenImplicitArgsAreWrittenToTheSameLocationsAsPatchPointers) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableImplicitArgsPatchProgram.set(true);
+
+    pKernelInfo->workloadInfo.globalWorkOffsetOffsets[0] = 0;
+    pKernelInfo->workloadInfo.globalWorkSizeOffsets[1] = 4;
+    pKernelInfo->workloadInfo.localWorkSizeOffsets[2] = 8;
+    pKernelInfo->workloadInfo.enqueuedLocalWorkSizeOffsets[0] = 12;
+    pKernelInfo->workloadInfo.numWorkGroupsOffset[1] = 16;
+    pKernelInfo->workloadInfo.workDimOffset = 20;
+
+    MockKernel kernel(program.get(), *pKernelInfo, *pDevice);
+    ASSERT_EQ(CL_SUCCESS, kernel.initialize());
+
+    auto patchProgram = kernel.getImplicitArgsPatchProgram();
+    ASSERT_NE(nullptr, patchProgram);
+    EXPECT_EQ(6u, patchProgram->getOps().size());
+
+    uint32_t values[ImplicitArgsPatchProgram::NumSources];
+    for (uint32_t i = 0; i < ImplicitArgsPatchProgram::NumSources; i++) {
+        values[i] = 100 + i;
+    }
+    patchProgram->apply(kernel.getCrossThreadData(), kernel.getCrossThreadDataSize(), values, true);
+
+    EXPECT_EQ(values[ImplicitArgsPatchProgram::GlobalWorkOffsetX], *kernel.globalWorkOffsetX);
+    EXPECT_EQ(values[ImplicitArgsPatchProgram::GlobalWorkSizeY], *kernel.globalWorkSizeY);
+    EXPECT_EQ(values[ImplicitArgsPatchProgram::LocalWorkSizeZ], *kernel.localWorkSizeZ);
+    EXPECT_EQ(values[ImplicitArgsPatchProgram::EnqueuedLocalWorkSizeX], *kernel.enqueuedLocalWorkSizeX);
+    EXPECT_EQ(values[ImplicitArgsPatchProgram::NumWorkGroupsY], *kernel.numWorkGroupsY);
+    EXPECT_EQ(values[ImplicitArgsPatchProgram::WorkDim], *kernel.workDim);
+}
+
 TEST_F(KernelCrossThreadTests, patchBlocksSimdSize) {
     MockKernelWithInternals *kernel = new MockKernelWithInternals(*pDevice);
 
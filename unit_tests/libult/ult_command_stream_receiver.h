@@ -35,6 +35,7 @@ class UltCommandStreamReceiver : public CommandStreamReceiverHw<GfxFamily>, publ
     using BaseClass::programStateSip;
     using BaseClass::requiresInstructionCacheFlush;
     using BaseClass::sshState;
+    using BaseClass::stateInputsCache;
     using BaseClass::CommandStreamReceiver::bindingTableBaseAddressRequired;
     using BaseClass::CommandStreamReceiver::cleanupResources;
     using BaseClass::CommandStreamReceiver::commandStream;
@@ -134,6 +135,17 @@ class UltCommandStreamReceiver : public CommandStreamReceiverHw<GfxFamily>, publ
         BaseClass::makeResident(gfxAllocation);
     }
 
+    void makeAllocationsResident(ArrayRef<GraphicsAllocation *const> gfxAllocations) override {
+        makeAllocationsResidentCalled++;
+        if (storeMakeResidentAllocations) {
+            for (auto gfxAllocation : gfxAllocations) {
+                makeResident(*gfxAllocation);
+            }
+            return;
+        }
+        BaseClass::makeAllocationsResident(gfxAllocations);
+    }
+
     bool isMadeResident(GraphicsAllocation *graphicsAllocation) const {
         return makeResidentAllocations.find(graphicsAllocation) != makeResidentAllocations.end();
     }
@@ -200,6 +212,7 @@ class UltCommandStreamReceiver : public CommandStreamReceiverHw<GfxFamily>, publ
     std::vector<std::string> aubCommentMessages;
     bool flushBatchedSubmissionsCalled = false;
     uint32_t makeSurfacePackNonResidentCalled = false;
+    uint32_t makeAllocationsResidentCalled = 0;
     bool initProgrammingFlagsCalled = false;
     LinearStream *lastFlushedCommandStream = nullptr;
     BatchBuffer latestFlushedBatchBuffer = {};
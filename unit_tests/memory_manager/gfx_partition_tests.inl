@@ -9,6 +9,7 @@
 #include "core/helpers/basic_math.h"
 #include "core/helpers/ptr_math.h"
 #include "core/os_interface/os_memory.h"
+#include "core/unit_tests/helpers/debug_manager_state_restore.h"
 #include "unit_tests/mocks/mock_gfx_partition.h"
 
 #include "gtest/gtest.h"
@@ -124,3 +125,16 @@ TEST(GfxPartitionTest, testGfxPartitionUnsupportedRange) {
     MockGfxPartition gfxPartition;
     EXPECT_THROW(gfxPartition.init(maxNBitValue<48 + 1>, reservedCpuAddressRangeSize), std::exception);
 }
+
+TEST(GfxPartitionTest, givenSegregatedHeapAllocatorEnabledWhenGfxPartitionIsInitializedThenHeapsAllocateFromTheSameAddresses) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.UseSegregatedHeapAllocator.set(true);
+
+    MockGfxPartition gfxPartition;
+    gfxPartition.init(maxNBitValue<48>, reservedCpuAddressRangeSize);
+
+    uint64_t gfxTop = maxNBitValue<48> + 1;
+    uint64_t gfxBase = MemoryConstants::maxSvmAddress + 1;
+
+    testGfxPartition(gfxPartition, gfxBase, gfxTop, gfxBase);
+}
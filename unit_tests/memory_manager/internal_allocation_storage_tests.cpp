@@ -242,3 +242,117 @@ TEST_F(InternalAllocationStorageTest, givenAllocationListWhenTwoThreadsCleanConc
 
     EXPECT_TRUE(csr->getTemporaryAllocations().peekIsEmpty());
 }
+
+TEST_F(InternalAllocationStorageTest, givenReusableAllocationsWhenObtainingThenHitsAndMissesAreCounted) {
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER});
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation), REUSABLE_ALLOCATION, 2u);
+
+    auto *hwTag = csr->getTagAddress();
+    *hwTag = 1u;
+    EXPECT_EQ(nullptr, storage->obtainReusableAllocation(1, GraphicsAllocation::AllocationType::BUFFER));
+    EXPECT_EQ(0u, storage->getReuseCounters().hits);
+    EXPECT_EQ(1u, storage->getReuseCounters().misses);
+
+    *hwTag = 2u;
+    auto reusedAllocation = storage->obtainReusableAllocation(1, GraphicsAllocation::AllocationType::BUFFER).release();
+    EXPECT_EQ(allocation, reusedAllocation);
+    EXPECT_EQ(1u, storage->getReuseCounters().hits);
+    EXPECT_EQ(1u, storage->getReuseCounters().misses);
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(InternalAllocationStorageTest, givenReusableAllocationsOfDifferentSizesWhenObtainingThenAllocationBigEnoughIsReturned) {
+    auto smallAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{MemoryConstants::pageSize, GraphicsAllocation::AllocationType::LINEAR_STREAM});
+    auto bigAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{4 * MemoryConstants::pageSize, GraphicsAllocation::AllocationType::LINEAR_STREAM});
+    storage->storeAllocation(std::unique_ptr<GraphicsAllocation>(smallAllocation), REUSABLE_ALLOCATION);
+    storage->storeAllocation(std::unique_ptr<GraphicsAllocation>(bigAllocation), REUSABLE_ALLOCATION);
+
+    auto reusedAllocation = storage->obtainReusableAllocation(2 * MemoryConstants::pageSize, GraphicsAllocation::AllocationType::LINEAR_STREAM).release();
+    EXPECT_EQ(bigAllocation, reusedAllocation);
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekContains(*smallAllocation));
+
+    EXPECT_EQ(nullptr, storage->obtainReusableAllocation(2 * MemoryConstants::pageSize, GraphicsAllocation::AllocationType::LINEAR_STREAM));
+
+    reusedAllocation = storage->obtainReusableAllocation(MemoryConstants::pageSize, GraphicsAllocation::AllocationType::LINEAR_STREAM).release();
+    EXPECT_EQ(smallAllocation, reusedAllocation);
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekIsEmpty());
+
+    memoryManager->freeGraphicsMemory(smallAllocation);
+    memoryManager->freeGraphicsMemory(bigAllocation);
+}
+
+TEST_F(InternalAllocationStorageTest, givenPendingReusableAllocationsWhenTagIsUpdatedThenCompletedAllocationsCanBeObtained) {
+    GraphicsAllocation *allocations[3];
+    for (uint32_t i = 0; i < 3; i++) {
+        allocations[i] = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{MemoryConstants::pageSize, GraphicsAllocation::AllocationType::COMMAND_BUFFER});
+        storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocations[i]), REUSABLE_ALLOCATION, i + 1);
+    }
+
+    auto *hwTag = csr->getTagAddress();
+    *hwTag = 2u;
+    auto first = storage->obtainReusableAllocation(1, GraphicsAllocation::AllocationType::COMMAND_BUFFER).release();
+    auto second = storage->obtainReusableAllocation(1, GraphicsAllocation::AllocationType::COMMAND_BUFFER).release();
+    EXPECT_NE(nullptr, first);
+    EXPECT_NE(nullptr, second);
+    EXPECT_NE(first, second);
+    EXPECT_NE(allocations[2], first);
+    EXPECT_NE(allocations[2], second);
+    EXPECT_EQ(nullptr, storage->obtainReusableAllocation(1, GraphicsAllocation::AllocationType::COMMAND_BUFFER));
+
+    *hwTag = 3u;
+    auto third = storage->obtainReusableAllocation(1, GraphicsAllocation::AllocationType::COMMAND_BUFFER).release();
+    EXPECT_EQ(allocations[2], third);
+
+    for (auto allocation : allocations) {
+        memoryManager->freeGraphicsMemory(allocation);
+    }
+}
+
+TEST_F(InternalAllocationStorageTest, givenReusableAllocationsWhenCleaningListThenEvictionsAreCountedAndRemainingAllocationsCanBeObtained) {
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER});
+    auto allocation2 = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER});
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation), REUSABLE_ALLOCATION, 1u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation2), REUSABLE_ALLOCATION, 5u);
+
+    storage->cleanAllocationList(1u, REUSABLE_ALLOCATION);
+    EXPECT_EQ(1u, storage->getReuseCounters().evictions);
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekContains(*allocation2));
+
+    auto *hwTag = csr->getTagAddress();
+    *hwTag = 5u;
+    auto reusedAllocation = storage->obtainReusableAllocation(1, GraphicsAllocation::AllocationType::BUFFER).release();
+    EXPECT_EQ(allocation2, reusedAllocation);
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekIsEmpty());
+    memoryManager->freeGraphicsMemory(allocation2);
+}
+
+TEST_F(InternalAllocationStorageTest, givenPendingReusableAllocationsWhenCleaningListThenRemainingAllocationsAreObtainedInTaskCountOrder) {
+    GraphicsAllocation *allocations[4];
+    uint32_t taskCounts[4] = {4u, 1u, 3u, 6u};
+    for (uint32_t i = 0; i < 4; i++) {
+        allocations[i] = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{MemoryConstants::pageSize, GraphicsAllocation::AllocationType::COMMAND_BUFFER});
+        storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocations[i]), REUSABLE_ALLOCATION, taskCounts[i]);
+    }
+
+    storage->cleanAllocationList(3u, REUSABLE_ALLOCATION);
+    EXPECT_EQ(2u, storage->getReuseCounters().evictions);
+
+    auto *hwTag = csr->getTagAddress();
+    *hwTag = 3u;
+    EXPECT_EQ(nullptr, storage->obtainReusableAllocation(1, GraphicsAllocation::AllocationType::COMMAND_BUFFER));
+    EXPECT_EQ(1u, storage->getReuseCounters().misses);
+
+    *hwTag = 4u;
+    auto reusedAllocation = storage->obtainReusableAllocation(1, GraphicsAllocation::AllocationType::COMMAND_BUFFER).release();
+    EXPECT_EQ(allocations[0], reusedAllocation);
+    EXPECT_EQ(nullptr, storage->obtainReusableAllocation(1, GraphicsAllocation::AllocationType::COMMAND_BUFFER));
+
+    *hwTag = 6u;
+    auto reusedAllocation2 = storage->obtainReusableAllocation(1, GraphicsAllocation::AllocationType::COMMAND_BUFFER).release();
+    EXPECT_EQ(allocations[3], reusedAllocation2);
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekIsEmpty());
+    EXPECT_EQ(2u, storage->getReuseCounters().hits);
+
+    memoryManager->freeGraphicsMemory(reusedAllocation);
+    memoryManager->freeGraphicsMemory(reusedAllocation2);
+}
@@ -1623,6 +1623,46 @@ TEST(MemoryManagerRegisteredEnginesTest, givenOsContextWhenItIsUnregisteredFromM
     engine.osContext->decRefInternal();
 }
 
+struct AllocationFreedCountingCsr : public MockCommandStreamReceiver {
+    using MockCommandStreamReceiver::MockCommandStreamReceiver;
+
+    void onAllocationFreed(GraphicsAllocation &gfxAllocation) override {
+        onAllocationFreedCalled++;
+    }
+
+    uint32_t onAllocationFreedCalled = 0;
+};
+
+TEST(MemoryManagerRegisteredEnginesTest, givenDirtyPageTrackingDisabledWhenAllocationIsFreedThenRegisteredCsrsAreNotNotified) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableAubDirtyPageTracking.set(false);
+    MockExecutionEnvironment executionEnvironment(*platformDevices);
+    MockMemoryManager memoryManager(false, false, executionEnvironment);
+    EXPECT_FALSE(memoryManager.dirtyPageTrackingEnabled);
+
+    AllocationFreedCountingCsr csr(executionEnvironment);
+    memoryManager.createAndRegisterOsContext(&csr, HwHelper::get(platformDevices[0]->platform.eRenderCoreFamily).getGpgpuEngineInstances()[0],
+                                             1, PreemptionHelper::getDefaultPreemptionMode(*platformDevices[0]), false);
+    memoryManager.freeGraphicsMemory(memoryManager.allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize}));
+
+    EXPECT_EQ(0u, csr.onAllocationFreedCalled);
+}
+
+TEST(MemoryManagerRegisteredEnginesTest, givenDirtyPageTrackingEnabledWhenAllocationIsFreedThenRegisteredCsrsAreNotified) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableAubDirtyPageTracking.set(true);
+    MockExecutionEnvironment executionEnvironment(*platformDevices);
+    MockMemoryManager memoryManager(false, false, executionEnvironment);
+    EXPECT_TRUE(memoryManager.dirtyPageTrackingEnabled);
+
+    AllocationFreedCountingCsr csr(executionEnvironment);
+    memoryManager.createAndRegisterOsContext(&csr, HwHelper::get(platformDevices[0]->platform.eRenderCoreFamily).getGpgpuEngineInstances()[0],
+                                             1, PreemptionHelper::getDefaultPreemptionMode(*platformDevices[0]), false);
+    memoryManager.freeGraphicsMemory(memoryManager.allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize}));
+
+    EXPECT_EQ(1u, csr.onAllocationFreedCalled);
+}
+
 TEST(ResidencyDataTest, givenDeviceBitfieldWhenCreatingOsContextThenSetValidValue) {
     MockExecutionEnvironment executionEnvironment(*platformDevices);
     MockMemoryManager memoryManager(false, false, executionEnvironment);
@@ -114,6 +114,18 @@ TEST_F(SVMMemoryAllocatorTest, whenGetSVMAllocationFromOutsideOfReturnedPointerA
     svmManager->freeSVMAlloc(ptr);
 }
 
+TEST_F(SVMMemoryAllocatorTest, whenGetSVMAllocationPastRequestedSizeWithinLastPageThenDontReturnThisAllocation) {
+    auto ptr = svmManager->createSVMAlloc(100, {});
+    ASSERT_NE(nullptr, ptr);
+
+    EXPECT_NE(nullptr, svmManager->getSVMAlloc(ptrOffset(ptr, 99)));
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(ptrOffset(ptr, 100)));
+    EXPECT_FALSE(svmManager->SVMAllocs.hasAllocationsOutsideRangeIndex());
+
+    svmManager->freeSVMAlloc(ptr);
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(ptr));
+}
+
 TEST_F(SVMMemoryAllocatorTest, whenCouldNotAllocateInMemoryManagerThenReturnsNullAndDoesNotChangeAllocsMap) {
     FailMemoryManager failMemoryManager(executionEnvironment);
     svmManager->memoryManager = &failMemoryManager;
@@ -289,6 +301,83 @@ TEST_F(SVMMemoryAllocatorTest, givenSharedAllocationsDebugFlagWhenDeviceMemoryIs
 
     svmManager->freeSVMAlloc(ptr);
 }
+TEST_F(SVMMemoryAllocatorTest, givenUnchangedAllocationsWhenGettingResidencySnapshotAgainThenItIsNotRebuilt) {
+    auto ptr = svmManager->createUnifiedMemoryAllocation(4096u, SVMAllocsManager::UnifiedMemoryProperties(InternalMemoryType::HOST_UNIFIED_MEMORY));
+    ASSERT_NE(nullptr, ptr);
+    auto gpuAllocation = svmManager->getSVMAlloc(ptr)->gpuAllocation;
+
+    auto &snapshot = svmManager->getResidencySnapshot(InternalMemoryType::HOST_UNIFIED_MEMORY);
+    ASSERT_EQ(1u, snapshot.size());
+    EXPECT_EQ(gpuAllocation, snapshot[0]);
+    auto snapshotVersion = svmManager->residencySnapshots[InternalMemoryType::HOST_UNIFIED_MEMORY].allocationsVersion;
+
+    svmManager->residencySnapshots[InternalMemoryType::HOST_UNIFIED_MEMORY].allocations.push_back(nullptr);
+    auto &secondSnapshot = svmManager->getResidencySnapshot(InternalMemoryType::HOST_UNIFIED_MEMORY);
+    EXPECT_EQ(&snapshot, &secondSnapshot);
+    EXPECT_EQ(2u, secondSnapshot.size());
+    EXPECT_EQ(snapshotVersion, svmManager->residencySnapshots[InternalMemoryType::HOST_UNIFIED_MEMORY].allocationsVersion);
+
+    svmManager->freeSVMAlloc(ptr);
+}
+
+TEST_F(SVMMemoryAllocatorTest, givenResidencySnapshotWhenAllocationIsAddedOrFreedThenSnapshotIsRebuilt) {
+    auto ptr = svmManager->createUnifiedMemoryAllocation(4096u, SVMAllocsManager::UnifiedMemoryProperties(InternalMemoryType::HOST_UNIFIED_MEMORY));
+    ASSERT_NE(nullptr, ptr);
+    EXPECT_EQ(1u, svmManager->getResidencySnapshot(InternalMemoryType::HOST_UNIFIED_MEMORY).size());
+
+    auto ptr2 = svmManager->createUnifiedMemoryAllocation(4096u, SVMAllocsManager::UnifiedMemoryProperties(InternalMemoryType::HOST_UNIFIED_MEMORY));
+    ASSERT_NE(nullptr, ptr2);
+    EXPECT_EQ(2u, svmManager->getResidencySnapshot(InternalMemoryType::HOST_UNIFIED_MEMORY).size());
+
+    svmManager->freeSVMAlloc(ptr);
+    auto &snapshot = svmManager->getResidencySnapshot(InternalMemoryType::HOST_UNIFIED_MEMORY);
+    ASSERT_EQ(1u, snapshot.size());
+    EXPECT_EQ(svmManager->getSVMAlloc(ptr2)->gpuAllocation, snapshot[0]);
+
+    svmManager->freeSVMAlloc(ptr2);
+    EXPECT_EQ(0u, svmManager->getResidencySnapshot(InternalMemoryType::HOST_UNIFIED_MEMORY).size());
+}
+
+TEST_F(SVMMemoryAllocatorTest, givenDifferentMemoryTypeMasksWhenGettingResidencySnapshotsThenOnlyMatchingAllocationsAreIncluded) {
+    auto hostPtr = svmManager->createUnifiedMemoryAllocation(4096u, SVMAllocsManager::UnifiedMemoryProperties(InternalMemoryType::HOST_UNIFIED_MEMORY));
+    auto devicePtr = svmManager->createUnifiedMemoryAllocation(4096u, SVMAllocsManager::UnifiedMemoryProperties(InternalMemoryType::DEVICE_UNIFIED_MEMORY));
+    auto svmPtr = svmManager->createSVMAlloc(4096u, {});
+    ASSERT_NE(nullptr, hostPtr);
+    ASSERT_NE(nullptr, devicePtr);
+    ASSERT_NE(nullptr, svmPtr);
+
+    auto &hostSnapshot = svmManager->getResidencySnapshot(InternalMemoryType::HOST_UNIFIED_MEMORY);
+    ASSERT_EQ(1u, hostSnapshot.size());
+    EXPECT_EQ(svmManager->getSVMAlloc(hostPtr)->gpuAllocation, hostSnapshot[0]);
+
+    auto &deviceSnapshot = svmManager->getResidencySnapshot(InternalMemoryType::DEVICE_UNIFIED_MEMORY);
+    ASSERT_EQ(1u, deviceSnapshot.size());
+    EXPECT_EQ(svmManager->getSVMAlloc(devicePtr)->gpuAllocation, deviceSnapshot[0]);
+
+    EXPECT_EQ(2u, svmManager->getResidencySnapshot(InternalMemoryType::HOST_UNIFIED_MEMORY | InternalMemoryType::DEVICE_UNIFIED_MEMORY).size());
+    EXPECT_EQ(3u, svmManager->residencySnapshots.size());
+
+    svmManager->freeSVMAlloc(hostPtr);
+    svmManager->freeSVMAlloc(devicePtr);
+    svmManager->freeSVMAlloc(svmPtr);
+}
+
+TEST_F(SVMLocalMemoryAllocatorTest, givenResidencySnapshotWhenSharedAllocationWithDeviceStorageIsCreatedThenItIsIncludedWithSharedType) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.AllocateSharedAllocationsWithCpuAndGpuStorage.set(1);
+    EXPECT_EQ(0u, svmManager->getResidencySnapshot(InternalMemoryType::SHARED_UNIFIED_MEMORY).size());
+
+    MockCommandQueue cmdQ;
+    auto ptr = svmManager->createSharedUnifiedMemoryAllocation(4096u, SVMAllocsManager::UnifiedMemoryProperties(InternalMemoryType::SHARED_UNIFIED_MEMORY), &cmdQ);
+    ASSERT_NE(nullptr, ptr);
+
+    auto &snapshot = svmManager->getResidencySnapshot(InternalMemoryType::SHARED_UNIFIED_MEMORY);
+    ASSERT_EQ(1u, snapshot.size());
+    EXPECT_EQ(svmManager->getSVMAlloc(ptr)->gpuAllocation, snapshot[0]);
+
+    svmManager->freeSVMAlloc(ptr);
+}
+
 TEST(SvmAllocationPropertiesTests, givenDifferentMemFlagsWhenGettingSvmAllocationPropertiesThenPropertiesAreCorrectlySet) {
     SVMAllocsManager::SvmAllocationProperties allocationProperties = MemObjHelper::getSvmAllocationProperties(0);
     EXPECT_FALSE(allocationProperties.coherent);
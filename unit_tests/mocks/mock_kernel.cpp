@@ -58,6 +58,6 @@ bool MockKernel::requiresCacheFlushCommand(const CommandQueue &commandQueue) con
         return !!DebugManager.flags.EnableCacheFlushAfterWalker.get();
     }
 
-    return false;
+    return cacheFlushCommandRequired;
 }
 } // namespace NEO
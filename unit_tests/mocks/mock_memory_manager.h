@@ -36,6 +36,7 @@ class MockMemoryManager : public MemoryManagerCreate<OsAgnosticMemoryManager> {
     using MemoryManager::AllocationData;
     using MemoryManager::createGraphicsAllocation;
     using MemoryManager::createStorageInfoFromProperties;
+    using MemoryManager::dirtyPageTrackingEnabled;
     using MemoryManager::getAllocationData;
     using MemoryManager::getBanksCount;
     using MemoryManager::gfxPartition;
@@ -42,11 +42,13 @@ class MockProgram : public Program {
     using Program::exportedFunctionsSurface;
     using Program::genBinary;
     using Program::genBinarySize;
+    using Program::genBinaryStorage;
     using Program::globalSurface;
     using Program::irBinary;
     using Program::irBinarySize;
     using Program::isProgramBinaryResolved;
     using Program::isSpirV;
+    using Program::lazyKernelDecodesCount;
     using Program::linkerInput;
     using Program::pDevice;
     using Program::programBinaryType;
@@ -10,7 +10,10 @@
 namespace NEO {
 struct MockSVMAllocsManager : SVMAllocsManager {
 
+    using SVMAllocsManager::getResidencySnapshot;
     using SVMAllocsManager::memoryManager;
+    using SVMAllocsManager::mtx;
+    using SVMAllocsManager::residencySnapshots;
     using SVMAllocsManager::SVMAllocs;
     using SVMAllocsManager::SVMAllocsManager;
     using SVMAllocsManager::svmMapOperations;
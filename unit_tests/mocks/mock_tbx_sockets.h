@@ -18,17 +18,32 @@ class MockTbxSockets : public TbxSockets {
     bool init(const std::string &hostNameOrIp, uint16_t port) override { return true; };
     void close() override{};
 
-    bool writeGTT(uint32_t gttOffset, uint64_t entry) override { return true; };
+    bool writeGTT(uint32_t gttOffset, uint64_t entry) override {
+        writesSinceFlush++;
+        return true;
+    };
 
     bool readMemory(uint64_t offset, void *data, size_t size) override { return true; };
     bool writeMemory(uint64_t offset, const void *data, size_t size, uint32_t type) override {
         typeCapturedFromWriteMemory = type;
+        writesSinceFlush++;
         return true;
     };
 
     bool readMMIO(uint32_t offset, uint32_t *data) override { return true; };
-    bool writeMMIO(uint32_t offset, uint32_t data) override { return true; };
+    bool writeMMIO(uint32_t offset, uint32_t data) override {
+        writesSinceFlush++;
+        return true;
+    };
+
+    bool flush() override {
+        flushCalled++;
+        writesSinceFlush = 0;
+        return true;
+    };
 
     uint32_t typeCapturedFromWriteMemory = 0;
+    uint32_t flushCalled = 0u;
+    uint32_t writesSinceFlush = 0u;
 };
 } // namespace NEO
@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/compiler_interface/compiler_thread_pool.h"
+#include "runtime/context/context.h"
+#include "runtime/helpers/file_io.h"
+#include "runtime/platform/platform.h"
+#include "runtime/program/program.h"
+#include "unit_tests/api/cl_api_tests.h"
+#include "unit_tests/helpers/kernel_binary_helper.h"
+#include "unit_tests/helpers/test_files.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+namespace ULT {
+
+struct BuildCompletion {
+    cl_device_id device = nullptr;
+    std::atomic<uint32_t> *completedBuilds = nullptr;
+    std::atomic<uint32_t> callbacksCount{0u};
+    cl_build_status statusInCallback = CL_BUILD_NONE;
+};
+
+void CL_CALLBACK recordBuildCompletion(cl_program program, void *userData) {
+    auto completion = reinterpret_cast<BuildCompletion *>(userData);
+    clGetProgramBuildInfo(program, completion->device, CL_PROGRAM_BUILD_STATUS, sizeof(completion->statusInCallback), &completion->statusInCallback, nullptr);
+    completion->callbacksCount++;
+    (*completion->completedBuilds)++;
+}
+
+struct clBuildProgramMtTests : public api_tests {
+    static constexpr uint32_t programsCount = 50u;
+    static constexpr uint32_t applicationThreadsCount = 4u;
+
+    void SetUp() override {
+        api_tests::SetUp();
+
+        std::string testFile;
+        testFile.append(clFiles);
+        testFile.append("CopyBuffer_simd8.cl");
+        sourceSize = loadDataFromFile(testFile.c_str(), pSource);
+        ASSERT_NE(0u, sourceSize);
+    }
+
+    void TearDown() override {
+        deleteDataReadFromFile(pSource);
+        api_tests::TearDown();
+    }
+
+    // Application startup pattern: every program is created and built with a callback before waiting for any of them,
+    // builds are requested from several application threads at once
+    void buildCorpus() {
+        std::vector<cl_program> programs(programsCount);
+        std::vector<std::unique_ptr<BuildCompletion>> completions;
+        std::atomic<uint32_t> completedBuilds{0u};
+        for (uint32_t i = 0; i < programsCount; i++) {
+            completions.emplace_back(new BuildCompletion);
+            completions.back()->device = devices[0];
+            completions.back()->completedBuilds = &completedBuilds;
+        }
+
+        std::vector<std::thread> threads;
+        std::atomic<uint32_t> failedCalls{0u};
+        for (uint32_t threadId = 0; threadId < applicationThreadsCount; threadId++) {
+            threads.emplace_back([&, threadId] {
+                const char *sources[] = {static_cast<const char *>(pSource)};
+                cl_int threadRetVal = CL_SUCCESS;
+                for (uint32_t i = threadId; i < programsCount; i += applicationThreadsCount) {
+                    programs[i] = clCreateProgramWithSource(pContext, 1, sources, &sourceSize, &threadRetVal);
+                    failedCalls += (threadRetVal != CL_SUCCESS) ? 1u : 0u;
+                    threadRetVal = clBuildProgram(programs[i], num_devices, devices, nullptr, recordBuildCompletion, completions[i].get());
+                    failedCalls += (threadRetVal != CL_SUCCESS) ? 1u : 0u;
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        EXPECT_EQ(0u, failedCalls);
+
+        while (completedBuilds < programsCount) {
+            std::this_thread::yield();
+        }
+
+        for (uint32_t i = 0; i < programsCount; i++) {
+            EXPECT_EQ(1u, completions[i]->callbacksCount.load());
+            EXPECT_EQ(CL_BUILD_SUCCESS, completions[i]->statusInCallback);
+            EXPECT_EQ(CL_BUILD_SUCCESS, castToObject<Program>(programs[i])->getBuildStatus());
+            clReleaseProgram(programs[i]);
+        }
+        EXPECT_EQ(programsCount, completedBuilds.load());
+    }
+
+    void *pSource = nullptr;
+    size_t sourceSize = 0u;
+};
+
+TEST_F(clBuildProgramMtTests, givenCorpusOfProgramsBuiltWithCallbackWhenCompilerThreadPoolIsUsedThenEachBuildCompletesOnceWithSuccess) {
+    KernelBinaryHelper kbHelper("CopyBuffer_simd8", false);
+
+    ASSERT_EQ(nullptr, platform()->getCompilerThreadPool());
+    buildCorpus();
+
+    auto threadsCount = CompilerThreadPool::getMaxThreadsCount(4);
+    auto oldThreadPool = platform()->setCompilerThreadPool(std::make_unique<CompilerThreadPool>(threadsCount));
+    buildCorpus();
+    platform()->setCompilerThreadPool(std::move(oldThreadPool));
+}
+} // namespace ULT
@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "core/unit_tests/helpers/debug_manager_state_restore.h"
+#include "runtime/context/context.h"
+#include "runtime/helpers/file_io.h"
+#include "runtime/kernel/kernel.h"
+#include "runtime/os_interface/debug_settings_manager.h"
+#include "runtime/program/program.h"
+#include "unit_tests/api/cl_api_tests.h"
+#include "unit_tests/helpers/test_files.h"
+#include "unit_tests/mocks/mock_program.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+namespace ULT {
+
+struct clCreateKernelMtTests : public api_tests {
+    static constexpr uint32_t threadsCount = 4u;
+
+    void SetUp() override {
+        api_tests::SetUp();
+
+        std::string testFile;
+        retrieveBinaryKernelFilename(testFile, "simple_kernels_", ".bin");
+        binarySize = loadDataFromFile(testFile.c_str(), pBinary);
+        ASSERT_NE(0u, binarySize);
+    }
+
+    void TearDown() override {
+        deleteDataReadFromFile(pBinary);
+        api_tests::TearDown();
+    }
+
+    cl_program loadProgram() {
+        cl_int binaryStatus = CL_SUCCESS;
+        auto program = clCreateProgramWithBinary(pContext, num_devices, devices, &binarySize, const_cast<const unsigned char **>(reinterpret_cast<unsigned char **>(&pBinary)), &binaryStatus, &retVal);
+        EXPECT_EQ(CL_SUCCESS, retVal);
+        retVal = clBuildProgram(program, num_devices, devices, nullptr, nullptr, nullptr);
+        EXPECT_EQ(CL_SUCCESS, retVal);
+        return program;
+    }
+
+    // Every thread creates the given kernels, returns kernel infos seen by each thread in kernel order
+    std::vector<std::vector<const KernelInfo *>> createKernelsFromThreads(cl_program program, const std::vector<std::string> &kernelNames) {
+        std::atomic<bool> startCreating{false};
+        std::atomic<uint32_t> failedCreations{0u};
+        std::vector<std::vector<const KernelInfo *>> kernelInfos(threadsCount, std::vector<const KernelInfo *>(kernelNames.size(), nullptr));
+        std::vector<std::thread> threads;
+        for (uint32_t threadId = 0; threadId < threadsCount; threadId++) {
+            threads.emplace_back([&, threadId] {
+                while (!startCreating)
+                    ;
+                // threads walk the kernels from different starting points to race on different kernels
+                for (size_t i = 0; i < kernelNames.size(); i++) {
+                    auto kernelId = (i + threadId) % kernelNames.size();
+                    cl_int createRetVal = CL_SUCCESS;
+                    auto kernel = clCreateKernel(program, kernelNames[kernelId].c_str(), &createRetVal);
+                    if (createRetVal != CL_SUCCESS) {
+                        failedCreations++;
+                        continue;
+                    }
+                    kernelInfos[threadId][kernelId] = &castToObject<Kernel>(kernel)->getKernelInfo();
+                    clReleaseKernel(kernel);
+                }
+            });
+        }
+        startCreating = true;
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        EXPECT_EQ(0u, failedCreations);
+        return kernelInfos;
+    }
+
+    void *pBinary = nullptr;
+    size_t binarySize = 0u;
+};
+
+TEST_F(clCreateKernelMtTests, givenLazyKernelDecodingWhenKernelsAreCreatedFromManyThreadsThenEachKernelIsDecodedOnceAndMatchesEagerDecoding) {
+    DebugManagerStateRestore restore;
+
+    auto eagerProgram = loadProgram();
+    auto eagerProgramObj = castToObject<Program>(eagerProgram);
+
+    DebugManager.flags.EnableLazyKernelDecoding.set(true);
+    auto lazyProgram = loadProgram();
+    auto program = reinterpret_cast<MockProgram *>(castToObject<Program>(lazyProgram));
+    auto numKernels = program->getNumKernels();
+    ASSERT_LT(1u, numKernels);
+    ASSERT_EQ(numKernels, eagerProgramObj->getNumKernels());
+    size_t pendingDecodes = program->lazyKernelDecodesCount;
+    ASSERT_LT(0u, pendingDecodes);
+
+    // all threads race on a single kernel first, it is decoded once and the rest of the ISA is not uploaded
+    std::vector<std::string> usedKernelNames = {"simple_kernel_0"};
+    auto usedKernelInfos = createKernelsFromThreads(lazyProgram, usedKernelNames);
+    auto usedKernelInfo = usedKernelInfos[0][0];
+    ASSERT_NE(nullptr, usedKernelInfo);
+    for (auto &threadKernelInfos : usedKernelInfos) {
+        EXPECT_EQ(usedKernelInfo, threadKernelInfos[0]);
+    }
+    EXPECT_NE(nullptr, usedKernelInfo->getGraphicsAllocation());
+    EXPECT_GE(1u, pendingDecodes - program->lazyKernelDecodesCount);
+
+    // then all kernels are created from all threads at once
+    std::vector<std::string> kernelNames;
+    for (size_t i = 0; i < numKernels; i++) {
+        kernelNames.push_back(eagerProgramObj->getKernelInfo(i)->name);
+    }
+    auto kernelInfos = createKernelsFromThreads(lazyProgram, kernelNames);
+    EXPECT_EQ(0u, program->lazyKernelDecodesCount);
+
+    for (size_t kernelId = 0; kernelId < numKernels; kernelId++) {
+        auto kernelInfo = kernelInfos[0][kernelId];
+        ASSERT_NE(nullptr, kernelInfo) << kernelNames[kernelId];
+        for (auto &threadKernelInfos : kernelInfos) {
+            EXPECT_EQ(kernelInfo, threadKernelInfos[kernelId]) << kernelNames[kernelId];
+        }
+        auto eagerKernelInfo = eagerProgramObj->getKernelInfo(kernelNames[kernelId].c_str());
+        ASSERT_NE(nullptr, eagerKernelInfo);
+        EXPECT_NE(nullptr, kernelInfo->getGraphicsAllocation());
+        EXPECT_EQ(eagerKernelInfo->heapInfo.pKernelHeader->KernelHeapSize, kernelInfo->heapInfo.pKernelHeader->KernelHeapSize);
+        EXPECT_EQ(eagerKernelInfo->kernelArgInfo.size(), kernelInfo->kernelArgInfo.size());
+        EXPECT_EQ(eagerKernelInfo->getMaxSimdSize(), kernelInfo->getMaxSimdSize());
+    }
+
+    clReleaseProgram(lazyProgram);
+    clReleaseProgram(eagerProgram);
+}
+} // namespace ULT
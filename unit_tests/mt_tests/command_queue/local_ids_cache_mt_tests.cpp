@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "core/helpers/aligned_memory.h"
+#include "runtime/command_queue/local_id_gen.h"
+#include "runtime/command_queue/local_ids_cache.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+struct LocalIdsCacheMtTest : public ::testing::Test {
+    static constexpr uint32_t threadsCount = 4u;
+    static constexpr uint32_t dispatchesPerThread = 2000u;
+    static constexpr uint16_t simd = 16u;
+
+    void SetUp() override {
+        for (uint16_t lwsX : {16u, 32u, 64u, 128u, 256u, 512u}) {
+            localWorkSizes.push_back({{lwsX, 1, 1}});
+            localWorkSizes.push_back({{static_cast<uint16_t>(lwsX / 2), 2, 1}});
+        }
+        for (auto &localWorkSize : localWorkSizes) {
+            auto size = getLocalIdsSize(localWorkSize);
+            expectedLocalIds.push_back(allocateAlignedMemory(size, 32));
+            memset(expectedLocalIds.back().get(), 0, size);
+            generateLocalIDs(expectedLocalIds.back().get(), simd, localWorkSize, walkOrder, false);
+        }
+    }
+
+    static size_t getLocalIdsSize(const std::array<uint16_t, 3> &localWorkSize) {
+        return getThreadsPerWG(simd, localWorkSize[0] * localWorkSize[1] * localWorkSize[2]) * getPerThreadSizeLocalIDs(simd);
+    }
+
+    const std::array<uint8_t, 3> walkOrder = {{0, 1, 2}};
+    std::vector<std::array<uint16_t, 3>> localWorkSizes;
+    std::vector<std::unique_ptr<void, std::function<decltype(alignedFree)>>> expectedLocalIds;
+};
+
+TEST_F(LocalIdsCacheMtTest, givenCacheSmallerThanWorkingSetWhenLocalIdsAreSetFromManyThreadsThenEveryDispatchGetsCorrectLocalIds) {
+    // fewer entries than dispatch layouts, so lookups race with evictions of the same entries
+    LocalIdsCache cache(localWorkSizes.size() / 2);
+
+    std::atomic<bool> startDispatches{false};
+    std::atomic<uint32_t> wrongLocalIds{0u};
+    std::vector<std::thread> threads;
+    for (uint32_t threadId = 0; threadId < threadsCount; threadId++) {
+        threads.emplace_back([&, threadId] {
+            auto destination = allocateAlignedMemory(getLocalIdsSize({{512, 1, 1}}), 32);
+            uint32_t layoutId = threadId;
+            while (!startDispatches)
+                ;
+            for (uint32_t dispatch = 0; dispatch < dispatchesPerThread; dispatch++) {
+                layoutId = (layoutId * 1103515245u + 12345u) % static_cast<uint32_t>(localWorkSizes.size());
+                auto &localWorkSize = localWorkSizes[layoutId];
+                auto size = getLocalIdsSize(localWorkSize);
+                memset(destination.get(), 0xff, size);
+                cache.setLocalIds(destination.get(), size, simd, localWorkSize, walkOrder, false);
+                if (memcmp(expectedLocalIds[layoutId].get(), destination.get(), size) != 0) {
+                    wrongLocalIds++;
+                }
+            }
+        });
+    }
+    startDispatches = true;
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(0u, wrongLocalIds);
+    EXPECT_EQ(threadsCount * dispatchesPerThread, cache.getHits() + cache.getMisses());
+    EXPECT_EQ(cache.getMaxEntries(), cache.getNumEntries());
+}
+
+TEST_F(LocalIdsCacheMtTest, givenSingleDispatchLayoutWhenLocalIdsAreSetFromManyThreadsThenOneEntryIsCachedAndLaterDispatchesHit) {
+    LocalIdsCache cache(LocalIdsCache::defaultMaxEntries);
+    auto &localWorkSize = localWorkSizes.back();
+    auto size = getLocalIdsSize(localWorkSize);
+
+    std::atomic<bool> startDispatches{false};
+    std::atomic<uint32_t> wrongLocalIds{0u};
+    std::vector<std::thread> threads;
+    for (uint32_t threadId = 0; threadId < threadsCount; threadId++) {
+        threads.emplace_back([&] {
+            auto destination = allocateAlignedMemory(size, 32);
+            while (!startDispatches)
+                ;
+            for (uint32_t dispatch = 0; dispatch < dispatchesPerThread; dispatch++) {
+                cache.setLocalIds(destination.get(), size, simd, localWorkSize, walkOrder, false);
+                if (memcmp(expectedLocalIds.back().get(), destination.get(), size) != 0) {
+                    wrongLocalIds++;
+                }
+            }
+        });
+    }
+    startDispatches = true;
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(0u, wrongLocalIds);
+    EXPECT_EQ(1u, cache.getNumEntries());
+    // threads racing on the first dispatch may all miss, every later dispatch hits
+    EXPECT_LE(1u, cache.getMisses());
+    EXPECT_GE(static_cast<uint64_t>(threadsCount), cache.getMisses());
+    EXPECT_EQ(threadsCount * dispatchesPerThread, cache.getHits() + cache.getMisses());
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "unit_tests/mocks/mock_execution_environment.h"
+#include "unit_tests/mocks/mock_memory_manager.h"
+#include "unit_tests/mocks/mock_svm_manager.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+struct SvmLookupMtTest : public ::testing::Test {
+    static constexpr uint32_t readersCount = 4u;
+    static constexpr uint32_t allocationsCount = 1024u;
+    static constexpr uint32_t lookupsPerReader = 50000u;
+
+    SvmLookupMtTest() : executionEnvironment(*platformDevices) {}
+
+    void SetUp() override {
+        if (!executionEnvironment.getHardwareInfo()->capabilityTable.ftrSvm) {
+            GTEST_SKIP();
+        }
+        memoryManager = std::make_unique<MockMemoryManager>(false, false, executionEnvironment);
+        svmManager = std::make_unique<MockSVMAllocsManager>(memoryManager.get());
+        for (uint32_t i = 0; i < allocationsCount; i++) {
+            auto ptr = svmManager->createSVMAlloc(2 * MemoryConstants::pageSize, {});
+            ASSERT_NE(nullptr, ptr);
+            allocations.push_back(ptr);
+        }
+    }
+
+    void TearDown() override {
+        for (auto ptr : allocations) {
+            svmManager->freeSVMAlloc(ptr);
+        }
+    }
+
+    MockExecutionEnvironment executionEnvironment;
+    std::unique_ptr<MockMemoryManager> memoryManager;
+    std::unique_ptr<MockSVMAllocsManager> svmManager;
+    std::vector<void *> allocations;
+};
+
+TEST_F(SvmLookupMtTest, givenConcurrentAllocationsAndFreesWhenLookingUpSvmPointersFromManyThreadsThenCorrectAllocationsAreFound) {
+    std::atomic<bool> readersDone{false};
+    std::atomic<uint32_t> wrongLookups{0u};
+    std::atomic<uint32_t> wrongWriterLookups{0u};
+
+    std::thread writer([&] {
+        while (!readersDone) {
+            auto ptr = svmManager->createSVMAlloc(MemoryConstants::pageSize, {});
+            auto svmData = svmManager->getSVMAlloc(ptrOffset(ptr, MemoryConstants::pageSize - 1));
+            if (svmData == nullptr || svmData->gpuAllocation->getGpuAddress() != castToUint64(ptr)) {
+                wrongWriterLookups++;
+            }
+            svmManager->freeSVMAlloc(ptr);
+            if (svmManager->getSVMAlloc(ptr) != nullptr) {
+                wrongWriterLookups++;
+            }
+        }
+    });
+
+    auto start = std::chrono::high_resolution_clock::now();
+    std::vector<std::thread> readers;
+    for (uint32_t readerId = 0; readerId < readersCount; readerId++) {
+        readers.emplace_back([&, readerId] {
+            uint32_t index = readerId;
+            for (uint32_t i = 0; i < lookupsPerReader; i++) {
+                index = (index * 1103515245u + 12345u) % allocationsCount;
+                auto base = allocations[index];
+                auto svmData = svmManager->getSVMAlloc(ptrOffset(base, (i * 64) % (2 * MemoryConstants::pageSize)));
+                if (svmData == nullptr || svmData->gpuAllocation->getGpuAddress() != castToUint64(base)) {
+                    wrongLookups++;
+                }
+            }
+        });
+    }
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    readersDone = true;
+    writer.join();
+
+    EXPECT_EQ(0u, wrongLookups);
+    EXPECT_EQ(0u, wrongWriterLookups);
+    EXPECT_EQ(allocationsCount, svmManager->SVMAllocs.getNumAllocs());
+
+    auto lookupTimeUs = std::max(1ll, static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count()));
+    RecordProperty("lookupTimeUs", static_cast<int>(lookupTimeUs));
+    RecordProperty("lookupsPerMs", static_cast<int>(1000ll * readersCount * lookupsPerReader / lookupTimeUs));
+}
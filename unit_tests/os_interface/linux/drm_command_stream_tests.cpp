@@ -596,6 +596,21 @@ HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, GivenTwoAllocationsWhenBackingS
     mm->freeGraphicsMemory(allocation2);
 }
 
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenBufferObjectMadeResidentByPreviousCsrWhenNewCsrMakesItResidentThenItIsAddedToResidency) {
+    auto allocation = static_cast<DrmAllocation *>(mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize}));
+    makeResidentBufferObjects<FamilyType>(allocation);
+    EXPECT_EQ(1u, getResidencyVector<FamilyType>().size());
+
+    auto newCsr = new TestedDrmCommandStreamReceiver<FamilyType>(*executionEnvironment);
+    device->resetCommandStreamReceiver(newCsr);
+    csr = newCsr;
+    EXPECT_EQ(0u, getResidencyVector<FamilyType>().size());
+
+    makeResidentBufferObjects<FamilyType>(allocation);
+    EXPECT_EQ(1u, getResidencyVector<FamilyType>().size());
+    mm->freeGraphicsMemory(allocation);
+}
+
 HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenCommandStreamWithDuplicatesWhenItIsFlushedWithGemCloseWorkerInactiveModeThenCsIsNotNulled) {
     auto commandBuffer = static_cast<DrmAllocation *>(mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize}));
     auto dummyAllocation = static_cast<DrmAllocation *>(mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize}));
@@ -1107,6 +1122,24 @@ HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, makeResidentSizeZero) {
     EXPECT_FALSE(isResident<FamilyType>(buffer.get()));
 }
 
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenZeroSizeAllocationWhenAllocationsAreMadeResidentInBulkThenZeroSizeAllocationIsSkipped) {
+    std::unique_ptr<BufferObject> emptyBuffer(this->createBO(0));
+    DrmAllocation emptyAllocation(GraphicsAllocation::AllocationType::UNKNOWN, emptyBuffer.get(), nullptr, emptyBuffer->peekSize(), MemoryPool::MemoryNull, 1u);
+    auto allocation = static_cast<DrmAllocation *>(mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize}));
+    ASSERT_NE(nullptr, allocation);
+
+    std::vector<GraphicsAllocation *> allocations = {&emptyAllocation, allocation};
+    csr->makeAllocationsResident(allocations);
+    csr->processResidency(csr->getResidencyAllocations());
+
+    EXPECT_EQ(1u, csr->getResidencyAllocations().size());
+    EXPECT_FALSE(isResident<FamilyType>(emptyBuffer.get()));
+    EXPECT_TRUE(isResident<FamilyType>(allocation->getBO()));
+
+    csr->makeNonResident(*allocation);
+    mm->freeGraphicsMemory(allocation);
+}
+
 HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, Flush) {
     auto &cs = csr->getCS();
     auto commandBuffer = static_cast<DrmAllocation *>(cs.getGraphicsAllocation());
@@ -1382,3 +1415,64 @@ HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenAllocationWithSingleBuffer
 
     mm->freeGraphicsMemory(allocation);
 }
+
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenBufferObjectMadeResidentTwiceWhenMakeResidentBufferObjectsIsCalledThenBufferObjectIsAddedOnlyOnce) {
+    auto size = 1024u;
+    auto bo = this->createBO(size);
+    BufferObjects bos{{bo}};
+    auto allocation = new DrmAllocation(GraphicsAllocation::AllocationType::UNKNOWN, bos, nullptr, 0u, size, MemoryPool::LocalMemory);
+
+    makeResidentBufferObjects<FamilyType>(allocation);
+    makeResidentBufferObjects<FamilyType>(allocation);
+    EXPECT_EQ(1u, getResidencyVector<FamilyType>().size());
+
+    mm->freeGraphicsMemory(allocation);
+}
+
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenResidencyClearedByMakeNonResidentWhenBufferObjectIsMadeResidentAgainThenItIsAddedToResidency) {
+    auto allocation = static_cast<DrmAllocation *>(mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize}));
+    ASSERT_NE(nullptr, allocation);
+
+    csr->makeResident(*allocation);
+    csr->processResidency(csr->getResidencyAllocations());
+    EXPECT_EQ(1u, getResidencyVector<FamilyType>().size());
+
+    csr->makeNonResident(*allocation);
+    EXPECT_EQ(0u, getResidencyVector<FamilyType>().size());
+
+    csr->makeResident(*allocation);
+    csr->processResidency(csr->getResidencyAllocations());
+    EXPECT_TRUE(isResident<FamilyType>(allocation->getBO()));
+    EXPECT_EQ(1u, getResidencyVector<FamilyType>().size());
+
+    csr->makeNonResident(*allocation);
+    mm->freeGraphicsMemory(allocation);
+    csr->getResidencyAllocations().clear();
+}
+
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenManyAllocationsMadeResidentRepeatedlyWhenResidencyIsClearedBetweenSubmissionsThenEachBufferObjectIsAddedOncePerSubmission) {
+    const size_t allocationCount = 512;
+    std::vector<DrmAllocation *> allocations;
+    for (size_t i = 0; i < allocationCount; i++) {
+        allocations.push_back(static_cast<DrmAllocation *>(mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize})));
+        ASSERT_NE(nullptr, allocations.back());
+    }
+
+    for (int submission = 0; submission < 3; submission++) {
+        for (auto allocation : allocations) {
+            makeResidentBufferObjects<FamilyType>(allocation);
+            makeResidentBufferObjects<FamilyType>(allocation);
+        }
+        auto &residency = getResidencyVector<FamilyType>();
+        ASSERT_EQ(allocationCount, residency.size());
+        for (size_t i = 0; i < allocationCount; i++) {
+            EXPECT_EQ(allocations[i]->getBO(), residency[i]);
+        }
+        static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr)->clearResidency();
+        EXPECT_EQ(0u, residency.size());
+    }
+
+    for (auto allocation : allocations) {
+        mm->freeGraphicsMemory(allocation);
+    }
+}
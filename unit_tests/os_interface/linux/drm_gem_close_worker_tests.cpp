@@ -6,6 +6,7 @@
  */
 
 #include "core/helpers/aligned_memory.h"
+#include "core/unit_tests/helpers/debug_manager_state_restore.h"
 #include "runtime/command_stream/device_command_stream.h"
 #include "runtime/execution_environment/execution_environment.h"
 #include "runtime/mem_obj/buffer.h"
@@ -190,3 +191,52 @@ TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerWhenCloseIsCalledMultipleTi
     worker->close(true);
     EXPECT_EQ(nullptr, worker->thread);
 }
+
+TEST_F(DrmGemCloseWorkerTests, givenBatchedGemCloseWhenBufferObjectsArePushedThenAllAreClosedWithWaitForEach) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableBatchedGemClose.set(true);
+    DebugManager.flags.GemCloseBatchSize.set(4);
+    const int boCount = 10;
+    this->drmMock->gem_close_expected = boCount;
+
+    auto worker = new DrmGemCloseWorker(*mm);
+    for (int i = 0; i < boCount; i++) {
+        worker->push(new BufferObject(this->drmMock, i + 1));
+    }
+    worker->close(true);
+
+    EXPECT_TRUE(worker->isEmpty());
+    auto metrics = worker->getMetrics();
+    EXPECT_EQ(static_cast<uint64_t>(boCount), metrics.pushed);
+    EXPECT_EQ(static_cast<uint64_t>(boCount), metrics.closed);
+    EXPECT_EQ(static_cast<uint64_t>(boCount), metrics.blockingWaits);
+    EXPECT_LE(3u, metrics.batches);
+
+    delete worker;
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenBatchedGemCloseWhenWorkerIsStalledThenPendingBufferObjectsAreReportedAsBackpressure) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableBatchedGemClose.set(true);
+    DebugManager.flags.GemCloseBatchSize.set(2);
+    const int boCount = 10;
+    this->drmMock->gem_close_expected = boCount;
+
+    auto worker = new DrmGemCloseWorker(*mm);
+    {
+        //worker cannot finish any ioctl while mutex is held
+        std::lock_guard<std::mutex> lock(this->drmMock->mutex);
+        for (int i = 0; i < boCount; i++) {
+            worker->push(new BufferObject(this->drmMock, i + 1));
+        }
+        EXPECT_FALSE(worker->isEmpty());
+    }
+    worker->close(true);
+
+    auto metrics = worker->getMetrics();
+    EXPECT_EQ(static_cast<uint64_t>(boCount), metrics.maxPending);
+    EXPECT_EQ(2u, metrics.pushesOverHighWatermark);
+    EXPECT_TRUE(worker->isEmpty());
+
+    delete worker;
+}
@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "core/unit_tests/helpers/debug_manager_state_restore.h"
+#include "runtime/tbx/tbx_sockets_imp.h"
+#include "unit_tests/os_interface/linux/tbx_stub_server.h"
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace NEO;
+
+struct MockTbxSocketsImp : public TbxSocketsImp {
+    using TbxSocketsImp::pipelinedWrites;
+    using TbxSocketsImp::TbxSocketsImp;
+
+    bool sendWriteData(const void *buffer, size_t sizeInBytes) override {
+        sendCalled++;
+        return TbxSocketsImp::sendWriteData(buffer, sizeInBytes);
+    }
+
+    bool sendWriteMessage(const void *header, size_t headerSize, const void *data, size_t dataSize) override {
+        sendCalled++;
+        return TbxSocketsImp::sendWriteMessage(header, headerSize, data, dataSize);
+    }
+
+    uint32_t sendCalled = 0u;
+};
+
+struct TbxSocketsImpTest : public ::testing::Test {
+    void initSockets(int32_t pipelinedWriteBufferSize) {
+        DebugManager.flags.TbxPipelinedWriteBufferSize.set(pipelinedWriteBufferSize);
+        ASSERT_TRUE(sockets.init("127.0.0.1", server.getPort()));
+    }
+
+    DebugManagerStateRestore restorer;
+    TbxStubServer server;
+    std::stringstream errors;
+    MockTbxSocketsImp sockets{errors};
+    const uint64_t address = 0x1234567000u;
+};
+
+TEST_F(TbxSocketsImpTest, givenTbxServerWhenWritingAndReadingThenWrittenValuesAreReadBack) {
+    initSockets(-1);
+    std::vector<char> data(3000, 7);
+    uint32_t mmioValue = 0;
+    std::vector<char> readData(data.size());
+
+    EXPECT_TRUE(sockets.writeMemory(address, data.data(), data.size(), 0));
+    EXPECT_TRUE(sockets.writeMMIO(0x2000, 0xabcd));
+    EXPECT_TRUE(sockets.pipelinedWrites.empty());
+
+    EXPECT_TRUE(sockets.readMMIO(0x2000, &mmioValue));
+    EXPECT_EQ(0xabcdu, mmioValue);
+    EXPECT_TRUE(sockets.readMemory(address, readData.data(), readData.size()));
+    EXPECT_EQ(data, readData);
+    sockets.close();
+}
+
+TEST_F(TbxSocketsImpTest, givenPipelinedWritesWhenWritingThenMessagesAreSentInOrderBeforeNextRead) {
+    initSockets(64);
+    std::vector<char> data(3000, 7);
+    uint32_t mmioValue = 0;
+    std::vector<char> readData(data.size());
+
+    EXPECT_TRUE(sockets.writeMemory(address, data.data(), data.size(), 0));
+    EXPECT_TRUE(sockets.writeGTT(0x80, 0x1122334455667788u));
+    EXPECT_TRUE(sockets.writeMMIO(0x2000, 0xabcd));
+    EXPECT_FALSE(sockets.pipelinedWrites.empty());
+
+    EXPECT_TRUE(sockets.readMMIO(0x2000, &mmioValue));
+    EXPECT_TRUE(sockets.pipelinedWrites.empty());
+    EXPECT_EQ(0xabcdu, mmioValue);
+    EXPECT_TRUE(sockets.readMemory(address, readData.data(), readData.size()));
+    EXPECT_EQ(data, readData);
+    sockets.close();
+
+    server.waitForDisconnect();
+    EXPECT_EQ(0x1122334455667788u, server.gtt[0x80 / sizeof(uint64_t)]);
+    for (size_t i = 1; i < server.receivedTransIds.size(); i++) {
+        EXPECT_EQ(server.receivedTransIds[i - 1] + 1, server.receivedTransIds[i]);
+    }
+}
+
+TEST_F(TbxSocketsImpTest, givenPipelinedWritesWhenWriteDoesNotFitIntoBufferThenPendingWritesAndLargeWriteAreSentImmediately) {
+    initSockets(1);
+    uint64_t pageTableEntry = 0x1000u | 3;
+    std::vector<char> data(8192, 9);
+    std::vector<char> readData(data.size());
+
+    EXPECT_TRUE(sockets.writeMemory(address, &pageTableEntry, sizeof(pageTableEntry), 0));
+    EXPECT_FALSE(sockets.pipelinedWrites.empty());
+
+    EXPECT_TRUE(sockets.writeMemory(address + sizeof(pageTableEntry), data.data(), data.size(), 0));
+    EXPECT_TRUE(sockets.pipelinedWrites.empty());
+
+    uint64_t readEntry = 0;
+    EXPECT_TRUE(sockets.readMemory(address, &readEntry, sizeof(readEntry)));
+    EXPECT_EQ(pageTableEntry, readEntry);
+    EXPECT_TRUE(sockets.readMemory(address + sizeof(pageTableEntry), readData.data(), readData.size()));
+    EXPECT_EQ(data, readData);
+    sockets.close();
+}
+
+TEST_F(TbxSocketsImpTest, givenPendingPipelinedWritesWhenClosingThenWritesAreSent) {
+    initSockets(64);
+    uint64_t pageTableEntry = 0x1000u | 3;
+
+    EXPECT_TRUE(sockets.writeMemory(address, &pageTableEntry, sizeof(pageTableEntry), 0));
+    EXPECT_TRUE(sockets.writeMMIO(0x2000, 0xabcd));
+    sockets.close();
+
+    server.waitForDisconnect();
+    EXPECT_EQ(0xabcdu, server.mmio[0x2000]);
+    uint64_t writtenEntry = 0;
+    server.copyMemory(address, &writtenEntry, sizeof(writtenEntry));
+    EXPECT_EQ(pageTableEntry, writtenEntry);
+}
+
+TEST_F(TbxSocketsImpTest, givenPendingPipelinedWritesWhenFlushingThenServerReceivesThemWithoutRead) {
+    initSockets(64);
+    server.waitForMessages(1);
+
+    EXPECT_TRUE(sockets.writeMMIO(0x2230, 0x1234));
+    EXPECT_FALSE(sockets.pipelinedWrites.empty());
+
+    EXPECT_TRUE(sockets.flush());
+    EXPECT_TRUE(sockets.pipelinedWrites.empty());
+
+    server.waitForMessages(2);
+    EXPECT_EQ(0x1234u, server.mmio[0x2230]);
+    sockets.close();
+}
+
+struct TbxSocketsImpThroughputTest : public ::testing::Test {
+    // writes page table entries the way PageTable::pageWalk does and reads the last one back from a loopback server
+    uint32_t writePageTableEntries(int32_t pipelinedWriteBufferSize, long long &writesUs, long long &elapsedUs) {
+        DebugManagerStateRestore restorer;
+        DebugManager.flags.TbxPipelinedWriteBufferSize.set(pipelinedWriteBufferSize);
+        TbxStubServer server;
+        std::stringstream errors;
+        MockTbxSocketsImp sockets{errors};
+        EXPECT_TRUE(sockets.init("127.0.0.1", server.getPort()));
+        sockets.sendCalled = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        uint64_t entry = 0;
+        for (uint64_t i = 0; i < entriesCount; i++) {
+            entry = (i << 12) | 3;
+            sockets.writeMemory(i * sizeof(entry), &entry, sizeof(entry), 0);
+        }
+        writesUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+        uint64_t readEntry = 0;
+        EXPECT_TRUE(sockets.readMemory((entriesCount - 1) * sizeof(entry), &readEntry, sizeof(readEntry)));
+        elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+        EXPECT_EQ(entry, readEntry);
+        sockets.close();
+        return sockets.sendCalled;
+    }
+
+    const uint64_t entriesCount = 4096;
+};
+
+TEST_F(TbxSocketsImpThroughputTest, givenPipelinedWritesWhenWritingPageTableEntriesThenSendsAreBatchedIntoFrames) {
+    long long writesUsImmediate = 0;
+    long long writesUsPipelined = 0;
+    long long elapsedUsImmediate = 0;
+    long long elapsedUsPipelined = 0;
+    auto sendsImmediate = writePageTableEntries(-1, writesUsImmediate, elapsedUsImmediate);
+    auto sendsPipelined = writePageTableEntries(64, writesUsPipelined, elapsedUsPipelined);
+
+    // every write message plus the read request
+    EXPECT_EQ(entriesCount + 1, sendsImmediate);
+    // 32 bytes per message, 2 frames of 64KB and the read request
+    EXPECT_EQ(3u, sendsPipelined);
+
+    RecordProperty("entriesCount", std::to_string(entriesCount));
+    RecordProperty("immediateWritesUs", std::to_string(writesUsImmediate));
+    RecordProperty("immediateWritesAndReadUs", std::to_string(elapsedUsImmediate));
+    RecordProperty("pipelinedWritesUs", std::to_string(writesUsPipelined));
+    RecordProperty("pipelinedWritesAndReadUs", std::to_string(elapsedUsPipelined));
+}
@@ -0,0 +1,201 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/tbx/tbx_proto.h"
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <array>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <unordered_map>
+#include <vector>
+
+namespace NEO {
+
+// Minimal TBX server on the loopback interface, it keeps written memory, MMIO and GTT values and answers reads.
+// Serves a single connection, recorded state may be inspected after waitForMessages or waitForDisconnect.
+class TbxStubServer {
+  public:
+    TbxStubServer() {
+        listenSocket = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = 0;
+        socklen_t addressSize = sizeof(address);
+        ::bind(listenSocket, reinterpret_cast<sockaddr *>(&address), addressSize);
+        ::listen(listenSocket, 1);
+        ::getsockname(listenSocket, reinterpret_cast<sockaddr *>(&address), &addressSize);
+        port = ntohs(address.sin_port);
+        serverThread = std::thread([this] { serve(); });
+    }
+
+    ~TbxStubServer() {
+        ::shutdown(listenSocket, SHUT_RDWR);
+        waitForDisconnect();
+        ::close(listenSocket);
+    }
+
+    uint16_t getPort() const { return port; }
+
+    void waitForMessages(size_t count) {
+        std::unique_lock<std::mutex> lock(mtx);
+        messageReceived.wait(lock, [&] { return receivedTransIds.size() >= count || disconnected; });
+    }
+
+    void waitForDisconnect() {
+        if (serverThread.joinable()) {
+            serverThread.join();
+        }
+    }
+
+    void copyMemory(uint64_t address, void *data, size_t size) {
+        for (size_t i = 0; i < size; i++) {
+            static_cast<char *>(data)[i] = memoryPages[(address + i) / pageSize][(address + i) % pageSize];
+        }
+    }
+
+    static constexpr size_t pageSize = 4096;
+    std::unordered_map<uint64_t, std::array<char, pageSize>> memoryPages;
+    std::unordered_map<uint32_t, uint32_t> mmio;
+    std::unordered_map<uint32_t, uint64_t> gtt;
+    std::vector<uint32_t> receivedTransIds;
+
+  protected:
+    void serve() {
+        auto connection = ::accept(listenSocket, nullptr, nullptr);
+        if (connection < 0) {
+            std::unique_lock<std::mutex> lock(mtx);
+            disconnected = true;
+            messageReceived.notify_all();
+            return;
+        }
+
+        HAS_MSG msg;
+        while (receive(connection, &msg.hdr, sizeof(msg.hdr)) &&
+               msg.hdr.size <= sizeof(msg.u) &&
+               receive(connection, &msg.u, msg.hdr.size)) {
+            if (!handleMessage(connection, msg)) {
+                break;
+            }
+            std::unique_lock<std::mutex> lock(mtx);
+            receivedTransIds.push_back(msg.hdr.trans_id);
+            messageReceived.notify_all();
+        }
+        ::close(connection);
+
+        std::unique_lock<std::mutex> lock(mtx);
+        disconnected = true;
+        messageReceived.notify_all();
+    }
+
+    bool handleMessage(int connection, const HAS_MSG &msg) {
+        switch (msg.hdr.msg_type) {
+        case HAS_WRITE_DATA_REQ_TYPE: {
+            auto address = getAddress(msg.u.write_req.address, msg.u.write_req.address_h);
+            std::vector<char> data(msg.u.write_req.size);
+            if (!receive(connection, data.data(), data.size())) {
+                return false;
+            }
+            for (size_t offset = 0; offset < data.size();) {
+                auto pageOffset = (address + offset) % pageSize;
+                auto chunkSize = std::min(pageSize - pageOffset, data.size() - offset);
+                memcpy(memoryPages[(address + offset) / pageSize].data() + pageOffset, data.data() + offset, chunkSize);
+                offset += chunkSize;
+            }
+            return true;
+        }
+        case HAS_READ_DATA_REQ_TYPE: {
+            auto address = getAddress(msg.u.read_req.address, msg.u.read_req.address_h);
+            HAS_MSG resp;
+            memset(&resp, 0, sizeof(resp));
+            resp.hdr.msg_type = HAS_READ_DATA_RES_TYPE;
+            resp.hdr.trans_id = msg.hdr.trans_id;
+            resp.hdr.size = sizeof(HAS_READ_DATA_RES);
+            resp.u.read_res.address = msg.u.read_req.address;
+            resp.u.read_res.address_h = msg.u.read_req.address_h;
+            resp.u.read_res.size = msg.u.read_req.size;
+            std::vector<char> data(msg.u.read_req.size);
+            copyMemory(address, data.data(), data.size());
+            return send(connection, &resp, sizeof(HAS_HDR) + sizeof(HAS_READ_DATA_RES)) &&
+                   send(connection, data.data(), data.size());
+        }
+        case HAS_MMIO_REQ_TYPE: {
+            if (msg.u.mmio_req.write) {
+                mmio[msg.u.mmio_req.offset] = msg.u.mmio_req.data;
+                return true;
+            }
+            HAS_MSG resp;
+            memset(&resp, 0, sizeof(resp));
+            resp.hdr.msg_type = HAS_MMIO_RES_TYPE;
+            resp.hdr.trans_id = msg.hdr.trans_id;
+            resp.hdr.size = sizeof(HAS_MMIO_RES);
+            resp.u.mmio_res.data = mmio[msg.u.mmio_req.offset];
+            return send(connection, &resp, sizeof(HAS_HDR) + sizeof(HAS_MMIO_RES));
+        }
+        case HAS_GTT_REQ_TYPE:
+            gtt[msg.u.gtt64_req.offset] = (static_cast<uint64_t>(msg.u.gtt64_req.data_h) << 32) | msg.u.gtt64_req.data;
+            return true;
+        default:
+            return true;
+        }
+    }
+
+    static uint64_t getAddress(uint32_t address, uint32_t addressHigh) {
+        return (static_cast<uint64_t>(addressHigh) << 32) | address;
+    }
+
+    bool receive(int connection, void *buffer, size_t size) {
+        size_t totalRecv = 0;
+        while (totalRecv < size) {
+            if (receivedBytesConsumed == receivedBytes.size()) {
+                receivedBytes.resize(receiveBufferSize);
+                auto bytesRecv = ::recv(connection, receivedBytes.data(), receivedBytes.size(), 0);
+                if (bytesRecv <= 0) {
+                    return false;
+                }
+                receivedBytes.resize(bytesRecv);
+                receivedBytesConsumed = 0;
+            }
+            auto chunkSize = std::min(size - totalRecv, receivedBytes.size() - receivedBytesConsumed);
+            memcpy(static_cast<char *>(buffer) + totalRecv, receivedBytes.data() + receivedBytesConsumed, chunkSize);
+            receivedBytesConsumed += chunkSize;
+            totalRecv += chunkSize;
+        }
+        return true;
+    }
+
+    static bool send(int connection, const void *buffer, size_t size) {
+        size_t totalSent = 0;
+        while (totalSent < size) {
+            auto bytesSent = ::send(connection, static_cast<const char *>(buffer) + totalSent, size - totalSent, MSG_NOSIGNAL);
+            if (bytesSent <= 0) {
+                return false;
+            }
+            totalSent += bytesSent;
+        }
+        return true;
+    }
+
+    static constexpr size_t receiveBufferSize = 64 * 1024;
+    std::vector<char> receivedBytes;
+    size_t receivedBytesConsumed = 0;
+    int listenSocket = -1;
+    uint16_t port = 0;
+    std::thread serverThread;
+    std::mutex mtx;
+    std::condition_variable messageReceived;
+    bool disconnected = false;
+};
+} // namespace NEO
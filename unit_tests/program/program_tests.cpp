@@ -16,6 +16,7 @@
 #include "elf/reader.h"
 #include "runtime/command_stream/command_stream_receiver_hw.h"
 #include "runtime/compiler_interface/compiler_options.h"
+#include "runtime/compiler_interface/compiler_thread_pool.h"
 #include "runtime/gmm_helper/gmm_helper.h"
 #include "runtime/helpers/hardware_commands_helper.h"
 #include "runtime/helpers/hash.h"
@@ -738,6 +739,13 @@ TEST_P(ProgramFromSourceTest, CreateWithSource_Build) {
     pMockProgram->SetBuildStatus(CL_BUILD_IN_PROGRESS);
     retVal = pProgram->build(0, nullptr, nullptr, nullptr, nullptr, false);
     EXPECT_EQ(CL_INVALID_OPERATION, retVal);
+    EXPECT_EQ(CL_BUILD_IN_PROGRESS, pProgram->getBuildStatus());
+
+    // fail build - invalid parameters while another build is in progress do not change its status
+    retVal = pProgram->build(0, &deviceList, nullptr, notifyFunc, &data[0], false);
+    EXPECT_EQ(CL_INVALID_OPERATION, retVal);
+    EXPECT_EQ(CL_BUILD_IN_PROGRESS, pProgram->getBuildStatus());
+    EXPECT_EQ(0, data[0]);
     pMockProgram->SetBuildStatus(CL_BUILD_NONE);
 
     // fail build - CompilerInterface cannot be obtained
@@ -822,6 +830,50 @@ TEST_P(ProgramFromSourceTest, CreateWithSource_Build) {
     delete[](char *) pSourceBuffer;
 }
 
+TEST_P(ProgramFromSourceTest, givenCompilerThreadPoolWhenProgramIsBuiltWithCallbackThenBuildCompletesOnWorkerAndCallbackIsCalled) {
+    KernelBinaryHelper kbHelper(BinaryFileName, true);
+
+    char data[4] = {0};
+    cl_device_id usedDevice = pPlatform->getDevice(0);
+
+    CreateProgramWithSource<MockProgram>(
+        pContext,
+        &usedDevice,
+        SourceFileName);
+
+    auto compilerThreadPool = new CompilerThreadPool(2u);
+    auto oldThreadPool = platform()->setCompilerThreadPool(std::unique_ptr<CompilerThreadPool>(compilerThreadPool));
+
+    retVal = pProgram->build(0, nullptr, nullptr, notifyFunc, &data[0], false);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    compilerThreadPool->waitForIdle();
+    EXPECT_EQ('a', data[0]);
+    EXPECT_EQ(CL_BUILD_SUCCESS, pProgram->getBuildStatus());
+    EXPECT_NE(0u, pProgram->getNumKernels());
+
+    platform()->setCompilerThreadPool(std::move(oldThreadPool));
+}
+
+TEST_P(ProgramFromSourceTest, givenCompilerThreadPoolWhenProgramIsBuiltWithoutCallbackThenBuildCompletesBeforeReturning) {
+    KernelBinaryHelper kbHelper(BinaryFileName, true);
+
+    cl_device_id usedDevice = pPlatform->getDevice(0);
+
+    CreateProgramWithSource<MockProgram>(
+        pContext,
+        &usedDevice,
+        SourceFileName);
+
+    auto oldThreadPool = platform()->setCompilerThreadPool(std::make_unique<CompilerThreadPool>(2u));
+
+    retVal = pProgram->build(0, nullptr, nullptr, nullptr, nullptr, false);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(CL_BUILD_SUCCESS, pProgram->getBuildStatus());
+
+    platform()->setCompilerThreadPool(std::move(oldThreadPool));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Program::Build (duplicate)
 ////////////////////////////////////////////////////////////////////////////////
@@ -1472,6 +1524,109 @@ TEST_F(PatchTokenTests, DataParamLWS) {
     ASSERT_NE(static_cast<uint32_t>(-1), pKernelInfo->workloadInfo.localWorkSizeOffsets2[2]);
 }
 
+TEST_F(PatchTokenTests, givenCompilerThreadPoolWhenProgramWithMultipleKernelsIsBuiltThenKernelsAreDecodedInBinaryOrder) {
+    cl_device_id device = pDevice;
+
+    CreateProgramFromBinary<Program>(pContext, &device, "simple_kernels");
+    ASSERT_NE(nullptr, pProgram);
+
+    auto oldThreadPool = platform()->setCompilerThreadPool(std::make_unique<CompilerThreadPool>(4u));
+    retVal = pProgram->build(1, &device, nullptr, nullptr, nullptr, false);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    ASSERT_LT(1u, pProgram->getNumKernels());
+
+    std::vector<std::string> kernelNamesDecodedInParallel;
+    for (size_t i = 0; i < pProgram->getNumKernels(); i++) {
+        EXPECT_NE(nullptr, pProgram->getKernelInfo(i)->getGraphicsAllocation());
+        kernelNamesDecodedInParallel.push_back(pProgram->getKernelInfo(i)->name);
+    }
+
+    platform()->setCompilerThreadPool(std::move(oldThreadPool));
+    retVal = pProgram->processGenBinary();
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    ASSERT_EQ(kernelNamesDecodedInParallel.size(), pProgram->getNumKernels());
+
+    for (size_t i = 0; i < pProgram->getNumKernels(); i++) {
+        EXPECT_EQ(kernelNamesDecodedInParallel[i], pProgram->getKernelInfo(i)->name);
+    }
+}
+
+TEST_F(PatchTokenTests, givenLazyKernelDecodingWhenProgramIsBuiltThenKernelIsDecodedOnFirstUse) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableLazyKernelDecoding.set(true);
+    cl_device_id device = pDevice;
+
+    CreateProgramFromBinary<MockProgram>(pContext, &device, "simple_kernels");
+    ASSERT_NE(nullptr, pProgram);
+    auto mockProgram = static_cast<MockProgram *>(pProgram);
+
+    retVal = pProgram->build(1, &device, nullptr, nullptr, nullptr, false);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    auto &kernelInfos = mockProgram->getKernelInfoArray();
+    ASSERT_LT(1u, kernelInfos.size());
+    EXPECT_EQ(kernelInfos.size(), mockProgram->lazyKernelDecodesCount);
+    for (auto kernelInfo : kernelInfos) {
+        EXPECT_FALSE(kernelInfo->name.empty());
+        EXPECT_EQ(nullptr, kernelInfo->patchInfo.executionEnvironment);
+        EXPECT_EQ(nullptr, kernelInfo->getGraphicsAllocation());
+    }
+
+    auto kernelName = kernelInfos[1]->name;
+    auto kernelInfo = pProgram->getKernelInfo(kernelName.c_str());
+    ASSERT_EQ(kernelInfos[1], kernelInfo);
+    EXPECT_TRUE(kernelInfo->isValid);
+    EXPECT_NE(nullptr, kernelInfo->patchInfo.executionEnvironment);
+    EXPECT_NE(nullptr, kernelInfo->getGraphicsAllocation());
+    EXPECT_EQ(kernelInfos.size() - 1, mockProgram->lazyKernelDecodesCount);
+    EXPECT_EQ(nullptr, kernelInfos[0]->getGraphicsAllocation());
+
+    EXPECT_EQ(kernelInfo, pProgram->getKernelInfo(kernelName.c_str()));
+    EXPECT_EQ(kernelInfos.size() - 1, mockProgram->lazyKernelDecodesCount);
+}
+
+TEST_F(PatchTokenTests, givenLazyKernelDecodingWhenAllKernelsAreQueriedThenTheyMatchEagerlyDecodedKernels) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableLazyKernelDecoding.set(true);
+    cl_device_id device = pDevice;
+
+    CreateProgramFromBinary<MockProgram>(pContext, &device, "simple_kernels");
+    ASSERT_NE(nullptr, pProgram);
+    auto mockProgram = static_cast<MockProgram *>(pProgram);
+
+    retVal = pProgram->build(1, &device, nullptr, nullptr, nullptr, false);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    struct DecodedKernel {
+        std::string name;
+        size_t numArgs;
+        uint32_t crossThreadDataSize;
+        bool isValid;
+    };
+    std::vector<DecodedKernel> lazilyDecodedKernels;
+    for (size_t i = 0; i < pProgram->getNumKernels(); i++) {
+        auto kernelInfo = pProgram->getKernelInfo(i);
+        ASSERT_NE(nullptr, kernelInfo);
+        lazilyDecodedKernels.push_back({kernelInfo->name, kernelInfo->kernelArgInfo.size(),
+                                        kernelInfo->patchInfo.dataParameterStream ? kernelInfo->patchInfo.dataParameterStream->DataParameterStreamSize : 0u,
+                                        kernelInfo->isValid});
+    }
+    EXPECT_EQ(0u, mockProgram->lazyKernelDecodesCount);
+
+    DebugManager.flags.EnableLazyKernelDecoding.set(false);
+    retVal = pProgram->processGenBinary();
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    ASSERT_EQ(lazilyDecodedKernels.size(), pProgram->getNumKernels());
+
+    for (size_t i = 0; i < pProgram->getNumKernels(); i++) {
+        auto kernelInfo = pProgram->getKernelInfo(i);
+        EXPECT_EQ(lazilyDecodedKernels[i].name, kernelInfo->name);
+        EXPECT_EQ(lazilyDecodedKernels[i].numArgs, kernelInfo->kernelArgInfo.size());
+        EXPECT_EQ(lazilyDecodedKernels[i].crossThreadDataSize, kernelInfo->patchInfo.dataParameterStream ? kernelInfo->patchInfo.dataParameterStream->DataParameterStreamSize : 0u);
+        EXPECT_EQ(lazilyDecodedKernels[i].isValid, kernelInfo->isValid);
+    }
+}
+
 TEST_F(PatchTokenTests, ConstantMemoryObjectKernelArg) {
     // PATCH_TOKEN_STATELESS_CONSTANT_MEMORY_OBJECT_KERNEL_ARGUMENT
     cl_device_id device = pDevice;
@@ -2236,6 +2391,28 @@ TEST_F(ProgramTests, GetGenBinaryReturnsBinaryStoreInProgram) {
     EXPECT_EQ(0, memcmp(genBin, binary, sizeof(genBin)));
 }
 
+TEST_F(ProgramTests, givenBackingStorageWhenGenBinaryIsStoredThenBinaryIsReferencedInPlaceUntilReplaced) {
+    auto genBin = std::make_shared<std::vector<char>>(std::vector<char>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+
+    MockProgram mp(*pDevice->getExecutionEnvironment());
+    mp.storeGenBinary(genBin, ArrayRef<const char>(genBin->data(), genBin->size()));
+    EXPECT_EQ(2, genBin.use_count());
+
+    size_t binarySize = 0;
+    const char *binary = mp.getGenBinary(binarySize);
+    EXPECT_EQ(genBin->data(), binary);
+    EXPECT_EQ(genBin->size(), binarySize);
+
+    char copiedGenBin[] = {11, 12, 13};
+    mp.storeGenBinary(copiedGenBin, sizeof(copiedGenBin));
+    EXPECT_EQ(1, genBin.use_count());
+
+    binary = mp.getGenBinary(binarySize);
+    EXPECT_NE(copiedGenBin, binary);
+    ASSERT_EQ(sizeof(copiedGenBin), binarySize);
+    EXPECT_EQ(0, memcmp(copiedGenBin, binary, sizeof(copiedGenBin)));
+}
+
 TEST_F(ProgramTests, ValidBinaryWithIGCVersionEqual0) {
     cl_int retVal;
 
@@ -5,6 +5,7 @@
  *
  */
 
+#include "core/unit_tests/helpers/debug_manager_state_restore.h"
 #include "runtime/helpers/timestamp_packet.h"
 #include "runtime/utilities/tag_allocator.h"
 #include "test.h"
@@ -13,6 +14,8 @@
 #include "gtest/gtest.h"
 
 #include <cstdint>
+#include <functional>
+#include <thread>
 
 using namespace NEO;
 
@@ -37,7 +40,10 @@ class MockTagAllocator : public TagAllocator<timeStamps> {
   public:
     using TagAllocator<timeStamps>::populateFreeTags;
     using TagAllocator<timeStamps>::deferredTags;
+    using TagAllocator<timeStamps>::magazines;
+    using TagAllocator<timeStamps>::magazinesCount;
     using TagAllocator<timeStamps>::releaseDeferredTags;
+    using TagAllocator<timeStamps>::releaseDeferredTagsUpToWatermark;
 
     MockTagAllocator(MemoryManager *memMngr, size_t tagCount, size_t tagAlignment) : TagAllocator<timeStamps>(memMngr, tagCount, tagAlignment) {
     }
@@ -354,3 +360,187 @@ TEST_F(TagAllocatorTest, givenTagAllocatorWhenGraphicsAllocationIsCreatedThenSet
     EXPECT_EQ(GraphicsAllocation::AllocationType::PROFILING_TAG_BUFFER, hwTimeStampsTag->getBaseGraphicsAllocation()->getAllocationType());
     EXPECT_EQ(GraphicsAllocation::AllocationType::PROFILING_TAG_BUFFER, hwPerfCounterTag->getBaseGraphicsAllocation()->getAllocationType());
 }
+
+TEST_F(TagAllocatorTest, givenThreadCacheEnabledWhenTagsAreReturnedThenTheyAreReusedWithoutNewPool) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableTagAllocatorThreadCache.set(true);
+
+    // Big alignment to force only 4 tags
+    MockTagAllocator tagAllocator(memoryManager, 4, 1024);
+
+    for (int iteration = 0; iteration < 3; iteration++) {
+        TagNode<timeStamps> *tagNodes[4];
+        for (int i = 0; i < 4; i++) {
+            tagNodes[i] = tagAllocator.getTag();
+            ASSERT_NE(nullptr, tagNodes[i]);
+            for (int j = 0; j < i; j++) {
+                EXPECT_NE(tagNodes[j], tagNodes[i]);
+            }
+        }
+        for (auto tagNode : tagNodes) {
+            tagAllocator.returnTag(tagNode);
+        }
+    }
+    EXPECT_EQ(1u, tagAllocator.getGraphicsAllocationsCount());
+    EXPECT_TRUE(tagAllocator.getFreeTags().peekIsEmpty());
+    EXPECT_TRUE(tagAllocator.getUsedTags().peekIsEmpty());
+
+    auto tagNodes = std::make_unique<TagNode<timeStamps> *[]>(5);
+    for (int i = 0; i < 5; i++) {
+        tagNodes[i] = tagAllocator.getTag();
+    }
+    EXPECT_EQ(2u, tagAllocator.getGraphicsAllocationsCount());
+    for (int i = 0; i < 5; i++) {
+        tagAllocator.returnTag(tagNodes[i]);
+    }
+}
+
+TEST_F(TagAllocatorTest, givenThreadCacheEnabledWhenNotReadyTagIsReturnedThenItIsDeferredUntilCompleted) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableTagAllocatorThreadCache.set(true);
+
+    MockTagAllocator tagAllocator(memoryManager, 1, 4096);
+    auto node = tagAllocator.getTag();
+    node->tagForCpuAccess->release = false;
+    tagAllocator.returnTag(node);
+    EXPECT_FALSE(tagAllocator.deferredTags.peekIsEmpty());
+
+    node->tagForCpuAccess->release = true;
+    auto reusedNode = tagAllocator.getTag();
+    EXPECT_EQ(node, reusedNode);
+    EXPECT_TRUE(tagAllocator.deferredTags.peekIsEmpty());
+    EXPECT_EQ(1u, tagAllocator.getGraphicsAllocationsCount());
+    tagAllocator.returnTag(reusedNode);
+}
+
+TEST_F(TagAllocatorTest, givenThreadCacheEnabledWhenReleasingDeferredTagsThenOnlyTagsUpToFirstIncompleteOneAreReleased) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableTagAllocatorThreadCache.set(true);
+
+    MockTagAllocator tagAllocator(memoryManager, 3, 1024);
+    TagNode<timeStamps> *nodes[3];
+    for (auto &node : nodes) {
+        node = tagAllocator.getTag();
+        node->tagForCpuAccess->release = false;
+        tagAllocator.returnTag(node);
+    }
+
+    nodes[0]->tagForCpuAccess->release = true;
+    nodes[2]->tagForCpuAccess->release = true;
+    tagAllocator.releaseDeferredTagsUpToWatermark();
+    EXPECT_FALSE(tagAllocator.deferredTags.peekContains(*nodes[0]));
+    EXPECT_TRUE(tagAllocator.deferredTags.peekContains(*nodes[1]));
+    EXPECT_TRUE(tagAllocator.deferredTags.peekContains(*nodes[2]));
+}
+
+TEST_F(TagAllocatorTest, givenThreadCacheEnabledWhenOldestDeferredTagIsIncompleteThenOtherCompletedTagsAreReleased) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableTagAllocatorThreadCache.set(true);
+
+    MockTagAllocator tagAllocator(memoryManager, 2, 2048);
+    auto node1 = tagAllocator.getTag();
+    auto node2 = tagAllocator.getTag();
+    node1->tagForCpuAccess->release = false;
+    node2->tagForCpuAccess->release = false;
+    tagAllocator.returnTag(node1);
+    tagAllocator.returnTag(node2);
+
+    node2->tagForCpuAccess->release = true;
+    auto node = tagAllocator.getTag();
+    EXPECT_EQ(node2, node);
+    EXPECT_TRUE(tagAllocator.deferredTags.peekContains(*node1));
+    EXPECT_EQ(1u, tagAllocator.getGraphicsAllocationsCount());
+}
+
+TEST_F(TagAllocatorTest, givenThreadCacheEnabledWhenTagsAreUsedConcurrentlyThenEachTagIsOwnedByOneThreadAtTime) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableTagAllocatorThreadCache.set(true);
+
+    MockTagAllocator tagAllocator(memoryManager, 64, 64);
+    std::atomic<bool> tagSharedBetweenThreads{false};
+
+    auto worker = [&](uint64_t threadId) {
+        TagNode<timeStamps> *nodes[8];
+        for (int iteration = 0; iteration < 1000; iteration++) {
+            for (auto &node : nodes) {
+                node = tagAllocator.getTag();
+                node->tagForCpuAccess->start = threadId;
+            }
+            for (auto &node : nodes) {
+                if (node->tagForCpuAccess->start != threadId) {
+                    tagSharedBetweenThreads = true;
+                }
+                tagAllocator.returnTag(node);
+            }
+        }
+    };
+
+    std::thread threads[4];
+    for (uint64_t i = 0; i < 4; i++) {
+        threads[i] = std::thread(worker, i);
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_FALSE(tagSharedBetweenThreads);
+}
+
+TEST_F(TagAllocatorTest, givenThreadCacheEnabledWhenTagAllocatorIsCreatedThenEachMagazineStartsItsOwnCacheLine) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableTagAllocatorThreadCache.set(true);
+
+    MockTagAllocator tagAllocator(memoryManager, 10, 64);
+    ASSERT_NE(nullptr, tagAllocator.magazines);
+    for (uint32_t i = 0; i < MockTagAllocator::magazinesCount; i++) {
+        EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(&tagAllocator.magazines[i]) % MemoryConstants::cacheLineSize);
+        EXPECT_EQ(0u, tagAllocator.magazines[i].count);
+    }
+}
+
+struct TimestampsWithReleaseCheckHook : public timeStamps {
+    bool canBeReleased() const {
+        if (onReleaseCheck) {
+            auto hook = std::move(onReleaseCheck);
+            onReleaseCheck = nullptr;
+            hook();
+        }
+        return release;
+    }
+    static std::function<void()> onReleaseCheck;
+};
+std::function<void()> TimestampsWithReleaseCheckHook::onReleaseCheck;
+
+class MockHookedTagAllocator : public TagAllocator<TimestampsWithReleaseCheckHook> {
+  public:
+    using TagAllocator<TimestampsWithReleaseCheckHook>::deferredTags;
+    using TagAllocator<TimestampsWithReleaseCheckHook>::releaseDeferredTagsUpToWatermark;
+    using TagAllocator<TimestampsWithReleaseCheckHook>::TagAllocator;
+};
+
+TEST_F(TagAllocatorTest, givenThreadCacheEnabledWhenTagIsDeferredWhileDeferredTagsAreReleasedThenReturnOrderIsPreserved) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableTagAllocatorThreadCache.set(true);
+
+    MockHookedTagAllocator tagAllocator(memoryManager, 3, 1024);
+    TagNode<TimestampsWithReleaseCheckHook> *nodes[3];
+    for (auto &node : nodes) {
+        node = tagAllocator.getTag();
+        node->tagForCpuAccess->release = false;
+    }
+    tagAllocator.returnTag(nodes[0]);
+    tagAllocator.returnTag(nodes[1]);
+
+    // the newest tag is returned by another thread while the deferred list is being processed
+    TimestampsWithReleaseCheckHook::onReleaseCheck = [&]() {
+        tagAllocator.returnTag(nodes[2]);
+    };
+    tagAllocator.releaseDeferredTagsUpToWatermark();
+    EXPECT_EQ(nullptr, TimestampsWithReleaseCheckHook::onReleaseCheck);
+
+    auto node = tagAllocator.deferredTags.peekHead();
+    for (auto expectedNode : nodes) {
+        EXPECT_EQ(expectedNode, node);
+        node = node ? node->next : nullptr;
+    }
+    EXPECT_EQ(nullptr, node);
+}